@@ -16,18 +16,21 @@ namespace kagome::api {
       sptr<transaction_pool::TransactionPool> pool,
       sptr<crypto::Hasher> hasher,
       sptr<blockchain::BlockTree> block_tree,
-      std::shared_ptr<storage::trie::TrieDb> trie_db)
+      std::shared_ptr<storage::trie::TrieDb> trie_db,
+      std::shared_ptr<network::ExtrinsicGossiper> gossiper)
       : api_{std::move(api)},
         pool_{std::move(pool)},
         hasher_{std::move(hasher)},
         block_tree_{std::move(block_tree)},
         trie_db_{std::move(trie_db)},
+        gossiper_{std::move(gossiper)},
         logger_{common::createLogger("ExtrinsicApi")} {
     BOOST_ASSERT_MSG(api_ != nullptr, "extrinsic api is nullptr");
     BOOST_ASSERT_MSG(pool_ != nullptr, "transaction pool is nullptr");
     BOOST_ASSERT_MSG(hasher_ != nullptr, "hasher is nullptr");
     BOOST_ASSERT_MSG(block_tree_ != nullptr, "block tree is nullptr");
     BOOST_ASSERT_MSG(trie_db_ != nullptr, "trie db is nullptr");
+    BOOST_ASSERT_MSG(gossiper_ != nullptr, "gossiper is nullptr");
     BOOST_ASSERT_MSG(logger_ != nullptr, "logger is nullptr");
   }
 
@@ -64,7 +67,13 @@ namespace kagome::api {
                                               v.propagate};
 
           // send to pool
-          OUTCOME_TRY(pool_->submitOne(std::move(transaction)));
+          OUTCOME_TRY(pool_->submitOne(primitives::Transaction{transaction}));
+
+          // transactions, which are already in the pool, are not propagated
+          // again, so gossip does not circulate
+          if (transaction.should_propagate) {
+            gossiper_->propagateTransactions(gsl::make_span(&transaction, 1));
+          }
 
           return hash;
         });
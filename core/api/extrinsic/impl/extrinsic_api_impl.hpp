@@ -20,6 +20,7 @@
 #include "common/logger.hpp"
 #include "common/visitor.hpp"
 #include "crypto/hasher.hpp"
+#include "network/extrinsic_gossiper.hpp"
 #include "storage/trie/trie_db.hpp"
 
 namespace kagome::transaction_pool {
@@ -42,12 +43,15 @@ namespace kagome::api {
      * @param pool transaction pool instance shared ptr
      * @param hasher hasher instance shared ptr
      * @param block_tree block tree instance shared ptr
+     * @param trie_db trie db instance shared ptr
+     * @param gossiper propagates submitted transactions to the peers
      */
     ExtrinsicApiImpl(std::shared_ptr<runtime::TaggedTransactionQueue> api,
                      std::shared_ptr<transaction_pool::TransactionPool> pool,
                      std::shared_ptr<crypto::Hasher> hasher,
                      std::shared_ptr<blockchain::BlockTree> block_tree,
-                     std::shared_ptr<storage::trie::TrieDb> trie_db);
+                     std::shared_ptr<storage::trie::TrieDb> trie_db,
+                     std::shared_ptr<network::ExtrinsicGossiper> gossiper);
 
     ~ExtrinsicApiImpl() override = default;
 
@@ -67,6 +71,7 @@ namespace kagome::api {
     sptr<crypto::Hasher> hasher_;
     sptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<storage::trie::TrieDb> trie_db_;
+    std::shared_ptr<network::ExtrinsicGossiper> gossiper_;
     common::Logger logger_;
   };
 }  // namespace kagome::api
@@ -30,16 +30,17 @@ namespace kagome::api {
     virtual void registerHandler(const std::string &name, Method method) = 0;
 
     /**
-     * Response callback type
+     * Response callback type, the response is passed in its own string to be
+     * moved further to the session
      */
-    using ResponseHandler = std::function<void(const std::string &)>;
+    using ResponseHandler = std::function<void(std::string)>;
 
     /**
      * @brief handles decoded network message
      * @param request json request string
      * @param cb callback
      */
-    virtual void processData(std::string_view request,
+    virtual void processData(const std::string &request,
                              const ResponseHandler &cb) = 0;
   };
 
@@ -17,13 +17,12 @@ namespace kagome::api {
     dispatcher.AddMethod(name, std::move(method));
   }
 
-  void JRpcServerImpl::processData(std::string_view request,
-                               const ResponseHandler &cb) {
-    auto &&formatted_response =
-        jsonrpc_handler_.HandleRequest(std::string(request));
-    std::string response(formatted_response->GetData(),
-                         formatted_response->GetSize());
-    cb(response);
+  void JRpcServerImpl::processData(const std::string &request,
+                                   const ResponseHandler &cb) {
+    auto &&formatted_response = jsonrpc_handler_.HandleRequest(request);
+    // the writer owns its buffer, so the response is copied out of it once
+    cb(std::string(formatted_response->GetData(),
+                   formatted_response->GetSize()));
   }
 
 }  // namespace kagome::api
@@ -30,7 +30,8 @@ namespace kagome::api {
      * @param request json request string
      * @param cb callback
      */
-    void processData(std::string_view request, const ResponseHandler &cb) override;
+    void processData(const std::string &request,
+                     const ResponseHandler &cb) override;
 
    private:
     /// json rpc server instance
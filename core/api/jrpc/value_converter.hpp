@@ -8,8 +8,10 @@
 
 #include <vector>
 
+#include <boost/optional.hpp>
 #include <jsonrpc-lean/value.h>
 #include "common/blob.hpp"
+#include "common/hexutil.hpp"
 #include "primitives/extrinsic.hpp"
 
 namespace kagome::api {
@@ -17,8 +19,16 @@ namespace kagome::api {
     return std::vector<uint8_t>{v.begin(), v.end()};
   }
 
+  /// Byte buffers, e.g. storage values, are returned as 0x-prefixed hex
+  /// strings, which are encoded at once and not as a value per byte
   inline jsonrpc::Value makeValue(const common::Buffer &v) {
-    return v.toVector();
+    return common::hex_lower_0x(v);
+  }
+
+  /// Absent values are returned as nulls
+  template <class T>
+  jsonrpc::Value makeValue(const boost::optional<T> &v) {
+    return v ? makeValue(v.value()) : jsonrpc::Value{};
   }
 
   inline jsonrpc::Value makeValue(const primitives::Extrinsic &v) {
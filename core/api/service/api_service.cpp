@@ -5,16 +5,64 @@
 
 #include "api/service/api_service.hpp"
 
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
 #include "api/jrpc/jrpc_processor.hpp"
+#include "api/service/request_context.hpp"
 
 namespace kagome::api {
 
-  ApiService::ApiService(std::vector<std::shared_ptr<Listener>> listeners,
+  namespace {
+    /// JSON-RPC error code of the rejected request
+    constexpr int kServerIsBusy = -32000;
+
+    /// Fields of the request, which are needed before it is executed
+    struct RequestHeader {
+      /// empty for malformed and batch requests
+      std::string method;
+      /// JSON of the id of the request
+      std::string id = "null";
+    };
+
+    RequestHeader parseHeader(std::string_view request) {
+      RequestHeader header;
+      rapidjson::Document document;
+      document.Parse(request.data(), request.size());
+      if (document.HasParseError() or not document.IsObject()) {
+        return header;
+      }
+      if (auto method = document.FindMember("method");
+          method != document.MemberEnd() and method->value.IsString()) {
+        header.method.assign(method->value.GetString(),
+                             method->value.GetStringLength());
+      }
+      if (auto id = document.FindMember("id"); id != document.MemberEnd()) {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+        id->value.Accept(writer);
+        header.id.assign(buffer.GetString(), buffer.GetSize());
+      }
+      return header;
+    }
+
+    std::string makeBusyResponse(const std::string &id) {
+      return R"({"jsonrpc":"2.0","id":)" + id + R"(,"error":{"code":)"
+             + std::to_string(kServerIsBusy)
+             + R"(,"message":"server is busy"}})";
+    }
+  }  // namespace
+
+  ApiService::ApiService(std::shared_ptr<RpcExecutor> executor,
+                         std::vector<std::shared_ptr<Listener>> listeners,
                          std::shared_ptr<JRpcServer> server,
                          gsl::span<std::shared_ptr<JRpcProcessor>> processors)
-      : listeners_(std::move(listeners)),
+      : executor_(std::move(executor)),
+        listeners_(std::move(listeners)),
         server_(std::move(server)),
         logger_{common::createLogger("Api service")} {
+    BOOST_ASSERT(executor_ != nullptr);
     for (const auto &listener : listeners_) {
       BOOST_ASSERT(listener != nullptr);
     }
@@ -32,14 +80,24 @@ namespace kagome::api {
             session->connectOnRequest(
                 [self](std::string_view request,
                        std::shared_ptr<Session> session) mutable {
-                  // process new request
-                  self->server_->processData(
-                      std::string(request),
-                      [session = std::move(session)](
-                          const std::string &response) mutable {
-                        // process response
-                        session->respond(response);
+                  // process new request on the thread, which suits its
+                  // method; session sends the response on its own executor.
+                  // The request is copied out of the read buffer of the
+                  // session once, the response is moved up to the session
+                  auto header = parseHeader(request);
+                  auto accepted = self->executor_->execute(
+                      header.method,
+                      [self, request = std::string(request), session]() {
+                        RequestContext context{session};
+                        self->server_->processData(
+                            request, [&context](std::string response) {
+                              // process response
+                              context.respond(std::move(response));
+                            });
                       });
+                  if (not accepted) {
+                    session->respond(makeBusyResponse(header.id));
+                  }
                 });
           });
     }
@@ -7,9 +7,11 @@
 #define KAGOME_CORE_API_SERVICE_HPP
 
 #include <functional>
+
 #include <gsl/span>
 
 #include "api/jrpc/jrpc_server_impl.hpp"
+#include "api/service/rpc_executor.hpp"
 #include "api/transport/listener.hpp"
 #include "common/logger.hpp"
 
@@ -18,7 +20,9 @@ namespace kagome::api {
   class JRpcProcessor;
 
   /**
-   * Service listening for incoming JSON RPC requests
+   * Service listening for incoming JSON RPC requests. Sessions of the
+   * listeners may live on other threads, requests are passed to the executor,
+   * which runs each of them on the thread suitable for its method
    */
   class ApiService : public std::enable_shared_from_this<ApiService> {
    public:
@@ -27,11 +31,12 @@ namespace kagome::api {
 
     /**
      * @brief constructor
-     * @param context - reference to the io context
+     * @param executor - executor of the requests
      * @param listener - a shared ptr to the endpoint listener instance
      * @param processors - shared ptrs to JSON processor instances
      */
-    ApiService(std::vector<std::shared_ptr<Listener>> listeners,
+    ApiService(std::shared_ptr<RpcExecutor> executor,
+               std::vector<std::shared_ptr<Listener>> listeners,
                std::shared_ptr<JRpcServer> server,
                gsl::span<std::shared_ptr<JRpcProcessor>> processors);
 
@@ -47,6 +52,7 @@ namespace kagome::api {
     virtual void stop();
 
    private:
+    std::shared_ptr<RpcExecutor> executor_;
     std::vector<sptr<Listener>> listeners_;
     std::shared_ptr<JRpcServer> server_;
     common::Logger logger_;
@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_API_SERVICE_REQUEST_CONTEXT_HPP
+#define KAGOME_CORE_API_SERVICE_REQUEST_CONTEXT_HPP
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "api/transport/session.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Context of the request, which is being processed by the current thread.
+   * It is set by ApiService for the duration of a request, so handlers of
+   * methods can reach the session of the request and defer actions until
+   * the response is passed to the session
+   */
+  class RequestContext {
+   public:
+    explicit RequestContext(std::shared_ptr<Session> session)
+        : session_{std::move(session)}, previous_{current_} {
+      current_ = this;
+    }
+
+    RequestContext(const RequestContext &) = delete;
+    RequestContext &operator=(const RequestContext &) = delete;
+
+    ~RequestContext() {
+      current_ = previous_;
+    }
+
+    /**
+     * @return context of the request processed by the current thread,
+     * nullptr outside of a request
+     */
+    static RequestContext *current() {
+      return current_;
+    }
+
+    const std::shared_ptr<Session> &session() const {
+      return session_;
+    }
+
+    /**
+     * Run \param action after the response is passed to the session, thus
+     * messages it pushes to the session follow the response
+     */
+    void afterResponse(std::function<void()> action) {
+      deferred_.push_back(std::move(action));
+    }
+
+    /**
+     * Pass \param response to the session and run the deferred actions
+     */
+    void respond(std::string response) {
+      session_->respond(std::move(response));
+      auto deferred = std::move(deferred_);
+      deferred_.clear();
+      for (auto &action : deferred) {
+        action();
+      }
+    }
+
+   private:
+    std::shared_ptr<Session> session_;
+    RequestContext *previous_;
+    std::vector<std::function<void()>> deferred_;
+
+    static inline thread_local RequestContext *current_ = nullptr;
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_CORE_API_SERVICE_REQUEST_CONTEXT_HPP
@@ -0,0 +1,97 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/response_cache.hpp"
+
+#include <vector>
+
+#include <boost/assert.hpp>
+
+namespace kagome::api {
+
+  ResponseCache::ResponseCache(Configuration config)
+      : config_{std::move(config)} {}
+
+  boost::optional<common::Buffer> ResponseCache::get(
+      std::string_view method,
+      const primitives::BlockHash &block,
+      const common::Buffer &params) {
+    auto key = makeKey(method, block, params);
+    std::lock_guard lock{mutex_};
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return boost::none;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->result;
+  }
+
+  void ResponseCache::put(std::string_view method,
+                          const primitives::BlockHash &block,
+                          const common::Buffer &params,
+                          common::Buffer result) {
+    auto key = makeKey(method, block, params);
+    auto entry_size = key.size() + result.size();
+    if (entry_size > config_.max_size) {
+      return;
+    }
+    std::lock_guard lock{mutex_};
+    if (index_.count(key) != 0) {
+      // the same result is put by concurrent requests
+      return;
+    }
+    while (size_ + entry_size > config_.max_size) {
+      erase(std::prev(entries_.end()));
+    }
+    entries_.push_front({std::move(key), block, std::move(result)});
+    index_.emplace(entries_.front().key, entries_.begin());
+    block_keys_[block].emplace(entries_.front().key);
+    size_ += entry_size;
+  }
+
+  size_t ResponseCache::size() const {
+    std::lock_guard lock{mutex_};
+    return size_;
+  }
+
+  void ResponseCache::onBlockPruned(const primitives::BlockInfo &block) {
+    std::lock_guard lock{mutex_};
+    auto keys_it = block_keys_.find(block.block_hash);
+    if (keys_it == block_keys_.end()) {
+      return;
+    }
+    // erase() drops the keys from the index of the block, so they are copied
+    std::vector<std::string_view> keys{keys_it->second.begin(),
+                                       keys_it->second.end()};
+    for (auto key : keys) {
+      erase(index_.at(key));
+    }
+  }
+
+  std::string ResponseCache::makeKey(std::string_view method,
+                                     const primitives::BlockHash &block,
+                                     const common::Buffer &params) {
+    std::string key;
+    key.reserve(method.size() + 1 + block.size() + params.size());
+    key.append(method)
+        .append(1, '\0')
+        .append(block.begin(), block.end())
+        .append(params.begin(), params.end());
+    return key;
+  }
+
+  void ResponseCache::erase(Entries::iterator entry) {
+    size_ -= entry->key.size() + entry->result.size();
+    auto keys_it = block_keys_.find(entry->block);
+    BOOST_ASSERT(keys_it != block_keys_.end());
+    keys_it->second.erase(entry->key);
+    if (keys_it->second.empty()) {
+      block_keys_.erase(keys_it);
+    }
+    index_.erase(entry->key);
+    entries_.erase(entry);
+  }
+
+}  // namespace kagome::api
@@ -0,0 +1,100 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_API_SERVICE_RESPONSE_CACHE_HPP
+#define KAGOME_CORE_API_SERVICE_RESPONSE_CACHE_HPP
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/optional.hpp>
+
+#include "blockchain/block_tree_observer.hpp"
+#include "common/buffer.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Bounded cache of the results of RPC methods, which are pinned to a block
+   * by its hash, e.g. state_getStorage with the block argument: the state at
+   * a block never changes, so such a result is read once and then served
+   * from the cache. Results of a block are dropped only when the block is
+   * pruned from the tree; over the size limit the least recently used
+   * results are evicted. May be used from any thread
+   */
+  class ResponseCache : public blockchain::BlockTreeObserver {
+   public:
+    struct Configuration {
+      static constexpr size_t kDefaultMaxSize = 64u << 20u;
+
+      /// total size of the cached results and their keys in bytes
+      size_t max_size{kDefaultMaxSize};
+    };
+
+    explicit ResponseCache(Configuration config);
+
+    /**
+     * @return result of \param method with \param params at \param block,
+     * none if it is not cached
+     */
+    boost::optional<common::Buffer> get(std::string_view method,
+                                        const primitives::BlockHash &block,
+                                        const common::Buffer &params);
+
+    /**
+     * Cache \param result of \param method with \param params at \param
+     * block; results larger than the whole cache are not cached
+     */
+    void put(std::string_view method,
+             const primitives::BlockHash &block,
+             const common::Buffer &params,
+             common::Buffer result);
+
+    /// @return total size of the cached results and their keys in bytes
+    size_t size() const;
+
+    void onBlockAdded(const primitives::BlockInfo &block) override {}
+
+    void onBlockFinalized(const primitives::BlockInfo &block) override {}
+
+    /// Results at the pruned block are dropped, as it can not be read anymore
+    void onBlockPruned(const primitives::BlockInfo &block) override;
+
+   private:
+    struct Entry {
+      std::string key;
+      primitives::BlockHash block;
+      common::Buffer result;
+    };
+    using Entries = std::list<Entry>;
+
+    static std::string makeKey(std::string_view method,
+                               const primitives::BlockHash &block,
+                               const common::Buffer &params);
+
+    /// Forget \param entry; must be invoked under the lock
+    void erase(Entries::iterator entry);
+
+    Configuration config_;
+
+    mutable std::mutex mutex_;
+    /// the most recently used entries are in the front
+    Entries entries_;
+    std::unordered_map<std::string_view, Entries::iterator> index_;
+    /// keys of the entries of each block, so that they are dropped on its
+    /// pruning without the scan of the whole cache
+    std::unordered_map<primitives::BlockHash,
+                       std::unordered_set<std::string_view>>
+        block_keys_;
+    size_t size_{0};
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_CORE_API_SERVICE_RESPONSE_CACHE_HPP
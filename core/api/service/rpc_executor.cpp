@@ -0,0 +1,121 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/rpc_executor.hpp"
+
+#include <algorithm>
+
+#include <boost/asio/post.hpp>
+
+namespace kagome::api {
+
+  RpcExecutor::RpcExecutor(
+      std::shared_ptr<boost::asio::io_context> main_context, Params params)
+      : main_context_{std::move(main_context)},
+        params_{std::move(params)},
+        workers_{std::max<size_t>(1, params_.workers)},
+        logger_{common::createLogger("RpcExecutor")} {
+    BOOST_ASSERT(main_context_ != nullptr);
+  }
+
+  RpcExecutor::~RpcExecutor() {
+    workers_.join();
+  }
+
+  bool RpcExecutor::execute(const std::string &method, Task task) {
+    Pending pending{method,
+                    std::move(task),
+                    params_.worker_methods.count(method) == 0};
+
+    std::lock_guard lock{mutex_};
+    if (queue_.size() >= params_.max_queue_size) {
+      ++metrics_.rejected;
+      logger_->warn("Request of {} is rejected, {} requests are waiting",
+                    method,
+                    queue_.size());
+      return false;
+    }
+    ++metrics_.queued_by_method[method];
+    queue_.push_back(std::move(pending));
+    startPending();
+    metrics_.max_queue_size =
+        std::max(metrics_.max_queue_size, metrics_.queue_size);
+    return true;
+  }
+
+  RpcExecutor::Metrics RpcExecutor::getMetrics() const {
+    std::lock_guard lock{mutex_};
+    return metrics_;
+  }
+
+  bool RpcExecutor::canStart(const std::string &method,
+                             bool on_main_thread) const {
+    if (on_main_thread
+            ? metrics_.running_on_main_thread >= params_.main_thread_requests
+            : metrics_.running_on_workers >= params_.workers) {
+      return false;
+    }
+    auto limit = params_.method_limits.find(method);
+    if (limit == params_.method_limits.end()) {
+      return true;
+    }
+    auto running = running_by_method_.find(method);
+    return running == running_by_method_.end()
+           or running->second < limit->second;
+  }
+
+  void RpcExecutor::startPending() {
+    for (auto it = queue_.begin(); it != queue_.end();) {
+      if (not canStart(it->method, it->on_main_thread)) {
+        ++it;
+        continue;
+      }
+      auto queued = metrics_.queued_by_method.find(it->method);
+      if (--queued->second == 0) {
+        metrics_.queued_by_method.erase(queued);
+      }
+      auto pending = std::move(*it);
+      it = queue_.erase(it);
+      start(std::move(pending));
+    }
+    metrics_.queue_size = queue_.size();
+  }
+
+  void RpcExecutor::start(Pending pending) {
+    ++running_by_method_[pending.method];
+    auto &running = pending.on_main_thread ? metrics_.running_on_main_thread
+                                           : metrics_.running_on_workers;
+    ++running;
+
+    auto job = [wp = weak_from_this(),
+                method = std::move(pending.method),
+                task = std::move(pending.task),
+                on_main_thread = pending.on_main_thread] {
+      task();
+      if (auto self = wp.lock()) {
+        self->onFinished(method, on_main_thread);
+      }
+    };
+    if (pending.on_main_thread) {
+      boost::asio::post(*main_context_, std::move(job));
+    } else {
+      boost::asio::post(workers_, std::move(job));
+    }
+  }
+
+  void RpcExecutor::onFinished(const std::string &method,
+                               bool on_main_thread) {
+    std::lock_guard lock{mutex_};
+    auto running = running_by_method_.find(method);
+    if (--running->second == 0) {
+      running_by_method_.erase(running);
+    }
+    --(on_main_thread ? metrics_.running_on_main_thread
+                      : metrics_.running_on_workers);
+    ++metrics_.completed;
+    startPending();
+  }
+
+}  // namespace kagome::api
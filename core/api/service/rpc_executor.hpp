@@ -0,0 +1,129 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_API_SERVICE_RPC_EXECUTOR_HPP
+#define KAGOME_CORE_API_SERVICE_RPC_EXECUTOR_HPP
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+#include "common/logger.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Executes RPC requests. Methods, which only read snapshots of the state
+   * (the trie at the state root of a block is never changed, so it may be
+   * read while new blocks are imported), are executed on the own worker
+   * threads. Other methods access the state owned by the main io_context and
+   * are posted there, but only a few at once, so RPC traffic can not occupy
+   * the thread, which produces and imports blocks.
+   * Requests over the limits wait in a bounded queue, requests over the
+   * queue size are rejected. May be invoked from any thread
+   */
+  class RpcExecutor : public std::enable_shared_from_this<RpcExecutor> {
+   public:
+    struct Params {
+      static constexpr size_t kDefaultWorkers = 2;
+      static constexpr size_t kDefaultMainThreadRequests = 1;
+      static constexpr size_t kDefaultMaxQueueSize = 1024;
+
+      /// number of threads, which execute snapshot reads
+      size_t workers{kDefaultWorkers};
+
+      /// number of requests, which are posted to the main io_context at once
+      size_t main_thread_requests{kDefaultMainThreadRequests};
+
+      /// number of waiting requests, over which new requests are rejected
+      size_t max_queue_size{kDefaultMaxQueueSize};
+
+      /// methods, which only read snapshots of the state or are synchronized
+      /// themselves; other methods are executed on the main io_context
+      std::unordered_set<std::string> worker_methods{
+          "state_getStorage",
+          "state_queryStorageAt",
+          "chain_subscribeNewHeads",
+          "chain_unsubscribeNewHeads",
+          "chain_subscribeFinalizedHeads",
+          "chain_unsubscribeFinalizedHeads",
+          "state_subscribeStorage",
+          "state_unsubscribeStorage"};
+
+      /// number of concurrently executed requests of a method; methods,
+      /// which are absent, are limited by the number of threads only
+      std::unordered_map<std::string, size_t> method_limits{};
+    };
+
+    /// State of the queue
+    struct Metrics {
+      /// requests, which wait for execution
+      size_t queue_size{0};
+      /// the largest size of the queue observed
+      size_t max_queue_size{0};
+      /// waiting requests by method
+      std::unordered_map<std::string, size_t> queued_by_method;
+      size_t running_on_workers{0};
+      size_t running_on_main_thread{0};
+      uint64_t completed{0};
+      uint64_t rejected{0};
+    };
+
+    using Task = std::function<void()>;
+
+    RpcExecutor(std::shared_ptr<boost::asio::io_context> main_context,
+                Params params);
+
+    ~RpcExecutor();
+
+    /**
+     * Execute \param task, which processes a request of \param method, as
+     * soon as the limits allow it
+     * @return false if the queue is full and the task is rejected
+     */
+    bool execute(const std::string &method, Task task);
+
+    Metrics getMetrics() const;
+
+   private:
+    struct Pending {
+      std::string method;
+      Task task;
+      bool on_main_thread;
+    };
+
+    /// @return true if a request of \param method executed on \param
+    /// on_main_thread may be started now
+    bool canStart(const std::string &method, bool on_main_thread) const;
+
+    /// Start waiting requests, which fit the limits, in the order of arrival;
+    /// must be invoked under the lock
+    void startPending();
+
+    /// Post \param pending to its thread; must be invoked under the lock
+    void start(Pending pending);
+
+    void onFinished(const std::string &method, bool on_main_thread);
+
+    std::shared_ptr<boost::asio::io_context> main_context_;
+    Params params_;
+    boost::asio::thread_pool workers_;
+
+    mutable std::mutex mutex_;
+    std::deque<Pending> queue_;
+    std::unordered_map<std::string, size_t> running_by_method_;
+    Metrics metrics_;
+
+    common::Logger logger_;
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_CORE_API_SERVICE_RPC_EXECUTOR_HPP
@@ -34,4 +34,14 @@ namespace kagome::api {
         trie_builder_->buildAt(header.state_root);
     return trie_reader->get(key);
   }
+
+  outcome::result<StateApi::StorageValues> StateApiImpl::queryStorageAt(
+      const std::vector<common::Buffer> &keys,
+      const boost::optional<primitives::BlockHash> &at) const {
+    auto block = at ? at.value() : block_tree_->getLastFinalized().block_hash;
+    OUTCOME_TRY(header, block_repo_->getBlockHeader(block));
+    auto trie_reader = trie_builder_->buildAt(header.state_root);
+    OUTCOME_TRY(values, trie_reader->getMany(keys));
+    return StorageValues{block, std::move(values)};
+  }
 }  // namespace kagome::api
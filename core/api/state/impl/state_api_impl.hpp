@@ -13,6 +13,11 @@
 
 namespace kagome::api {
 
+  /**
+   * Reads storage from the trie at the state root of a block. Such a trie is
+   * never changed, so it is a consistent snapshot of the state, and reads may
+   * be done on any thread, while the new blocks are imported
+   */
   class StateApiImpl : public StateApi {
    public:
     StateApiImpl(std::shared_ptr<blockchain::BlockHeaderRepository> block_repo,
@@ -23,6 +28,9 @@ namespace kagome::api {
         const common::Buffer &key) const override;
     outcome::result<common::Buffer> getStorage(
         const common::Buffer &key, const primitives::BlockHash &at) const override;
+    outcome::result<StorageValues> queryStorageAt(
+        const std::vector<common::Buffer> &keys,
+        const boost::optional<primitives::BlockHash> &at) const override;
 
    private:
     std::shared_ptr<blockchain::BlockHeaderRepository> block_repo_;
@@ -7,30 +7,25 @@
 
 namespace kagome::api {
 
-  std::tuple<common::Buffer, boost::optional<primitives::BlockHash>>
-  StateJrpcParamParser::parseGetStorageParams(
-      const jsonrpc::Request::Parameters &params) const {
-    if (params.size() > 2 or params.empty()) {
-      throw jsonrpc::InvalidParametersFault("Incorrect number of params");
-    }
-    auto &param0 = params[0];
-    if (not param0.IsString()) {
-      throw jsonrpc::InvalidParametersFault(
-          "Parameter 'key' must be a hex string");
-    }
-    auto &&key_str = param0.AsString();
-    auto &&key = common::unhexWith0x(key_str);
-    if (not key) {
-      throw jsonrpc::Fault(key.error().message());
+  namespace {
+    common::Buffer parseKey(const jsonrpc::Value &param) {
+      if (not param.IsString()) {
+        throw jsonrpc::InvalidParametersFault(
+            "Parameter 'key' must be a hex string");
+      }
+      auto &&key = common::unhexWith0x(param.AsString());
+      if (not key) {
+        throw jsonrpc::Fault(key.error().message());
+      }
+      return common::Buffer(key.value());
     }
-    if (params.size() > 1) {
-      auto &param1 = params[1];
-      if (not param0.IsString()) {
+
+    primitives::BlockHash parseBlockHash(const jsonrpc::Value &param) {
+      if (not param.IsString()) {
         throw jsonrpc::InvalidParametersFault(
             "Parameter 'at' must be a hex string");
       }
-      auto &&at_str = param1.AsString();
-      auto &&at_buf = common::unhexWith0x(at_str);
+      auto &&at_buf = common::unhexWith0x(param.AsString());
       if (not at_buf) {
         throw jsonrpc::Fault(at_buf.error().message());
       }
@@ -38,10 +33,45 @@ namespace kagome::api {
       if (not at) {
         throw jsonrpc::Fault(at.error().message());
       }
-      return std::make_tuple(common::Buffer(key.value()),
-                             boost::make_optional(at.value()));
+      return at.value();
+    }
+  }  // namespace
+
+  std::tuple<common::Buffer, boost::optional<primitives::BlockHash>>
+  StateJrpcParamParser::parseGetStorageParams(
+      const jsonrpc::Request::Parameters &params) const {
+    if (params.size() > 2 or params.empty()) {
+      throw jsonrpc::InvalidParametersFault("Incorrect number of params");
+    }
+    auto key = parseKey(params[0]);
+    if (params.size() > 1) {
+      return std::make_tuple(std::move(key),
+                             boost::make_optional(parseBlockHash(params[1])));
+    }
+    return std::make_tuple(std::move(key), boost::none);
+  }
+
+  std::tuple<std::vector<common::Buffer>,
+             boost::optional<primitives::BlockHash>>
+  StateJrpcParamParser::parseQueryStorageAtParams(
+      const jsonrpc::Request::Parameters &params) const {
+    if (params.size() > 2 or params.empty()) {
+      throw jsonrpc::InvalidParametersFault("Incorrect number of params");
+    }
+    if (not params[0].IsArray()) {
+      throw jsonrpc::InvalidParametersFault(
+          "Parameter 'keys' must be an array of hex strings");
+    }
+    std::vector<common::Buffer> keys;
+    keys.reserve(params[0].AsArray().size());
+    for (auto &param : params[0].AsArray()) {
+      keys.push_back(parseKey(param));
+    }
+    if (params.size() > 1) {
+      return std::make_tuple(std::move(keys),
+                             boost::make_optional(parseBlockHash(params[1])));
     }
-    return std::make_tuple(common::Buffer(key.value()), boost::none);
+    return std::make_tuple(std::move(keys), boost::none);
   }
 
 }  // namespace kagome::api
@@ -8,6 +8,7 @@
 
 #include <boost/optional.hpp>
 #include <tuple>
+#include <vector>
 
 #include "api/jrpc/jrpc_processor.hpp"
 #include "common/buffer.hpp"
@@ -19,6 +20,11 @@ namespace kagome::api {
    public:
     std::tuple<common::Buffer, boost::optional<primitives::BlockHash>>
     parseGetStorageParams(const jsonrpc::Request::Parameters &params) const;
+
+    std::tuple<std::vector<common::Buffer>,
+               boost::optional<primitives::BlockHash>>
+    parseQueryStorageAtParams(
+        const jsonrpc::Request::Parameters &params) const;
   };
 
 }  // namespace kagome::api
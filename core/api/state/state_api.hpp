@@ -6,6 +6,10 @@
 #ifndef KAGOME_API_STATE_API_HPP
 #define KAGOME_API_STATE_API_HPP
 
+#include <vector>
+
+#include <boost/optional.hpp>
+
 #include "common/buffer.hpp"
 #include "outcome/outcome.hpp"
 #include "primitives/common.hpp"
@@ -19,6 +23,24 @@ namespace kagome::api {
         const common::Buffer &key) const = 0;
     virtual outcome::result<common::Buffer> getStorage(
         const common::Buffer &key, const primitives::BlockHash &at) const = 0;
+
+    /**
+     * Values of several keys at one block
+     */
+    struct StorageValues {
+      /// block, at which the values are read
+      primitives::BlockHash block;
+      /// values in the order of the keys, none for the absent ones
+      std::vector<boost::optional<common::Buffer>> values;
+    };
+
+    /**
+     * @return values of \param keys at the block \param at or at the last
+     * finalized one; the trie is walked once for all the keys
+     */
+    virtual outcome::result<StorageValues> queryStorageAt(
+        const std::vector<common::Buffer> &keys,
+        const boost::optional<primitives::BlockHash> &at) const = 0;
   };
 
 }  // namespace kagome::api
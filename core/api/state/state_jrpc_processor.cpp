@@ -10,25 +10,66 @@
 
 namespace kagome::api {
 
-  StateJrpcProcessor::StateJrpcProcessor(
-      std::shared_ptr<JRpcServer> server, std::shared_ptr<StateApi> api)
-      : api_{std::move(api)}, server_{std::move(server)} {
+  namespace {
+    constexpr auto kGetStorage = "state_getStorage";
+    constexpr auto kQueryStorageAt = "state_queryStorageAt";
+  }  // namespace
+
+  StateJrpcProcessor::StateJrpcProcessor(std::shared_ptr<JRpcServer> server,
+                                         std::shared_ptr<StateApi> api,
+                                         std::shared_ptr<ResponseCache> cache)
+      : api_{std::move(api)},
+        server_{std::move(server)},
+        cache_{std::move(cache)} {
     BOOST_ASSERT(api_ != nullptr);
     BOOST_ASSERT(server_ != nullptr);
+    BOOST_ASSERT(cache_ != nullptr);
   }
 
   void StateJrpcProcessor::registerHandlers() {
     server_->registerHandler(
-        "state_getStorage",
+        kGetStorage,
         [this](const jsonrpc::Request::Parameters &params) -> jsonrpc::Value {
           StateJrpcParamParser parser;
           auto &&[key, at] = parser.parseGetStorageParams(params);
+          // storage at the given block never changes, so it is cached
+          if (at) {
+            if (auto cached = cache_->get(kGetStorage, at.value(), key)) {
+              return makeValue(cached.value());
+            }
+          }
           auto &&res = at ? api_->getStorage(key, at.value())
                           : this->api_->getStorage(key);
           if (!res) {
             throw jsonrpc::Fault(res.error().message());
           }
-          return makeValue(res.value());
+          auto value = makeValue(res.value());
+          if (at) {
+            cache_->put(kGetStorage, at.value(), key, std::move(res.value()));
+          }
+          return value;
+        });
+
+    server_->registerHandler(
+        kQueryStorageAt,
+        [this](const jsonrpc::Request::Parameters &params) -> jsonrpc::Value {
+          StateJrpcParamParser parser;
+          auto &&[keys, at] = parser.parseQueryStorageAtParams(params);
+          auto &&res = api_->queryStorageAt(keys, at);
+          if (!res) {
+            throw jsonrpc::Fault(res.error().message());
+          }
+          // a change set with the values of all the keys at the block
+          jsonrpc::Value::Array changes;
+          changes.reserve(keys.size());
+          for (size_t i = 0; i < keys.size(); ++i) {
+            changes.emplace_back(jsonrpc::Value::Array{
+                makeValue(keys[i]), makeValue(res.value().values[i])});
+          }
+          jsonrpc::Value::Struct change_set;
+          change_set["block"] = common::hex_lower_0x(res.value().block);
+          change_set["changes"] = std::move(changes);
+          return jsonrpc::Value::Array{std::move(change_set)};
         });
   }
 
@@ -11,6 +11,7 @@
 
 #include "api/jrpc/jrpc_processor.hpp"
 #include "api/jrpc/jrpc_server_impl.hpp"
+#include "api/service/response_cache.hpp"
 #include "api/state/state_api.hpp"
 
 namespace kagome::api {
@@ -18,7 +19,8 @@ namespace kagome::api {
   class StateJrpcProcessor : public JRpcProcessor, private boost::noncopyable {
    public:
     StateJrpcProcessor(std::shared_ptr<JRpcServer> server,
-                       std::shared_ptr<StateApi> api);
+                       std::shared_ptr<StateApi> api,
+                       std::shared_ptr<ResponseCache> cache);
     ~StateJrpcProcessor() override = default;
 
     void registerHandlers() override;
@@ -26,6 +28,7 @@ namespace kagome::api {
    private:
     std::shared_ptr<StateApi> api_;
     std::shared_ptr<JRpcServer> server_;
+    std::shared_ptr<ResponseCache> cache_;
   };
 
 }  // namespace kagome::api
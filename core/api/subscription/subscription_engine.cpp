@@ -0,0 +1,356 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/subscription/subscription_engine.hpp"
+
+#include <boost/asio/post.hpp>
+
+#include "common/hexutil.hpp"
+#include "scale/scale.hpp"
+
+namespace kagome::api {
+
+  namespace {
+    constexpr std::string_view kNewHead = "chain_newHead";
+    constexpr std::string_view kFinalizedHead = "chain_finalizedHead";
+    constexpr std::string_view kStorage = "state_storage";
+
+    std::string toJsonHex(gsl::span<const uint8_t> bytes) {
+      return '"' + common::hex_lower_0x(bytes) + '"';
+    }
+
+    std::string makeNotification(std::string_view method,
+                                 SubscriptionEngine::SubscriptionId id,
+                                 std::string_view result) {
+      constexpr std::string_view kPrefix =
+          R"({"jsonrpc":"2.0","method":")";
+      constexpr std::string_view kParams = R"(","params":{"subscription":)";
+      constexpr std::string_view kResult = R"(,"result":)";
+      auto id_str = std::to_string(id);
+
+      std::string notification;
+      notification.reserve(kPrefix.size() + method.size() + kParams.size()
+                           + id_str.size() + kResult.size() + result.size()
+                           + 2);
+      notification.append(kPrefix)
+          .append(method)
+          .append(kParams)
+          .append(id_str)
+          .append(kResult)
+          .append(result)
+          .append("}}");
+      return notification;
+    }
+  }  // namespace
+
+  SubscriptionEngine::SubscriptionEngine(
+      std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+      std::shared_ptr<blockchain::BlockTree> block_tree,
+      std::shared_ptr<ReadonlyTrieBuilder> trie_builder)
+      : header_repo_{std::move(header_repo)},
+        block_tree_{std::move(block_tree)},
+        trie_builder_{std::move(trie_builder)},
+        logger_{common::createLogger("SubscriptionEngine")} {
+    BOOST_ASSERT(header_repo_ != nullptr);
+    BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(trie_builder_ != nullptr);
+  }
+
+  SubscriptionEngine::~SubscriptionEngine() {
+    thread_.stop();
+    thread_.join();
+  }
+
+  void SubscriptionEngine::onBlockAdded(const primitives::BlockInfo &block) {
+    // the tree is read on the thread, which has just added the block to it
+    auto is_best = block_tree_->deepestLeaf().block_hash == block.block_hash;
+    boost::asio::post(thread_, [wp = weak_from_this(), block, is_best] {
+      if (auto self = wp.lock()) {
+        self->processNewBlock(block, is_best);
+      }
+    });
+  }
+
+  void SubscriptionEngine::onBlockFinalized(
+      const primitives::BlockInfo &block) {
+    boost::asio::post(thread_, [wp = weak_from_this(), block] {
+      if (auto self = wp.lock()) {
+        self->processFinalizedBlock(block);
+      }
+    });
+  }
+
+  SubscriptionEngine::SubscriptionId SubscriptionEngine::generateId() {
+    return ++last_id_;
+  }
+
+  void SubscriptionEngine::subscribeHeads(
+      SubscriptionId id, Kind kind, const std::shared_ptr<Session> &session) {
+    BOOST_ASSERT(kind != Kind::STORAGE);
+    std::lock_guard lock{mutex_};
+    subscriptions_.emplace(id, Subscription{kind, session, {}});
+  }
+
+  void SubscriptionEngine::subscribeStorage(
+      SubscriptionId id,
+      const std::shared_ptr<Session> &session,
+      std::vector<common::Buffer> keys) {
+    {
+      std::lock_guard lock{mutex_};
+      subscriptions_.emplace(id, Subscription{Kind::STORAGE, session, {}});
+    }
+    boost::asio::post(thread_,
+                      [wp = weak_from_this(),
+                       id,
+                       session = std::weak_ptr<Session>(session),
+                       keys = std::move(keys)] {
+                        if (auto self = wp.lock()) {
+                          self->pushCurrentValues(id, session, keys);
+                        }
+                      });
+  }
+
+  bool SubscriptionEngine::unsubscribe(
+      SubscriptionId id, Kind kind, const std::shared_ptr<Session> &session) {
+    std::lock_guard lock{mutex_};
+    auto it = subscriptions_.find(id);
+    if (it == subscriptions_.end() or it->second.kind != kind
+        or it->second.session.lock() != session) {
+      return false;
+    }
+    erase(it->second);
+    subscriptions_.erase(it);
+    return true;
+  }
+
+  void SubscriptionEngine::processNewBlock(const primitives::BlockInfo &block,
+                                           bool is_best) {
+    auto header = header_repo_->getBlockHeader(block.block_hash);
+    if (not header) {
+      logger_->error("Header of the new block {} is not loaded: {}",
+                     block.block_hash.toHex(),
+                     header.error().message());
+      return;
+    }
+    auto header_json = headerToJson(header.value());
+    fanOut(Kind::NEW_HEADS, kNewHead, [&](const Subscription &) {
+      return header_json;
+    });
+
+    if (is_best) {
+      processStorageChanges(block, header.value());
+    }
+  }
+
+  void SubscriptionEngine::processStorageChanges(
+      const primitives::BlockInfo &block,
+      const primitives::BlockHeader &header) {
+    std::vector<common::Buffer> keys;
+    {
+      std::lock_guard lock{mutex_};
+      keys.reserve(watched_keys_.size());
+      for (const auto &watched : watched_keys_) {
+        keys.push_back(watched.first);
+      }
+    }
+
+    // the values at the parent are known, unless it is not the last
+    // processed best block, as on a switch to another fork
+    Values parent_values;
+    if (last_block_ == header.parent_hash) {
+      parent_values = std::move(last_values_);
+    }
+    std::vector<common::Buffer> unknown_keys;
+    for (const auto &key : keys) {
+      if (parent_values.count(key) == 0) {
+        unknown_keys.push_back(key);
+      }
+    }
+    if (not unknown_keys.empty()) {
+      auto parent = header_repo_->getBlockHeader(header.parent_hash);
+      if (not parent) {
+        logger_->error("Header of the parent block {} is not loaded: {}",
+                       header.parent_hash.toHex(),
+                       parent.error().message());
+        keys.clear();
+      } else {
+        parent_values.merge(
+            readValues(unknown_keys, parent.value().state_root));
+      }
+    }
+
+    auto values = readValues(keys, header.state_root);
+    Values changes;
+    for (const auto &[key, value] : values) {
+      if (parent_values.at(key) != value) {
+        changes.emplace(key, value);
+      }
+    }
+    // values of the keys, which are not watched anymore, are forgotten
+    last_values_ = std::move(values);
+    last_block_ = block.block_hash;
+    last_state_root_ = header.state_root;
+    if (changes.empty()) {
+      return;
+    }
+
+    fanOut(Kind::STORAGE,
+           kStorage,
+           [&](const Subscription &subscription)
+               -> boost::optional<std::string> {
+             std::vector<common::Buffer> changed;
+             for (const auto &key : subscription.keys) {
+               if (changes.count(key) != 0) {
+                 changed.push_back(key);
+               }
+             }
+             if (changed.empty()) {
+               return boost::none;
+             }
+             return changesToJson(block.block_hash, changed, changes);
+           });
+  }
+
+  void SubscriptionEngine::processFinalizedBlock(
+      const primitives::BlockInfo &block) {
+    auto header = header_repo_->getBlockHeader(block.block_hash);
+    if (not header) {
+      logger_->error("Header of the finalized block {} is not loaded: {}",
+                     block.block_hash.toHex(),
+                     header.error().message());
+      return;
+    }
+    auto header_json = headerToJson(header.value());
+    fanOut(Kind::FINALIZED_HEADS, kFinalizedHead, [&](const Subscription &) {
+      return header_json;
+    });
+  }
+
+  void SubscriptionEngine::pushCurrentValues(
+      SubscriptionId id,
+      std::weak_ptr<Session> session,
+      const std::vector<common::Buffer> &keys) {
+    if (not last_block_) {
+      // no best block is processed since the start, the keys are read at the
+      // last finalized one, which becomes the base of the changes
+      auto block = block_tree_->getLastFinalized().block_hash;
+      auto header = header_repo_->getBlockHeader(block);
+      if (not header) {
+        logger_->error("Header of the finalized block {} is not loaded: {}",
+                       block.toHex(),
+                       header.error().message());
+        return;
+      }
+      last_block_ = block;
+      last_state_root_ = header.value().state_root;
+    }
+    auto values = readValues(keys, last_state_root_);
+    // the values are the base of the changes in the next block
+    last_values_.insert(values.begin(), values.end());
+
+    std::lock_guard lock{mutex_};
+    auto it = subscriptions_.find(id);
+    if (it == subscriptions_.end()) {
+      return;
+    }
+    auto alive = session.lock();
+    if (not alive) {
+      return;
+    }
+    alive->push(makeNotification(
+        kStorage, id, changesToJson(*last_block_, keys, values)));
+    // changes of the keys are pushed starting from the next block
+    it->second.keys = keys;
+    for (const auto &key : keys) {
+      ++watched_keys_[key];
+    }
+  }
+
+  void SubscriptionEngine::erase(const Subscription &subscription) {
+    for (const auto &key : subscription.keys) {
+      if (auto watched = watched_keys_.find(key);
+          watched != watched_keys_.end() and --watched->second == 0) {
+        watched_keys_.erase(watched);
+      }
+    }
+  }
+
+  std::string SubscriptionEngine::headerToJson(
+      const primitives::BlockHeader &header) {
+    std::string logs;
+    for (const auto &item : header.digest) {
+      if (not logs.empty()) {
+        logs += ',';
+      }
+      logs += toJsonHex(scale::encode(item).value());
+    }
+    return R"({"parentHash":)" + toJsonHex(header.parent_hash)
+           + R"(,"number":")" + fmt::format("0x{:x}", header.number)
+           + R"(","stateRoot":)" + toJsonHex(header.state_root)
+           + R"(,"extrinsicsRoot":)" + toJsonHex(header.extrinsics_root)
+           + R"(,"digest":{"logs":[)" + logs + "]}}";
+  }
+
+  SubscriptionEngine::Values SubscriptionEngine::readValues(
+      const std::vector<common::Buffer> &keys,
+      const common::Hash256 &state_root) const {
+    Values values;
+    if (keys.empty()) {
+      return values;
+    }
+    auto trie = trie_builder_->buildAt(state_root);
+    for (const auto &key : keys) {
+      // absent keys are reported as nulls
+      auto value = trie->get(key);
+      values.emplace(key,
+                     value ? boost::make_optional(std::move(value.value()))
+                           : boost::none);
+    }
+    return values;
+  }
+
+  std::string SubscriptionEngine::changesToJson(
+      const primitives::BlockHash &block,
+      const std::vector<common::Buffer> &keys,
+      const Values &values) {
+    std::string changes;
+    for (const auto &key : keys) {
+      if (not changes.empty()) {
+        changes += ',';
+      }
+      const auto &value = values.at(key);
+      changes += '[' + toJsonHex(key) + ','
+                 + (value ? toJsonHex(*value) : std::string("null")) + ']';
+    }
+    return R"({"block":)" + toJsonHex(block) + R"(,"changes":[)" + changes
+           + "]}";
+  }
+
+  void SubscriptionEngine::fanOut(
+      Kind kind,
+      std::string_view method,
+      const std::function<boost::optional<std::string>(const Subscription &)>
+          &result) {
+    std::lock_guard lock{mutex_};
+    for (auto it = subscriptions_.begin(); it != subscriptions_.end();) {
+      const auto &[id, subscription] = *it;
+      if (subscription.kind != kind) {
+        ++it;
+        continue;
+      }
+      auto session = subscription.session.lock();
+      if (not session) {
+        erase(subscription);
+        it = subscriptions_.erase(it);
+        continue;
+      }
+      if (auto message = result(subscription)) {
+        session->push(makeNotification(method, id, *message));
+      }
+      ++it;
+    }
+  }
+
+}  // namespace kagome::api
@@ -0,0 +1,162 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_API_SUBSCRIPTION_SUBSCRIPTION_ENGINE_HPP
+#define KAGOME_CORE_API_SUBSCRIPTION_SUBSCRIPTION_ENGINE_HPP
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/asio/thread_pool.hpp>
+#include <boost/optional.hpp>
+
+#include "api/state/readonly_trie_builder.hpp"
+#include "api/transport/session.hpp"
+#include "blockchain/block_header_repository.hpp"
+#include "blockchain/block_tree.hpp"
+#include "blockchain/block_tree_observer.hpp"
+#include "common/buffer.hpp"
+#include "common/logger.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Pushes events of the chain to the subscribed sessions: new heads,
+   * finalized heads and changes of the watched storage keys.
+   * Events are received from the block tree and processed on the own thread:
+   * the header of a block is loaded and encoded once, the watched keys are
+   * read once per block from the trie at its state root and compared with
+   * their values in its parent, then the results are fanned out to all
+   * subscribers. Changes of the storage are pushed only for the blocks,
+   * which become the best one when they are added. Subscriptions may be
+   * managed from any thread; the ones of closed sessions are dropped
+   */
+  class SubscriptionEngine
+      : public blockchain::BlockTreeObserver,
+        public std::enable_shared_from_this<SubscriptionEngine> {
+   public:
+    using SubscriptionId = uint32_t;
+
+    enum class Kind { NEW_HEADS, FINALIZED_HEADS, STORAGE };
+
+    SubscriptionEngine(
+        std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+        std::shared_ptr<blockchain::BlockTree> block_tree,
+        std::shared_ptr<ReadonlyTrieBuilder> trie_builder);
+
+    ~SubscriptionEngine() override;
+
+    void onBlockAdded(const primitives::BlockInfo &block) override;
+
+    void onBlockFinalized(const primitives::BlockInfo &block) override;
+
+    /**
+     * @return id for a new subscription; ids are unique among all kinds, so
+     * the id can be returned to the client before the subscription is made
+     */
+    SubscriptionId generateId();
+
+    /**
+     * Push headers of the blocks of \param kind to \param session
+     * @param id of the subscription, which is sent with each notification
+     */
+    void subscribeHeads(SubscriptionId id,
+                        Kind kind,
+                        const std::shared_ptr<Session> &session);
+
+    /**
+     * Push values of \param keys to \param session: the current ones at
+     * once, then the changed ones for each new best block
+     * @param id of the subscription, which is sent with each notification
+     */
+    void subscribeStorage(SubscriptionId id,
+                          const std::shared_ptr<Session> &session,
+                          std::vector<common::Buffer> keys);
+
+    /**
+     * Cancel subscription of \param kind with \param id made by \param
+     * session
+     * @return false if there is no such subscription
+     */
+    bool unsubscribe(SubscriptionId id,
+                     Kind kind,
+                     const std::shared_ptr<Session> &session);
+
+   private:
+    using Values =
+        std::unordered_map<common::Buffer, boost::optional<common::Buffer>>;
+
+    struct Subscription {
+      Kind kind;
+      std::weak_ptr<Session> session;
+      std::vector<common::Buffer> keys;
+    };
+
+    /// Handlers of the events, which are invoked on the own thread
+    void processNewBlock(const primitives::BlockInfo &block, bool is_best);
+    void processFinalizedBlock(const primitives::BlockInfo &block);
+    void pushCurrentValues(SubscriptionId id,
+                           std::weak_ptr<Session> session,
+                           const std::vector<common::Buffer> &keys);
+
+    /// Push changes of the watched keys in the new best block with
+    /// \param header compared with its parent
+    void processStorageChanges(const primitives::BlockInfo &block,
+                               const primitives::BlockHeader &header);
+
+    /// Forget \param subscription; must be invoked under the lock
+    void erase(const Subscription &subscription);
+
+    /// @return \param header in the JSON format
+    static std::string headerToJson(const primitives::BlockHeader &header);
+
+    /// @return values of \param keys in the trie at \param state_root
+    Values readValues(const std::vector<common::Buffer> &keys,
+                      const common::Hash256 &state_root) const;
+
+    /// @return changes of \param keys in the JSON format
+    static std::string changesToJson(const primitives::BlockHash &block,
+                                     const std::vector<common::Buffer> &keys,
+                                     const Values &values);
+
+    /// Send the result of \param method, which is built for each
+    /// subscription of \param kind, unless it is none; subscriptions of the
+    /// closed sessions are dropped
+    void fanOut(
+        Kind kind,
+        std::string_view method,
+        const std::function<boost::optional<std::string>(
+            const Subscription &)> &result);
+
+    std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
+    std::shared_ptr<blockchain::BlockTree> block_tree_;
+    std::shared_ptr<ReadonlyTrieBuilder> trie_builder_;
+    boost::asio::thread_pool thread_{1};
+
+    std::atomic<SubscriptionId> last_id_{0};
+
+    std::mutex mutex_;
+    /// keys of a storage subscription are set, once its current values are
+    /// pushed, so that no change is pushed before them
+    std::unordered_map<SubscriptionId, Subscription> subscriptions_;
+    /// number of storage subscriptions of each watched key
+    std::unordered_map<common::Buffer, size_t> watched_keys_;
+
+    /// the last processed best block, its state root and the values of the
+    /// watched keys at it, which are the base of the changes in its child;
+    /// accessed only on the own thread
+    boost::optional<primitives::BlockHash> last_block_;
+    common::Hash256 last_state_root_;
+    Values last_values_;
+
+    common::Logger logger_;
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_CORE_API_SUBSCRIPTION_SUBSCRIPTION_ENGINE_HPP
@@ -0,0 +1,121 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/subscription/subscription_jrpc_processor.hpp"
+
+#include "api/service/request_context.hpp"
+#include "common/hexutil.hpp"
+
+namespace kagome::api {
+
+  namespace {
+    using Kind = SubscriptionEngine::Kind;
+
+    /// @return context of the request, which may push notifications
+    RequestContext &getPushContext() {
+      auto context = RequestContext::current();
+      if (context == nullptr or not context->session()->isPushSupported()) {
+        throw jsonrpc::Fault("Subscriptions are not supported by transport");
+      }
+      return *context;
+    }
+
+    SubscriptionEngine::SubscriptionId parseId(
+        const jsonrpc::Request::Parameters &params) {
+      if (params.size() != 1) {
+        throw jsonrpc::InvalidParametersFault("Incorrect number of params");
+      }
+      auto &param0 = params[0];
+      if (not param0.IsInteger32() and not param0.IsInteger64()) {
+        throw jsonrpc::InvalidParametersFault(
+            "Parameter 'id' must be an integer");
+      }
+      return param0.AsInteger64();
+    }
+
+    std::vector<common::Buffer> parseKeys(
+        const jsonrpc::Request::Parameters &params) {
+      if (params.size() != 1 or not params[0].IsArray()) {
+        throw jsonrpc::InvalidParametersFault(
+            "Parameter 'keys' must be an array of hex strings");
+      }
+      std::vector<common::Buffer> keys;
+      for (auto &param : params[0].AsArray()) {
+        if (not param.IsString()) {
+          throw jsonrpc::InvalidParametersFault(
+              "Parameter 'keys' must be an array of hex strings");
+        }
+        auto key = common::unhexWith0x(param.AsString());
+        if (not key) {
+          throw jsonrpc::Fault(key.error().message());
+        }
+        keys.emplace_back(std::move(key.value()));
+      }
+      return keys;
+    }
+  }  // namespace
+
+  SubscriptionJrpcProcessor::SubscriptionJrpcProcessor(
+      std::shared_ptr<JRpcServer> server,
+      std::shared_ptr<SubscriptionEngine> engine)
+      : server_{std::move(server)}, engine_{std::move(engine)} {
+    BOOST_ASSERT(server_ != nullptr);
+    BOOST_ASSERT(engine_ != nullptr);
+  }
+
+  void SubscriptionJrpcProcessor::registerHandlers() {
+    for (auto &&[name, kind] :
+         {std::make_pair("chain_subscribeNewHeads", Kind::NEW_HEADS),
+          std::make_pair("chain_subscribeFinalizedHeads",
+                         Kind::FINALIZED_HEADS)}) {
+      server_->registerHandler(
+          name,
+          [this, kind = kind](const jsonrpc::Request::Parameters &params)
+              -> jsonrpc::Value {
+            // method has no params
+            auto &context = getPushContext();
+            auto id = engine_->generateId();
+            context.afterResponse(
+                [engine = engine_, id, kind, session = context.session()] {
+                  engine->subscribeHeads(id, kind, session);
+                });
+            return static_cast<int64_t>(id);
+          });
+    }
+
+    server_->registerHandler(
+        "state_subscribeStorage",
+        [this](const jsonrpc::Request::Parameters &params) -> jsonrpc::Value {
+          auto keys = parseKeys(params);
+          auto &context = getPushContext();
+          auto id = engine_->generateId();
+          context.afterResponse([engine = engine_,
+                                 id,
+                                 session = context.session(),
+                                 keys = std::move(keys)]() mutable {
+            engine->subscribeStorage(id, session, std::move(keys));
+          });
+          return static_cast<int64_t>(id);
+        });
+
+    registerUnsubscribe("chain_unsubscribeNewHeads", Kind::NEW_HEADS);
+    registerUnsubscribe("chain_unsubscribeFinalizedHeads",
+                        Kind::FINALIZED_HEADS);
+    registerUnsubscribe("state_unsubscribeStorage", Kind::STORAGE);
+  }
+
+  void SubscriptionJrpcProcessor::registerUnsubscribe(const std::string &name,
+                                                      Kind kind) {
+    server_->registerHandler(
+        name,
+        [this, kind](const jsonrpc::Request::Parameters &params)
+            -> jsonrpc::Value {
+          auto id = parseId(params);
+          auto &context = getPushContext();
+          return engine_->unsubscribe(id, kind, context.session());
+        });
+  }
+
+}  // namespace kagome::api
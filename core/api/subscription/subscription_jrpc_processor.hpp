@@ -0,0 +1,43 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_API_SUBSCRIPTION_SUBSCRIPTION_JRPC_PROCESSOR_HPP
+#define KAGOME_CORE_API_SUBSCRIPTION_SUBSCRIPTION_JRPC_PROCESSOR_HPP
+
+#include <boost/noncopyable.hpp>
+
+#include "api/jrpc/jrpc_processor.hpp"
+#include "api/jrpc/jrpc_server.hpp"
+#include "api/subscription/subscription_engine.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Handles subscribe and unsubscribe requests of the new heads, finalized
+   * heads and storage. Subscriptions are made only for the sessions, which
+   * support push, and start after the response with their id is sent
+   */
+  class SubscriptionJrpcProcessor : public JRpcProcessor,
+                                    private boost::noncopyable {
+   public:
+    SubscriptionJrpcProcessor(std::shared_ptr<JRpcServer> server,
+                              std::shared_ptr<SubscriptionEngine> engine);
+    ~SubscriptionJrpcProcessor() override = default;
+
+    void registerHandlers() override;
+
+   private:
+    /// Register unsubscribe method \param name of subscriptions of \param
+    /// kind
+    void registerUnsubscribe(const std::string &name,
+                             SubscriptionEngine::Kind kind);
+
+    std::shared_ptr<JRpcServer> server_;
+    std::shared_ptr<SubscriptionEngine> engine_;
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_CORE_API_SUBSCRIPTION_SUBSCRIPTION_JRPC_PROCESSOR_HPP
@@ -0,0 +1,42 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/transport/impl/connection_limiter.hpp"
+
+#include <algorithm>
+
+namespace kagome::api {
+
+  ConnectionLimiter::ConnectionLimiter(Limits limits) : limits_{limits} {}
+
+  bool ConnectionLimiter::canAccept(const boost::asio::ip::address &address) {
+    dropClosed();
+    if (connections_.size() >= limits_.max_connections) {
+      return false;
+    }
+    auto from_address = std::count_if(
+        connections_.begin(), connections_.end(), [&](const auto &connection) {
+          return connection.first == address;
+        });
+    return static_cast<size_t>(from_address)
+           < limits_.max_connections_per_address;
+  }
+
+  void ConnectionLimiter::add(const boost::asio::ip::address &address,
+                              const std::shared_ptr<Session> &session) {
+    connections_.emplace_back(address, session);
+  }
+
+  void ConnectionLimiter::dropClosed() {
+    connections_.erase(
+        std::remove_if(connections_.begin(),
+                       connections_.end(),
+                       [](const auto &connection) {
+                         return connection.second.expired();
+                       }),
+        connections_.end());
+  }
+
+}  // namespace kagome::api
@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_API_TRANSPORT_IMPL_CONNECTION_LIMITER_HPP
+#define KAGOME_CORE_API_TRANSPORT_IMPL_CONNECTION_LIMITER_HPP
+
+#include <memory>
+#include <vector>
+
+#include <boost/asio/ip/address.hpp>
+
+#include "api/transport/session.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Limits connections of a listener: in total and from each remote
+   * address. A connection is counted while its session exists. Used only by
+   * the accepting handler of the listener, so it is not synchronized
+   */
+  class ConnectionLimiter {
+   public:
+    struct Limits {
+      static constexpr size_t kDefaultMaxConnections = 256u;
+      static constexpr size_t kDefaultMaxConnectionsPerAddress = 32u;
+
+      /// number of connections of the listener
+      size_t max_connections{kDefaultMaxConnections};
+
+      /// number of connections from one remote address
+      size_t max_connections_per_address{kDefaultMaxConnectionsPerAddress};
+    };
+
+    explicit ConnectionLimiter(Limits limits);
+
+    /**
+     * @return true if one more connection from \param address is within the
+     * limits
+     */
+    bool canAccept(const boost::asio::ip::address &address);
+
+    /**
+     * Count connection from \param address, which is served by \param
+     * session, until the session is destroyed
+     */
+    void add(const boost::asio::ip::address &address,
+             const std::shared_ptr<Session> &session);
+
+   private:
+    /// Forget the connections, which sessions are destroyed
+    void dropClosed();
+
+    Limits limits_;
+    std::vector<std::pair<boost::asio::ip::address, std::weak_ptr<Session>>>
+        connections_;
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_CORE_API_TRANSPORT_IMPL_CONNECTION_LIMITER_HPP
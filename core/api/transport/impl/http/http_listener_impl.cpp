@@ -15,39 +15,60 @@ namespace kagome::api {
                                      SessionImpl::Configuration session_config)
       : context_(context),
         acceptor_(context_, configuration.endpoint),
-        session_config_{session_config} {}
+        session_config_{session_config},
+        connections_{configuration.limits} {}
 
   void HttpListenerImpl::acceptOnce(
       Listener::NewSessionHandler on_new_session) {
-    acceptor_.async_accept([self = shared_from_this(), on_new_session](
-                               boost::system::error_code ec,
-                               SessionImpl::Socket socket) mutable {
-      if (ec) {
-        self->logger_->error("error: failed to start listening, code: {}",
-                             ApiTransportError::FAILED_START_LISTENING);
-        self->stop();
-        return;
-      }
+    // each session gets its own strand, so its handlers are serialized even
+    // if the context is run by several threads
+    acceptor_.async_accept(
+        boost::asio::make_strand(context_),
+        [self = shared_from_this(), on_new_session](
+            boost::system::error_code ec, SessionImpl::Socket socket) mutable {
+          if (ec) {
+            self->logger_->error("error: failed to start listening, code: {}",
+                                 ApiTransportError::FAILED_START_LISTENING);
+            self->stop();
+            return;
+          }
 
-      if (self->state_ != State::WORKING) {
-        self->logger_->error(
-            "error: cannot accept session, listener is in wrong state, code: "
-            "{}",
-            ApiTransportError::CANNOT_ACCEPT_LISTENER_NOT_WORKING);
+          if (self->state_ != State::WORKING) {
+            self->logger_->error(
+                "error: cannot accept session, listener is in wrong state, "
+                "code: {}",
+                ApiTransportError::CANNOT_ACCEPT_LISTENER_NOT_WORKING);
 
-        self->stop();
-        return;
-      }
+            self->stop();
+            return;
+          }
 
-      auto session = std::make_shared<SessionImpl>(std::move(socket),
-                                                   self->session_config_);
+          boost::system::error_code remote_ec;
+          auto remote = socket.remote_endpoint(remote_ec);
+          if (remote_ec) {
+            // client has already disconnected
+            self->acceptOnce(std::move(on_new_session));
+            return;
+          }
+          if (not self->connections_.canAccept(remote.address())) {
+            // the socket is closed, when it is destroyed
+            self->logger_->warn(
+                "Connection from {} is rejected: too many connections",
+                remote.address().to_string());
+            self->acceptOnce(std::move(on_new_session));
+            return;
+          }
 
-      on_new_session(session);
-      session->start();
+          auto session = std::make_shared<SessionImpl>(std::move(socket),
+                                                       self->session_config_);
+          self->connections_.add(remote.address(), session);
 
-      // stay ready for new connection
-      self->acceptOnce(std::move(on_new_session));
-    });
+          on_new_session(session);
+          session->start();
+
+          // stay ready for new connection
+          self->acceptOnce(std::move(on_new_session));
+        });
   }
 
   void HttpListenerImpl::start(Listener::NewSessionHandler on_new_session) {
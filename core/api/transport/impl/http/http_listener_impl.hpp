@@ -8,6 +8,7 @@
 
 #include "api/transport/listener.hpp"
 
+#include "api/transport/impl/connection_limiter.hpp"
 #include "api/transport/impl/http/http_session.hpp"
 #include "common/logger.hpp"
 
@@ -34,6 +35,8 @@ namespace kagome::api {
      */
     struct Configuration {
       Endpoint endpoint{};  ///< listener endpoint
+      /// connections over the limits are closed right after they are accepted
+      ConnectionLimiter::Limits limits{};
     };
 
     /**
@@ -68,6 +71,7 @@ namespace kagome::api {
     Acceptor acceptor_;                          ///< connections acceptor
     State state_{State::READY};                  ///< working state
     SessionImpl::Configuration session_config_;  /// http session configuration
+    ConnectionLimiter connections_;  ///< connections of the listener
     Logger logger_ = common::createLogger("api listener");  ///< logger instance
   };
 }  // namespace kagome::api
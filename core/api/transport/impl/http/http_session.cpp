@@ -5,16 +5,21 @@
 
 #include "api/transport/impl/http/http_session.hpp"
 
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/config.hpp>
 #include <outcome/outcome.hpp>
 
 namespace kagome::api {
 
   HttpSession::HttpSession(Socket socket, Configuration config)
-      : config_{config}, stream_(std::move(socket)) {}
+      : config_{config},
+        stream_(std::move(socket)),
+        request_rate_{config.max_request_rate, config.max_request_burst} {}
 
   void HttpSession::start() {
-    asyncRead();
+    boost::asio::dispatch(stream_.get_executor(),
+                          [self = shared_from_this()] { self->asyncRead(); });
   }
 
   void HttpSession::stop() {
@@ -23,10 +28,11 @@ namespace kagome::api {
     boost::ignore_unused(ec);
   }
 
-  auto HttpSession::makeBadResponse(std::string_view message,
-                                    unsigned version,
-                                    bool keep_alive) {
-    Response<StringBody> res{boost::beast::http::status::bad_request, version};
+  auto HttpSession::makeErrorResponse(boost::beast::http::status status,
+                                      std::string_view message,
+                                      unsigned version,
+                                      bool keep_alive) {
+    Response<StringBody> res{status, version};
     res.set(boost::beast::http::field::server, kServerName);
     res.set(boost::beast::http::field::content_type, "text/html");
     res.keep_alive(keep_alive);
@@ -39,8 +45,20 @@ namespace kagome::api {
   void HttpSession::handleRequest(boost::beast::http::request<Body> &&req) {
     // allow only POST method
     if (req.method() != boost::beast::http::verb::post) {
-      return asyncWrite(makeBadResponse(
-          "Unsupported HTTP-method", req.version(), req.keep_alive()));
+      return asyncWrite(
+          makeErrorResponse(boost::beast::http::status::bad_request,
+                            "Unsupported HTTP-method",
+                            req.version(),
+                            req.keep_alive()));
+    }
+
+    // requests over the rate are rejected before they are parsed
+    if (not request_rate_.tryTake()) {
+      return asyncWrite(
+          makeErrorResponse(boost::beast::http::status::too_many_requests,
+                            "Too many requests",
+                            req.version(),
+                            req.keep_alive()));
     }
 
     processRequest(req.body(), shared_from_this());
@@ -76,21 +94,25 @@ namespace kagome::api {
         });
   }
 
-  void HttpSession::respond(std::string_view response) {
-    StringBody::value_type body;
-    body.assign(response);
+  void HttpSession::respond(std::string response) {
+    StringBody::value_type body = std::move(response);
 
-    const auto size = body.size();
+    // stream is used only on its own executor
+    boost::asio::post(
+        stream_.get_executor(),
+        [self = shared_from_this(), body = std::move(body)]() mutable {
+          const auto size = body.size();
 
-    // send response
-    Response<StringBody> res(std::piecewise_construct,
-                             std::make_tuple(std::move(body)));
-    res.set(HttpField::server, kServerName);
-    res.set(HttpField::content_type, "text/html");
-    res.content_length(size);
-    res.keep_alive(true);
+          // send response
+          Response<StringBody> res(std::piecewise_construct,
+                                   std::make_tuple(std::move(body)));
+          res.set(HttpField::server, kServerName);
+          res.set(HttpField::content_type, "text/html");
+          res.content_length(size);
+          res.keep_alive(true);
 
-    return asyncWrite(std::move(res));
+          self->asyncWrite(std::move(res));
+        });
   }
 
   void HttpSession::onRead(boost::system::error_code ec, std::size_t) {
@@ -99,7 +121,7 @@ namespace kagome::api {
         reportError(ec, "unknown error occurred");
       }
 
-      stop();
+      return stop();
     }
 
     handleRequest(parser_->release());
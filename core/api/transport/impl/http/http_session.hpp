@@ -11,6 +11,7 @@
 #include <memory>
 
 #include <boost/beast.hpp>
+#include "api/transport/impl/token_bucket.hpp"
 #include "api/transport/session.hpp"
 #include "common/logger.hpp"
 
@@ -42,9 +43,18 @@ namespace kagome::api {
     struct Configuration {
       static constexpr size_t kDefaultRequestSize = 10000u;
       static constexpr Duration kDefaultTimeout = std::chrono::seconds(30);
+      static constexpr double kDefaultRequestRate = 100.;
+      static constexpr size_t kDefaultRequestBurst = 200u;
 
       size_t max_request_size{kDefaultRequestSize};
       Duration operation_timeout{kDefaultTimeout};
+
+      /// requests per second on average, over which requests are answered
+      /// with 429 before they are parsed; 0 disables the limit
+      double max_request_rate{kDefaultRequestRate};
+
+      /// number of requests, which may come at once over the rate
+      size_t max_request_burst{kDefaultRequestBurst};
     };
 
     ~HttpSession() override = default;
@@ -65,7 +75,7 @@ namespace kagome::api {
      * @brief sends response wrapped by http message
      * @param response message to send
      */
-    void respond(std::string_view response) override;
+    void respond(std::string response) override;
 
    private:
     /**
@@ -105,16 +115,18 @@ namespace kagome::api {
     void onWrite(boost::system::error_code ec, std::size_t, bool close);
 
     /**
-     * @brief composes `bad request` message
+     * @brief composes error message
+     * @param status of the response
      * @param message text to send
      * @param version protocol version
      * @param keep_alive true if server should keep connection alive, false
      * otherwise
      * @return composed request
      */
-    auto makeBadResponse(std::string_view message,
-                         unsigned version,
-                         bool keep_alive);
+    auto makeErrorResponse(boost::beast::http::status status,
+                           std::string_view message,
+                           unsigned version,
+                           bool keep_alive);
 
     /**
      * @brief reports error code and message
@@ -128,6 +140,7 @@ namespace kagome::api {
     Configuration config_;              ///< session configuration
     boost::beast::tcp_stream stream_;   ///< stream
     boost::beast::flat_buffer buffer_;  ///< read buffer
+    TokenBucket request_rate_;          ///< rate limit of the requests
 
     /**
      * @brief request parser type
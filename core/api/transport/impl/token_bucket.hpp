@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_API_TRANSPORT_IMPL_TOKEN_BUCKET_HPP
+#define KAGOME_CORE_API_TRANSPORT_IMPL_TOKEN_BUCKET_HPP
+
+#include <algorithm>
+#include <chrono>
+
+namespace kagome::api {
+
+  /**
+   * Limits the rate of events: the bucket holds up to burst tokens and is
+   * refilled with rate tokens per second, each event takes a token. Thus
+   * bursts of up to burst events pass, while the average rate is limited
+   */
+  class TokenBucket {
+   public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param rate tokens per second, 0 disables the limit
+     * @param burst capacity of the bucket, which is full at first
+     */
+    TokenBucket(double rate, size_t burst, Clock::time_point now = Clock::now())
+        : rate_{rate},
+          burst_{static_cast<double>(burst)},
+          tokens_{burst_},
+          last_refill_{now} {}
+
+    /**
+     * @return true if a token is taken, false if the rate is exceeded
+     */
+    bool tryTake(Clock::time_point now = Clock::now()) {
+      if (rate_ == 0) {
+        return true;
+      }
+      std::chrono::duration<double> elapsed = now - last_refill_;
+      tokens_ = std::min(burst_, tokens_ + elapsed.count() * rate_);
+      last_refill_ = now;
+      if (tokens_ < 1) {
+        return false;
+      }
+      tokens_ -= 1;
+      return true;
+    }
+
+   private:
+    double rate_;
+    double burst_;
+    double tokens_;
+    Clock::time_point last_refill_;
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_CORE_API_TRANSPORT_IMPL_TOKEN_BUCKET_HPP
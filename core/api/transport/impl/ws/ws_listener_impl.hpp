@@ -8,6 +8,7 @@
 
 #include "api/transport/listener.hpp"
 
+#include "api/transport/impl/connection_limiter.hpp"
 #include "api/transport/impl/ws/ws_session.hpp"
 #include "common/logger.hpp"
 
@@ -33,6 +34,8 @@ namespace kagome::api {
      */
     struct Configuration {
       Endpoint endpoint{};  ///< listener endpoint
+      /// connections over the limits are closed right after they are accepted
+      ConnectionLimiter::Limits limits{};
     };
 
     /**
@@ -67,6 +70,7 @@ namespace kagome::api {
     Acceptor acceptor_;                   ///< connections acceptor
     State state_{State::READY};           ///< working state
 	  SessionImpl::Configuration session_config_;  ///< websocket session configuration
+    ConnectionLimiter connections_;  ///< connections of the listener
     Logger logger_ = common::createLogger("api listener");  ///< logger instance
   };
 
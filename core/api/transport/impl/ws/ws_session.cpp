@@ -8,13 +8,16 @@
 #include <cstring>
 
 #include <boost/asio/dispatch.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/config.hpp>
 #include "outcome/outcome.hpp"
 
 namespace kagome::api {
 
   WsSession::WsSession(Socket socket, Configuration config)
-      : config_{config}, ws_(std::move(socket)) {}
+      : config_{config},
+        ws_(std::move(socket)),
+        request_rate_{config.max_request_rate, config.max_request_burst} {}
 
   void WsSession::start() {
     boost::asio::dispatch(ws_.get_executor(),
@@ -22,10 +25,25 @@ namespace kagome::api {
                                                            shared_from_this()));
   }
 
-  void WsSession::stop() {
-    boost::system::error_code ec;
-    ws_.close(boost::beast::websocket::close_reason(), ec);
-    boost::ignore_unused(ec);
+  void WsSession::stop(boost::beast::websocket::close_reason reason) {
+    if (stopped_) {
+      return;
+    }
+    stopped_ = true;
+    if (writing_ or not ws_.is_open()) {
+      // the close frame would wait for the write in progress, which is not
+      // completed while the client does not read
+      return closeSocket();
+    }
+    ws_.async_close(reason,
+                    [self = shared_from_this()](boost::system::error_code) {
+                      self->closeSocket();
+                    });
+  }
+
+  void WsSession::closeSocket() {
+    // pending operations are completed with operation_aborted
+    boost::beast::get_lowest_layer(ws_).close();
   }
 
   void WsSession::handleRequest(std::string_view data) {
@@ -33,31 +51,68 @@ namespace kagome::api {
   }
 
   void WsSession::asyncRead() {
+    reading_ = true;
     ws_.async_read(rbuffer_,
                    boost::beast::bind_front_handler(&WsSession::onRead,
                                                     shared_from_this()));
   }
 
+  void WsSession::asyncReadIfAllowed() {
+    if (reading_ or stopped_ or in_flight_ >= config_.max_in_flight) {
+      return;
+    }
+    asyncRead();
+  }
+
   void WsSession::asyncWrite() {
-    ws_.async_write(wbuffer_.data(),
+    writing_ = true;
+    ws_.text(true);
+    ws_.async_write(boost::asio::buffer(outgoing_.front().message),
                     boost::beast::bind_front_handler(&WsSession::onWrite,
                                                      shared_from_this()));
   }
 
-  void WsSession::respond(std::string_view response) {
-    auto x = wbuffer_.prepare(response.size());
-    std::copy(response.data(),
-              response.data() + response.size(),
-              reinterpret_cast<char *>(x.data()));  // NOLINT
-    wbuffer_.commit(response.size());
-    ws_.text(true);
-    asyncWrite();
+  void WsSession::respond(std::string response) {
+    enqueue(std::move(response), true);
+  }
+
+  void WsSession::push(std::string message) {
+    enqueue(std::move(message), false);
+  }
+
+  void WsSession::enqueue(std::string message, bool is_response) {
+    // stream and queue are used only on the executor of the stream
+    boost::asio::post(ws_.get_executor(),
+                      [self = shared_from_this(),
+                       message = std::move(message),
+                       is_response]() mutable {
+                        if (self->stopped_) {
+                          return;
+                        }
+                        self->outgoing_size_ += message.size();
+                        if (self->outgoing_size_
+                            > self->config_.max_outgoing_size) {
+                          self->logger_->warn(
+                              "{} bytes are not read by client, closing",
+                              self->outgoing_size_);
+                          return self->stop();
+                        }
+                        self->outgoing_.push_back(
+                            {std::move(message), is_response});
+                        if (not self->writing_) {
+                          self->asyncWrite();
+                        }
+                      });
   }
 
   void WsSession::onRun() {
     // Set suggested timeout settings for the websocket
-    ws_.set_option(boost::beast::websocket::stream_base::timeout::suggested(
-        boost::beast::role_type::server));
+    auto timeout = boost::beast::websocket::stream_base::timeout::suggested(
+        boost::beast::role_type::server);
+    // limits the closing handshake too, so a client, which does not answer
+    // the close frame, is disconnected
+    timeout.handshake_timeout = config_.operation_timeout;
+    ws_.set_option(timeout);
 
     // Set a decorator to change the Server of the handshake
     ws_.set_option(boost::beast::websocket::stream_base::decorator(
@@ -85,6 +140,7 @@ namespace kagome::api {
 
   void WsSession::onRead(boost::system::error_code ec,
                          std::size_t bytes_transferred) {
+    reading_ = false;
     if (ec) {
       auto error_message = (ec == WsError::closed) ? "connection was closed"
                                                    : "unknown error occurred";
@@ -93,10 +149,17 @@ namespace kagome::api {
       return;
     }
 
+    if (not request_rate_.tryTake()) {
+      logger_->warn("Request rate of the client is exceeded, closing");
+      return stop(boost::beast::websocket::close_code::try_again_later);
+    }
+
+    ++in_flight_;
     handleRequest(
         {static_cast<char *>(rbuffer_.data().data()), bytes_transferred});
 
     rbuffer_.consume(bytes_transferred);
+    asyncReadIfAllowed();
   }
 
   void WsSession::onWrite(boost::system::error_code ec,
@@ -106,9 +169,23 @@ namespace kagome::api {
       return stop();
     }
 
-    wbuffer_.consume(bytes_transferred);
-
-	  asyncRead();
+    if (stopped_) {
+      outgoing_.clear();
+      return;
+    }
+    auto was_response = outgoing_.front().is_response;
+    outgoing_size_ -= outgoing_.front().message.size();
+    outgoing_.pop_front();
+    // reading, which was paused by the in-flight limit, is resumed
+    if (was_response) {
+      --in_flight_;
+      asyncReadIfAllowed();
+    }
+    if (outgoing_.empty()) {
+      writing_ = false;
+    } else {
+      asyncWrite();
+    }
   }
 
   void WsSession::reportError(boost::system::error_code ec,
@@ -8,16 +8,25 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <deque>
 #include <memory>
 
 #include <boost/beast/core/tcp_stream.hpp>
 #include <boost/beast/websocket.hpp>
 
+#include "api/transport/impl/token_bucket.hpp"
 #include "api/transport/session.hpp"
 #include "common/logger.hpp"
 
 namespace kagome::api {
 
+  /**
+   * Websocket session. Requests are pipelined: the next request is read
+   * while the previous ones are processed, up to the in-flight limit of the
+   * session; reading is resumed when a response is written. Responses are
+   * written in the order of completion and are correlated with the requests
+   * by their ids
+   */
   class WsSession : public Session,
                     public std::enable_shared_from_this<WsSession> {
     using WsError = boost::beast::websocket::error;
@@ -29,9 +38,30 @@ namespace kagome::api {
     struct Configuration {
       static constexpr size_t kDefaultRequestSize = 10000u;
       static constexpr Duration kDefaultTimeout = std::chrono::seconds(30);
+      static constexpr size_t kDefaultMaxInFlight = 16u;
+      static constexpr size_t kDefaultMaxOutgoingSize = 16u << 20u;
+      static constexpr double kDefaultRequestRate = 100.;
+      static constexpr size_t kDefaultRequestBurst = 200u;
 
       size_t max_request_size{kDefaultRequestSize};
+
+      /// time limit of the opening and closing handshakes
       Duration operation_timeout{kDefaultTimeout};
+
+      /// number of requests, which are processed at once; the next request
+      /// is not read until one of them is responded
+      size_t max_in_flight{kDefaultMaxInFlight};
+
+      /// size of the queued outgoing messages in bytes, over which the
+      /// client is considered to not read them and the session is closed
+      size_t max_outgoing_size{kDefaultMaxOutgoingSize};
+
+      /// requests per second on average, over which the session is closed
+      /// before the request is parsed; 0 disables the limit
+      double max_request_rate{kDefaultRequestRate};
+
+      /// number of requests, which may come at once over the rate
+      size_t max_request_burst{kDefaultRequestBurst};
     };
 
     ~WsSession() override = default;
@@ -52,13 +82,30 @@ namespace kagome::api {
      * @brief sends response wrapped by websocket frame
      * @param response message to send
      */
-    void respond(std::string_view response) override;
+    void respond(std::string response) override;
+
+    bool isPushSupported() const override {
+      return true;
+    }
+
+    /**
+     * @brief sends notification wrapped by websocket frame
+     * @param message message to send
+     */
+    void push(std::string message) override;
 
    private:
     /**
-     * @brief stops session
+     * @brief stops session once: sends close frame with \param reason and
+     * waits for the one of the client up to the operation timeout; if a
+     * write is in progress, the socket is closed at once instead
      */
-    void stop();
+    void stop(boost::beast::websocket::close_reason reason = {});
+
+    /**
+     * @brief closes the socket without the closing handshake
+     */
+    void closeSocket();
 
     /**
      * @brief process received websocket frame, compose and execute response
@@ -73,7 +120,21 @@ namespace kagome::api {
     void asyncRead();
 
     /**
-     * @brief asynchronously write
+     * @brief asynchronously read, unless a read is in progress or the
+     * in-flight limit is reached
+     */
+    void asyncReadIfAllowed();
+
+    /**
+     * @brief queue message to be written on the executor of the stream
+     * @param message message to send
+     * @param is_response true if the message completes one of the requests
+     * in flight
+     */
+    void enqueue(std::string message, bool is_response);
+
+    /**
+     * @brief asynchronously write the first queued message
      */
     void asyncWrite();
 
@@ -109,7 +170,21 @@ namespace kagome::api {
     Configuration config_;  ///< session configuration
     boost::beast::websocket::stream<boost::beast::tcp_stream> ws_;  ///< stream
     boost::beast::flat_buffer rbuffer_;  ///< read buffer
-    boost::beast::flat_buffer wbuffer_;  ///< write buffer
+    TokenBucket request_rate_;           ///< rate limit of the requests
+
+    struct Outgoing {
+      std::string message;
+      bool is_response;
+    };
+
+    /// messages to be written in order; responses and notifications may be
+    /// queued from different threads, so only one write is in progress
+    std::deque<Outgoing> outgoing_;
+    size_t outgoing_size_{0};  ///< total size of the queued messages
+    size_t in_flight_{0};      ///< requests read, but not responded yet
+    bool reading_{false};  ///< a read of the next request is started
+    bool writing_{false};  ///< a write of the first queued message is started
+    bool stopped_{false};  ///< session is closed, nothing is written anymore
 
     Logger logger_ =
         common::createLogger("websocket session");  ///< logger instance
@@ -0,0 +1,27 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_API_TRANSPORT_RPC_IO_CONTEXT_HPP
+#define KAGOME_CORE_API_TRANSPORT_RPC_IO_CONTEXT_HPP
+
+#include <boost/asio/io_context.hpp>
+
+namespace kagome::api {
+
+  /**
+   * io_context of the RPC transport: listeners accept connections and
+   * sessions read and write messages on it. It is run by its own threads,
+   * so a long handler of the main io_context does not stall the transport.
+   * Every session works on its own strand of the context, thus handlers of a
+   * single session never run concurrently
+   */
+  class RpcContext : public boost::asio::io_context {
+   public:
+    RpcContext() = default;
+  };
+
+}  // namespace kagome::api
+
+#endif  // KAGOME_CORE_API_TRANSPORT_RPC_IO_CONTEXT_HPP
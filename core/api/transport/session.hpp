@@ -59,10 +59,26 @@ namespace kagome::api {
     }
 
     /**
-     * @brief send response message
-     * @param message response message
+     * @brief send response message, may be invoked from any thread
+     * @param message response message, which is moved to the outgoing
+     * buffer of the session
      */
-    virtual void respond(std::string_view message) = 0;
+    virtual void respond(std::string message) = 0;
+
+    /**
+     * @return true if the session can send messages, which are not responses
+     * to requests, e.g. notifications of subscriptions
+     */
+    virtual bool isPushSupported() const {
+      return false;
+    }
+
+    /**
+     * @brief send message, which is not a response to a request, may be
+     * invoked from any thread; ignored if push is not supported
+     * @param message message to send
+     */
+    virtual void push(std::string message) {}
 
    private:
     std::function<OnRequestSignature> on_request_;  ///< `on request` callback
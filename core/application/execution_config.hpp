@@ -0,0 +1,92 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_APPLICATION_EXECUTION_CONFIG_HPP
+#define KAGOME_CORE_APPLICATION_EXECUTION_CONFIG_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+
+#include "api/service/rpc_executor.hpp"
+
+namespace kagome::application {
+
+  /**
+   * Threads the node runs on.
+   *
+   * Networking, consensus, block import, runtime calls and the storage are
+   * owned by the main io_context thread: neither libp2p nor block tree,
+   * transaction pool and trie storage are synchronized, so all of them are
+   * accessed only from handlers of that thread; the only exception is reading
+   * the trie at the state root of a block, as it never changes. Work, which
+   * does not need the thread, is moved to the dedicated threads:
+   *  - transport of the RPC listeners and sessions runs on the RPC threads,
+   *  responses are sent back on the strand of their session;
+   *  - RPC requests, which only read snapshots of the state, are executed on
+   *  the RPC workers, other requests are executed on the main thread one by
+   *  one;
+   *  - seal and VRF of the imported headers are verified on the import
+   *  workers, while the main thread executes the previous blocks;
+   *  - signatures of GRANDPA votes are verified on the vote workers;
+   *  - notifications of the RPC subscriptions are built on the single thread
+   *  of the subscription engine, which reads snapshots of the state.
+   * All of them are bounded by max_threads (\see resolved())
+   */
+  struct ExecutionConfig {
+    static constexpr size_t kDefaultRpcThreads = 1;
+    static constexpr size_t kDefaultRpcWorkers =
+        api::RpcExecutor::Params::kDefaultWorkers;
+    /// the main io_context thread and the thread of the subscription engine
+    static constexpr size_t kFixedThreads = 2;
+
+    /// total number of threads of the node; 0 means the number of cores
+    size_t max_threads{0};
+
+    /// number of threads, which run the RPC transport
+    size_t rpc_threads{kDefaultRpcThreads};
+
+    /// number of threads, which execute RPC requests reading the state
+    size_t rpc_workers{kDefaultRpcWorkers};
+
+    /// number of threads, which verify headers of the imported blocks;
+    /// 0 means a share of the threads left by max_threads
+    size_t import_workers{0};
+
+    /// number of threads, which verify signatures of GRANDPA votes;
+    /// 0 means a share of the threads left by max_threads
+    size_t vote_workers{0};
+
+    /**
+     * @return config, in which the import and vote workers left 0 take the
+     * threads, which remain of max_threads after the fixed, RPC and
+     * explicitly configured ones: a third of them verifies votes, the rest
+     * verifies headers, at least one thread each
+     */
+    ExecutionConfig resolved() const {
+      auto config = *this;
+      if (config.max_threads == 0) {
+        config.max_threads =
+            std::max(1u, std::thread::hardware_concurrency());
+      }
+      const auto taken = kFixedThreads + rpc_threads + rpc_workers
+                         + import_workers + vote_workers;
+      const auto left =
+          config.max_threads > taken ? config.max_threads - taken : 0;
+      if (import_workers == 0 and vote_workers == 0) {
+        config.vote_workers = std::max<size_t>(1, left / 3);
+        config.import_workers = std::max<size_t>(1, left - left / 3);
+      } else if (import_workers == 0) {
+        config.import_workers = std::max<size_t>(1, left);
+      } else if (vote_workers == 0) {
+        config.vote_workers = std::max<size_t>(1, left);
+      }
+      return config;
+    }
+  };
+
+}  // namespace kagome::application
+
+#endif  // KAGOME_CORE_APPLICATION_EXECUTION_CONFIG_HPP
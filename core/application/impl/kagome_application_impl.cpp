@@ -5,26 +5,32 @@
 
 #include "application/impl/kagome_application_impl.hpp"
 
+#include <thread>
+
 namespace kagome::application {
   using consensus::Epoch;
   using std::chrono_literals::operator""ms;
   using consensus::Randomness;
   using consensus::Threshold;
 
-  KagomeApplicationImpl::KagomeApplicationImpl(const std::string &config_path,
-                                               const std::string &keystore_path,
-                                               const std::string &leveldb_path,
-                                               uint16_t p2p_port,
-                                               uint16_t rpc_http_port,
-                                               uint16_t rpc_ws_port,
-                                               bool is_genesis_epoch,
-                                               uint8_t verbosity)
+  KagomeApplicationImpl::KagomeApplicationImpl(
+      const std::string &config_path,
+      const std::string &keystore_path,
+      const std::string &leveldb_path,
+      uint16_t p2p_port,
+      uint16_t rpc_http_port,
+      uint16_t rpc_ws_port,
+      const ExecutionConfig &execution_config,
+      bool is_genesis_epoch,
+      uint8_t verbosity)
       : injector_{injector::makeFullNodeInjector(config_path,
                                                  keystore_path,
                                                  leveldb_path,
                                                  p2p_port,
                                                  rpc_http_port,
-                                                 rpc_ws_port)},
+                                                 rpc_ws_port,
+                                                 execution_config)},
+        execution_config_{execution_config},
         is_genesis_epoch_{is_genesis_epoch},
         logger_(common::createLogger("Application")) {
     spdlog::set_level(static_cast<spdlog::level::level_enum>(verbosity));
@@ -32,6 +38,7 @@ namespace kagome::application {
     // keep important instances, the must exist when injector destroyed
     // some of them are requested by reference and hence not copied
     io_context_ = injector_.create<sptr<boost::asio::io_context>>();
+    rpc_context_ = injector_.create<sptr<api::RpcContext>>();
     config_storage_ = injector_.create<sptr<ConfigurationStorage>>();
     key_storage_ = injector_.create<sptr<KeyStorage>>();
     clock_ = injector_.create<sptr<clock::SystemClock>>();
@@ -70,6 +77,18 @@ namespace kagome::application {
       this->router_->init();
     });
 
+    // rpc transport does not touch the state, so it is served by its own
+    // threads, while everything else is run on the current one
+    std::vector<std::thread> rpc_threads;
+    for (size_t i = 0; i < execution_config_.rpc_threads; ++i) {
+      rpc_threads.emplace_back([this] { rpc_context_->run(); });
+    }
+
     io_context_->run();
+
+    rpc_context_->stop();
+    for (auto &thread : rpc_threads) {
+      thread.join();
+    }
   }
 }  // namespace kagome::application
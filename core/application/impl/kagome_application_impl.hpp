@@ -10,13 +10,15 @@
 
 #include "api/service/api_service.hpp"
 #include "application/configuration_storage.hpp"
+#include "application/execution_config.hpp"
 #include "application/impl/local_key_storage.hpp"
 #include "injector/full_node_injector.hpp"
 
 namespace kagome::application {
 
   /**
-   * @class KagomeApplicationImpl implements kagome application
+   * @class KagomeApplicationImpl implements kagome application. Threads, on
+   * which the application runs, are described by ExecutionConfig
    */
   class KagomeApplicationImpl : public KagomeApplication {
     using AuthorityIndex = primitives::AuthorityIndex;
@@ -34,12 +36,14 @@ namespace kagome::application {
     using SystemClock = clock::SystemClock;
     using GrandpaLauncher = consensus::grandpa::Launcher;
     using Timer = clock::Timer;
-    using InjectorType = decltype(injector::makeFullNodeInjector(std::string{},
-                                                                 std::string{},
-                                                                 std::string{},
-                                                                 uint16_t{},
-                                                                 uint16_t{},
-                                                                 uint16_t{}));
+    using InjectorType =
+        decltype(injector::makeFullNodeInjector(std::string{},
+                                                std::string{},
+                                                std::string{},
+                                                uint16_t{},
+                                                uint16_t{},
+                                                uint16_t{},
+                                                ExecutionConfig{}));
 
     template <class T>
     using sptr = std::shared_ptr<T>;
@@ -60,6 +64,7 @@ namespace kagome::application {
                           uint16_t p2p_port,
                           uint16_t rpc_http_port,
                           uint16_t rpc_ws_port,
+                          const ExecutionConfig &execution_config,
                           bool is_genesis_epoch,
                           uint8_t verbosity);
 
@@ -69,6 +74,7 @@ namespace kagome::application {
     // need to keep all of these instances, since injector itself is destroyed
     InjectorType injector_;
     sptr<boost::asio::io_context> io_context_;
+    sptr<api::RpcContext> rpc_context_;
     sptr<ConfigurationStorage> config_storage_;
     sptr<KeyStorage> key_storage_;
     sptr<clock::SystemClock> clock_;
@@ -77,6 +83,7 @@ namespace kagome::application {
     sptr<GrandpaLauncher> grandpa_launcher_;
     sptr<network::Router> router_;
 
+    ExecutionConfig execution_config_;
     bool is_genesis_epoch_;
     common::Logger logger_;
   };
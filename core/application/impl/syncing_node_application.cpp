@@ -4,6 +4,9 @@
  */
 
 #include "application/impl/syncing_node_application.hpp"
+
+#include <thread>
+
 #include "network/common.hpp"
 
 namespace kagome::application {
@@ -14,15 +17,22 @@ namespace kagome::application {
       uint16_t p2p_port,
       uint16_t rpc_http_port,
       uint16_t rpc_ws_port,
+      const ExecutionConfig &execution_config,
       uint8_t verbosity)
-      : injector_{injector::makeSyncingNodeInjector(
-            config_path, leveldb_path, p2p_port, rpc_http_port, rpc_ws_port)},
+      : injector_{injector::makeSyncingNodeInjector(config_path,
+                                                    leveldb_path,
+                                                    p2p_port,
+                                                    rpc_http_port,
+                                                    rpc_ws_port,
+                                                    execution_config)},
+        execution_config_{execution_config},
         logger_{common::createLogger("SyncingNodeApplication")} {
     spdlog::set_level(static_cast<spdlog::level::level_enum>(verbosity));
 
     // keep important instances, the must exist when injector destroyed
     // some of them are requested by reference and hence not copied
     io_context_ = injector_.create<sptr<boost::asio::io_context>>();
+    rpc_context_ = injector_.create<sptr<api::RpcContext>>();
     config_storage_ = injector_.create<sptr<ConfigurationStorage>>();
     router_ = injector_.create<sptr<network::Router>>();
     jrpc_api_service_ = injector_.create<sptr<api::ApiService>>();
@@ -64,7 +74,19 @@ namespace kagome::application {
       this->router_->init();
     });
 
+    // rpc transport does not touch the state, so it is served by its own
+    // threads, while everything else is run on the current one
+    std::vector<std::thread> rpc_threads;
+    for (size_t i = 0; i < execution_config_.rpc_threads; ++i) {
+      rpc_threads.emplace_back([this] { rpc_context_->run(); });
+    }
+
     io_context_->run();
+
+    rpc_context_->stop();
+    for (auto &thread : rpc_threads) {
+      thread.join();
+    }
   }
 
 }  // namespace kagome::application
@@ -8,6 +8,7 @@
 
 #include "application/kagome_application.hpp"
 
+#include "application/execution_config.hpp"
 #include "injector/syncing_node_injector.hpp"
 #include "common/logger.hpp"
 
@@ -21,8 +22,13 @@ namespace kagome::application {
     using uptr = std::unique_ptr<T>;
 
    public:
-    using InjectorType = decltype(injector::makeSyncingNodeInjector(
-        std::string{}, std::string{}, uint16_t{}, uint16_t{}, uint16_t{}));
+    using InjectorType =
+        decltype(injector::makeSyncingNodeInjector(std::string{},
+                                                   std::string{},
+                                                   uint16_t{},
+                                                   uint16_t{},
+                                                   uint16_t{},
+                                                   ExecutionConfig{}));
 
     ~SyncingNodeApplication() override = default;
 
@@ -31,6 +37,7 @@ namespace kagome::application {
                            uint16_t p2p_port,
                            uint16_t rpc_http_port,
                            uint16_t rpc_ws_port,
+                           const ExecutionConfig &execution_config,
                            uint8_t verbosity);
 
     void run() override;
@@ -39,10 +46,12 @@ namespace kagome::application {
     // need to keep all of these instances, since injector itself is destroyed
     InjectorType injector_;
     sptr<boost::asio::io_context> io_context_;
+    sptr<api::RpcContext> rpc_context_;
     sptr<ConfigurationStorage> config_storage_;
     sptr<api::ApiService> jrpc_api_service_;
     sptr<network::Router> router_;
 
+    ExecutionConfig execution_config_;
     common::Logger logger_;
   };
 
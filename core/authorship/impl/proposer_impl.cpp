@@ -10,19 +10,25 @@ namespace kagome::authorship {
   ProposerImpl::ProposerImpl(
       std::shared_ptr<BlockBuilderFactory> block_builder_factory,
       std::shared_ptr<transaction_pool::TransactionPool> transaction_pool,
-      std::shared_ptr<runtime::BlockBuilder> r_block_builder)
+      std::shared_ptr<runtime::BlockBuilder> r_block_builder,
+      std::shared_ptr<clock::SystemClock> clock,
+      Limits limits)
       : block_builder_factory_{std::move(block_builder_factory)},
         transaction_pool_{std::move(transaction_pool)},
-        r_block_builder_{std::move(r_block_builder)} {
+        r_block_builder_{std::move(r_block_builder)},
+        clock_{std::move(clock)},
+        limits_{limits} {
     BOOST_ASSERT(block_builder_factory_);
     BOOST_ASSERT(transaction_pool_);
     BOOST_ASSERT(r_block_builder_);
+    BOOST_ASSERT(clock_);
   }
 
   outcome::result<primitives::Block> ProposerImpl::propose(
       const primitives::BlockId &parent_block_id,
       const primitives::InherentData &inherent_data,
-      const primitives::Digest &inherent_digest) {
+      const primitives::Digest &inherent_digest,
+      clock::SystemClock::TimePoint deadline) {
     OUTCOME_TRY(
         block_builder,
         block_builder_factory_->create(parent_block_id, inherent_digest));
@@ -43,27 +49,60 @@ namespace kagome::authorship {
                     message);
     };
 
+    // inherents are mandatory, so they do not depend on the limits
+    size_t block_bytes = 0;
     for (const auto &xt : inherent_xts) {
       auto inserted_res = block_builder->pushExtrinsic(xt);
       if (not inserted_res) {
         log_push_error(xt, inserted_res.error().message());
         return inserted_res.error();
       }
+      block_bytes += xt.data.size();
     }
 
-    const auto &ready_txs = transaction_pool_->getReadyTransactions();
-
-    for (const auto &[hash, tx] : ready_txs) {
-      auto inserted_res = block_builder->pushExtrinsic(tx->ext);
-      if (not inserted_res) {
-        log_push_error(tx->ext, inserted_res.error().message());
-        return inserted_res.error();
+    // ready transactions are walked in the order of their priority, so the
+    // most valuable ones are included first
+    std::vector<primitives::Transaction::Hash> included_hashes;
+    std::vector<primitives::Transaction::Hash> invalid_hashes;
+    {
+      auto ready_txs = transaction_pool_->getReadyIterator();
+      size_t skipped = 0;
+      while (auto tx = ready_txs->next()) {
+        if (clock_->now() >= deadline) {
+          logger_->debug("Deadline is reached, block has {} transactions",
+                         included_hashes.size());
+          break;
+        }
+        if (block_bytes + tx->ext.data.size() > limits_.max_block_bytes) {
+          // smaller transactions still may fit the block
+          ready_txs->skipDependents();
+          if (++skipped >= limits_.max_skipped_transactions) {
+            logger_->debug("Block is full, it has {} transactions",
+                           included_hashes.size());
+            break;
+          }
+          continue;
+        }
+        auto inserted_res = block_builder->pushExtrinsic(tx->ext);
+        if (not inserted_res) {
+          log_push_error(tx->ext, inserted_res.error().message());
+          ready_txs->skipDependents();
+          invalid_hashes.push_back(tx->hash);
+          continue;
+        }
+        skipped = 0;
+        block_bytes += tx->ext.data.size();
+        included_hashes.push_back(tx->hash);
       }
     }
 
+    for (const auto &hash : invalid_hashes) {
+      transaction_pool_->reportInvalid(hash);
+    }
+
     auto block = block_builder->bake();
 
-    for (const auto &[hash, tx] : ready_txs) {
+    for (const auto &hash : included_hashes) {
       auto removed_res = transaction_pool_->removeOne(hash);
       if (not removed_res) {
         logger_->error(
@@ -15,24 +15,42 @@
 
 namespace kagome::authorship {
 
+  /**
+   * Fills block with the ready transactions in the order of their priority
+   * until the deadline or the size limit of the block is reached. Transactions,
+   * which fail to be applied, are skipped and reported to the pool
+   */
   class ProposerImpl : public Proposer {
    public:
+    struct Limits {
+      /// max size of the extrinsics of the block
+      size_t max_block_bytes = 4u * 1024 * 1024;
+      /// max number of transactions in a row, which are skipped as they do not
+      /// fit the block, before the block is considered to be full
+      size_t max_skipped_transactions = 8u;
+    };
+
     ~ProposerImpl() override = default;
 
     ProposerImpl(
         std::shared_ptr<BlockBuilderFactory> block_builder_factory,
         std::shared_ptr<transaction_pool::TransactionPool> transaction_pool,
-        std::shared_ptr<runtime::BlockBuilder> r_block_builder);
+        std::shared_ptr<runtime::BlockBuilder> r_block_builder,
+        std::shared_ptr<clock::SystemClock> clock,
+        Limits limits);
 
     outcome::result<primitives::Block> propose(
         const primitives::BlockId &parent_block_id,
         const primitives::InherentData &inherent_data,
-        const primitives::Digest &inherent_digest) override;
+        const primitives::Digest &inherent_digest,
+        clock::SystemClock::TimePoint deadline) override;
 
    private:
     std::shared_ptr<BlockBuilderFactory> block_builder_factory_;
     std::shared_ptr<transaction_pool::TransactionPool> transaction_pool_;
     std::shared_ptr<runtime::BlockBuilder> r_block_builder_;
+    std::shared_ptr<clock::SystemClock> clock_;
+    Limits limits_;
     common::Logger logger_ = common::createLogger("Proposer");
   };
 
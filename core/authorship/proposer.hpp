@@ -26,12 +26,15 @@ namespace kagome::authorship {
      * @param parent_block_id hash or number of parent
      * @param inherent_data additional data on block from unsigned extrinsics
      * @param inherent_digests - chain-specific block auxilary data
+     * @param deadline - time, after which no more transactions are added to
+     * the block
      * @return proposed block or error
      */
     virtual outcome::result<primitives::Block> propose(
         const primitives::BlockId &parent_block_id,
         const primitives::InherentData &inherent_data,
-        const primitives::Digest &inherent_digest) = 0;
+        const primitives::Digest &inherent_digest,
+        clock::SystemClock::TimePoint deadline) = 0;
   };
 
 }  // namespace kagome::authorship
@@ -9,6 +9,7 @@
 #include "primitives/block.hpp"
 #include "primitives/block_data.hpp"
 #include "primitives/block_id.hpp"
+#include "primitives/hashed_header.hpp"
 #include "primitives/justification.hpp"
 
 namespace kagome::blockchain {
@@ -32,6 +33,8 @@ namespace kagome::blockchain {
 
     virtual outcome::result<primitives::BlockHash> putBlockHeader(
         const primitives::BlockHeader &header) = 0;
+    virtual outcome::result<primitives::BlockHash> putBlockHeader(
+        const primitives::HashedHeader &header) = 0;
 
     virtual outcome::result<void> putBlockData(
         primitives::BlockNumber, const primitives::BlockData &block_data) = 0;
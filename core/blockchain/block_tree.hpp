@@ -11,9 +11,11 @@
 
 #include <boost/optional.hpp>
 #include <outcome/outcome.hpp>
+#include "blockchain/block_tree_observer.hpp"
 #include "primitives/block.hpp"
 #include "primitives/block_id.hpp"
 #include "primitives/common.hpp"
+#include "primitives/hashed_header.hpp"
 #include "primitives/justification.hpp"
 
 namespace kagome::blockchain {
@@ -65,6 +67,15 @@ namespace kagome::blockchain {
     virtual outcome::result<void> addBlockHeader(
         const primitives::BlockHeader &header) = 0;
 
+    /**
+     * Adds header to the storage, reusing its encoded form and hash
+     * @param header that we are adding
+     * @return result with success if header's parent exists on storage and new
+     * header was added. Error otherwise
+     */
+    virtual outcome::result<void> addBlockHeader(
+        const primitives::HashedHeader &header) = 0;
+
     /**
      * Adds block body to the storage
      * @param block_number that corresponds to the block which body we are
@@ -134,6 +145,18 @@ namespace kagome::blockchain {
         const primitives::BlockHash &top_block,
         const primitives::BlockHash &bottom_block) = 0;
 
+    /**
+     * Check if one block is an ancestor of another one without building the
+     * chain between them
+     * @param ancestor - block, which is expected to be an ancestor
+     * @param descendant - block, which is expected to be a descendant
+     * @return true, if (\param ancestor) is equal to or is a direct ancestor
+     * of (\param descendant), false otherwise
+     */
+    virtual bool hasDirectChain(
+        const primitives::BlockHash &ancestor,
+        const primitives::BlockHash &descendant) const = 0;
+
     /**
      * Get a longest path (chain of blocks) from the last finalized block down
      * to the deepest leaf
@@ -178,10 +201,18 @@ namespace kagome::blockchain {
     virtual BlockHashVecRes getChildren(const primitives::BlockHash &block) = 0;
 
     /**
-     * Get the last finalized block
+     * Get the last finalized block. Unlike other methods, may be invoked from
+     * any thread
      * @return hash of the block
      */
     virtual primitives::BlockInfo getLastFinalized() const = 0;
+
+    /**
+     * Subscribe to the events of the tree; the tree does not prolong the
+     * lifetime of the observer
+     * @param observer to be notified
+     */
+    virtual void addObserver(std::weak_ptr<BlockTreeObserver> observer) = 0;
   };
 }  // namespace kagome::blockchain
 
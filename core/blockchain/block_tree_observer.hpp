@@ -0,0 +1,42 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_BLOCK_TREE_OBSERVER_HPP
+#define KAGOME_BLOCK_TREE_OBSERVER_HPP
+
+#include "primitives/common.hpp"
+
+namespace kagome::blockchain {
+  /**
+   * Receives events of the block tree. Handlers are invoked on the thread,
+   * which modifies the tree, right after the modification, so they must not
+   * block: long processing is to be moved to other threads
+   */
+  struct BlockTreeObserver {
+    virtual ~BlockTreeObserver() = default;
+
+    /**
+     * Invoked, when a block is executed and its body is added to the tree,
+     * thus the state at the block is available
+     * @param block - added block
+     */
+    virtual void onBlockAdded(const primitives::BlockInfo &block) = 0;
+
+    /**
+     * Invoked, when a block is finalized
+     * @param block - finalized block
+     */
+    virtual void onBlockFinalized(const primitives::BlockInfo &block) = 0;
+
+    /**
+     * Invoked, when a block of a fork, which does not end up in the
+     * finalized chain, is removed from the tree
+     * @param block - removed block
+     */
+    virtual void onBlockPruned(const primitives::BlockInfo &block) {}
+  };
+}  // namespace kagome::blockchain
+
+#endif  // KAGOME_BLOCK_TREE_OBSERVER_HPP
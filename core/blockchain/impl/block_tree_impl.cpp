@@ -38,7 +38,21 @@ namespace kagome::blockchain {
                                     primitives::BlockNumber depth,
                                     const std::shared_ptr<TreeNode> &parent,
                                     bool finalized)
-      : block_hash{hash}, depth{depth}, parent{parent}, finalized{finalized} {}
+      : block_hash{hash}, depth{depth}, parent{parent}, finalized{finalized} {
+    if (!parent) {
+      return;
+    }
+    // k-th jump is a (k-1)-th jump of the (k-1)-th jump
+    jumps.emplace_back(parent);
+    while (true) {
+      auto k = jumps.size();
+      auto prev = jumps[k - 1].lock();
+      if (!prev || prev->jumps.size() < k) {
+        break;
+      }
+      jumps.emplace_back(prev->jumps[k - 1]);
+    }
+  }
 
   std::shared_ptr<BlockTreeImpl::TreeNode> BlockTreeImpl::TreeNode::getByHash(
       const primitives::BlockHash &hash) {
@@ -58,6 +72,31 @@ namespace kagome::blockchain {
     return nullptr;
   }
 
+  std::shared_ptr<BlockTreeImpl::TreeNode>
+  BlockTreeImpl::TreeNode::getAncestorAt(primitives::BlockNumber depth) {
+    if (depth > this->depth) {
+      return nullptr;
+    }
+    auto node = shared_from_this();
+    while (node->depth > depth) {
+      // take the longest jump, which does not overshoot the target; jumps to
+      // the pruned part of the tree are expired and thus skipped
+      std::shared_ptr<TreeNode> next;
+      for (auto k = node->jumps.size(); k > 0; --k) {
+        auto candidate = node->jumps[k - 1].lock();
+        if (candidate && candidate->depth >= depth) {
+          next = std::move(candidate);
+          break;
+        }
+      }
+      if (!next) {
+        return nullptr;
+      }
+      node = std::move(next);
+    }
+    return node;
+  }
+
   bool BlockTreeImpl::TreeNode::operator==(const TreeNode &other) const {
     const auto &other_parent = other.parent;
     auto parents_equal = (parent.expired() && other_parent.expired())
@@ -140,6 +179,8 @@ namespace kagome::blockchain {
         storage_{std::move(storage)},
         tree_{std::move(tree)},
         tree_meta_{std::move(meta)},
+        last_finalized_{std::make_shared<const primitives::BlockInfo>(
+            tree_->depth, tree_->block_hash)},
         hasher_{std::move(hasher)} {}
 
   outcome::result<void> BlockTreeImpl::addBlockHeader(
@@ -149,17 +190,18 @@ namespace kagome::blockchain {
       return BlockTreeError::NO_PARENT;
     }
     OUTCOME_TRY(block_hash, storage_->putBlockHeader(header));
-    // update local meta with the new block
-    auto new_node =
-        std::make_shared<TreeNode>(block_hash, header.number, parent);
-    parent->children.push_back(new_node);
+    addTreeNode(parent, block_hash, header.number);
+    return outcome::success();
+  }
 
-    tree_meta_->leaves.insert(new_node->block_hash);
-    tree_meta_->leaves.erase(parent->block_hash);
-    if (new_node->depth > tree_meta_->deepest_leaf.get().depth) {
-      tree_meta_->deepest_leaf = *new_node;
+  outcome::result<void> BlockTreeImpl::addBlockHeader(
+      const primitives::HashedHeader &header) {
+    auto parent = tree_->getByHash(header.header().parent_hash);
+    if (!parent) {
+      return BlockTreeError::NO_PARENT;
     }
-
+    OUTCOME_TRY(block_hash, storage_->putBlockHeader(header));
+    addTreeNode(parent, block_hash, header.header().number);
     return outcome::success();
   }
 
@@ -172,9 +214,18 @@ namespace kagome::blockchain {
       return BlockTreeError::NO_PARENT;
     }
     OUTCOME_TRY(block_hash, storage_->putBlock(block));
-    // update local meta with the new block
+    addTreeNode(parent, block_hash, block.header.number);
+    notifyObservers([&](BlockTreeObserver &observer) {
+      observer.onBlockAdded({block.header.number, block_hash});
+    });
+    return outcome::success();
+  }
+
+  void BlockTreeImpl::addTreeNode(const std::shared_ptr<TreeNode> &parent,
+                                  const primitives::BlockHash &block_hash,
+                                  primitives::BlockNumber block_number) {
     auto new_node =
-        std::make_shared<TreeNode>(block_hash, block.header.number, parent);
+        std::make_shared<TreeNode>(block_hash, block_number, parent);
     parent->children.push_back(new_node);
 
     tree_meta_->leaves.insert(new_node->block_hash);
@@ -182,8 +233,6 @@ namespace kagome::blockchain {
     if (new_node->depth > tree_meta_->deepest_leaf.get().depth) {
       tree_meta_->deepest_leaf = *new_node;
     }
-
-    return outcome::success();
   }
 
   outcome::result<void> BlockTreeImpl::addBlockBody(
@@ -191,7 +240,11 @@ namespace kagome::blockchain {
       const primitives::BlockHash &block_hash,
       const primitives::BlockBody &body) {
     primitives::BlockData block_data{.hash = block_hash, .body = body};
-    return storage_->putBlockData(block_number, block_data);
+    OUTCOME_TRY(storage_->putBlockData(block_number, block_data));
+    notifyObservers([&](BlockTreeObserver &observer) {
+      observer.onBlockAdded({block_number, block_hash});
+    });
+    return outcome::success();
   }
 
   outcome::result<void> BlockTreeImpl::finalize(
@@ -217,11 +270,18 @@ namespace kagome::blockchain {
 
     tree_meta_ = std::make_shared<TreeMeta>(*tree_);
 
+    std::atomic_store(&last_finalized_,
+                      std::make_shared<const primitives::BlockInfo>(
+                          node->depth, node->block_hash));
+
     tree_->parent.reset();
 
     log_->info("Finalized block with hash: {}, number: {}",
                block.toHex(),
                node->depth);
+    notifyObservers([&](BlockTreeObserver &observer) {
+      observer.onBlockFinalized({node->depth, node->block_hash});
+    });
 
     return outcome::success();
   }
@@ -339,6 +399,54 @@ namespace kagome::blockchain {
     return result;
   }
 
+  bool BlockTreeImpl::hasDirectChain(
+      const primitives::BlockHash &ancestor,
+      const primitives::BlockHash &descendant) const {
+    if (ancestor == descendant) {
+      return true;
+    }
+
+    auto descendant_node_ptr = tree_->getByHash(descendant);
+    auto ancestor_node_ptr = tree_->getByHash(ancestor);
+
+    // if both nodes are in our light tree, jump over the ancestry
+    if (ancestor_node_ptr && descendant_node_ptr) {
+      return descendant_node_ptr->getAncestorAt(ancestor_node_ptr->depth)
+             == ancestor_node_ptr;
+    }
+    if (ancestor_node_ptr) {
+      // descendant is not in the tree, while all descendants of the tree
+      // nodes are
+      return false;
+    }
+
+    // else, ancestor can only be finalized: walk the database starting from
+    // the root of the light tree, if possible
+    auto ancestor_number_res = header_repo_->getNumberByHash(ancestor);
+    if (!ancestor_number_res) {
+      return false;
+    }
+    const auto ancestor_number = ancestor_number_res.value();
+
+    auto current_hash = descendant;
+    if (descendant_node_ptr) {
+      if (tree_->depth <= ancestor_number) {
+        return false;
+      }
+      current_hash = tree_->block_hash;
+    }
+    while (true) {
+      auto current_header_res = header_repo_->getBlockHeader(current_hash);
+      if (!current_header_res) {
+        return false;
+      }
+      if (current_header_res.value().number <= ancestor_number) {
+        return current_hash == ancestor;
+      }
+      current_hash = current_header_res.value().parent_hash;
+    }
+  }
+
   BlockTreeImpl::BlockHashVecRes BlockTreeImpl::longestPath() {
     auto &&[_, block_hash] = deepestLeaf();
     return getChainByBlock(block_hash);
@@ -433,8 +541,23 @@ namespace kagome::blockchain {
   }
 
   primitives::BlockInfo BlockTreeImpl::getLastFinalized() const {
-    const auto &last = tree_meta_->last_finalized.get();
-    return primitives::BlockInfo{last.depth, last.block_hash};
+    return *std::atomic_load(&last_finalized_);
+  }
+
+  void BlockTreeImpl::addObserver(std::weak_ptr<BlockTreeObserver> observer) {
+    observers_.push_back(std::move(observer));
+  }
+
+  void BlockTreeImpl::notifyObservers(
+      const std::function<void(BlockTreeObserver &)> &notify) {
+    for (auto it = observers_.begin(); it != observers_.end();) {
+      if (auto observer = it->lock()) {
+        notify(*observer);
+        ++it;
+      } else {
+        it = observers_.erase(it);
+      }
+    }
   }
 
   std::vector<primitives::BlockHash> BlockTreeImpl::getLeavesSorted() const {
@@ -504,6 +627,9 @@ namespace kagome::blockchain {
     // remove from storage
     for (const auto &[hash, number] : to_remove) {
       OUTCOME_TRY(storage_->removeBlock(hash, number));
+      notifyObservers([&](BlockTreeObserver &observer) {
+        observer.onBlockPruned({number, hash});
+      });
     }
 
     return outcome::success();
@@ -40,6 +40,13 @@ namespace kagome::blockchain {
 
       std::weak_ptr<TreeNode> parent;
 
+      /**
+       * Skip list over the ancestry of this node: the k-th element points to
+       * the ancestor, which is 2^k blocks above, so that any ancestor can be
+       * reached in a logarithmic number of hops
+       */
+      std::vector<std::weak_ptr<TreeNode>> jumps;
+
       bool finalized;
 
       std::vector<std::shared_ptr<TreeNode>> children{};
@@ -50,6 +57,12 @@ namespace kagome::blockchain {
        */
       std::shared_ptr<TreeNode> getByHash(const primitives::BlockHash &hash);
 
+      /**
+       * Get an ancestor of this node (or the node itself) with the specified
+       * depth; nullptr, if such ancestor is not present in the tree
+       */
+      std::shared_ptr<TreeNode> getAncestorAt(primitives::BlockNumber depth);
+
       bool operator==(const TreeNode &other) const;
       bool operator!=(const TreeNode &other) const;
     };
@@ -111,6 +124,9 @@ namespace kagome::blockchain {
     outcome::result<void> addBlockHeader(
         const primitives::BlockHeader &header) override;
 
+    outcome::result<void> addBlockHeader(
+        const primitives::HashedHeader &header) override;
+
     outcome::result<void> addBlock(const primitives::Block &block) override;
 
     outcome::result<void> addBlockBody(
@@ -132,6 +148,9 @@ namespace kagome::blockchain {
         const primitives::BlockHash &top_block,
         const primitives::BlockHash &bottom_block) override;
 
+    bool hasDirectChain(const primitives::BlockHash &ancestor,
+                        const primitives::BlockHash &descendant) const override;
+
     BlockHashVecRes longestPath() override;
 
     primitives::BlockInfo deepestLeaf() const override;
@@ -147,6 +166,8 @@ namespace kagome::blockchain {
 
     primitives::BlockInfo getLastFinalized() const override;
 
+    void addObserver(std::weak_ptr<BlockTreeObserver> observer) override;
+
    private:
     /**
      * Private constructor, so that instances are created only through the
@@ -166,6 +187,14 @@ namespace kagome::blockchain {
         const primitives::BlockHash &start,
         const primitives::BlockNumber &limit) const;
 
+    /**
+     * Update local meta with the new block \param block_hash with number
+     * \param block_number, which is a child of \param parent
+     */
+    void addTreeNode(const std::shared_ptr<TreeNode> &parent,
+                     const primitives::BlockHash &block_hash,
+                     primitives::BlockNumber block_number);
+
     /**
      * @returns the tree leaves sorted by their depth
      */
@@ -179,13 +208,24 @@ namespace kagome::blockchain {
     outcome::result<void> prune(
         const std::shared_ptr<TreeNode> &lastFinalizedNode);
 
+    /**
+     * Invoke \param notify for each alive observer, forget the expired ones
+     */
+    void notifyObservers(
+        const std::function<void(BlockTreeObserver &)> &notify);
+
     std::shared_ptr<BlockHeaderRepository> header_repo_;
     std::shared_ptr<BlockStorage> storage_;
 
     std::shared_ptr<TreeNode> tree_;
     std::shared_ptr<TreeMeta> tree_meta_;
 
+    /// copy of the last finalized block, which is read and replaced
+    /// atomically, so it can be requested from any thread
+    std::shared_ptr<const primitives::BlockInfo> last_finalized_;
+
     std::shared_ptr<crypto::Hasher> hasher_;
+    std::vector<std::weak_ptr<BlockTreeObserver>> observers_;
     common::Logger log_ = common::createLogger("BlockTreeImpl");
   };
 }  // namespace kagome::blockchain
@@ -116,6 +116,16 @@ namespace kagome::blockchain {
     return block_hash;
   }
 
+  outcome::result<primitives::BlockHash> KeyValueBlockStorage::putBlockHeader(
+      const primitives::HashedHeader &header) {
+    OUTCOME_TRY(putWithPrefix(*storage_,
+                              Prefix::HEADER,
+                              header.header().number,
+                              header.hash(),
+                              header.encoded()));
+    return header.hash();
+  }
+
   outcome::result<void> KeyValueBlockStorage::putBlockData(
       primitives::BlockNumber block_number,
       const primitives::BlockData &block_data) {
@@ -49,6 +49,8 @@ namespace kagome::blockchain {
 
     outcome::result<primitives::BlockHash> putBlockHeader(
         const primitives::BlockHeader &header) override;
+    outcome::result<primitives::BlockHash> putBlockHeader(
+        const primitives::HashedHeader &header) override;
     outcome::result<void> putBlockData(
         primitives::BlockNumber block_number,
         const primitives::BlockData &block_data) override;
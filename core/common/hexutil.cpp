@@ -5,6 +5,8 @@
 
 #include "common/hexutil.hpp"
 
+#include <array>
+
 #include <boost/algorithm/hex.hpp>
 #include <boost/format.hpp>
 #include <gsl/span>
@@ -23,6 +25,36 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::common, UnhexError, e) {
 
 namespace kagome::common {
 
+  namespace {
+    using HexTable = std::array<std::array<char, 2>, 256>;
+
+    /// @return pairs of hex digits of each byte value
+    constexpr HexTable makeHexTable(const char *digits) {
+      HexTable table{};
+      for (size_t byte = 0; byte < table.size(); ++byte) {
+        table[byte][0] = digits[byte >> 4u];
+        table[byte][1] = digits[byte & 0xFu];
+      }
+      return table;
+    }
+
+    constexpr HexTable kHexLower = makeHexTable("0123456789abcdef");
+    constexpr HexTable kHexUpper = makeHexTable("0123456789ABCDEF");
+
+    /// Write two digits of each of \param bytes to \param out, which must
+    /// have room for them
+    void encodeHex(gsl::span<const uint8_t> bytes,
+                   const HexTable &table,
+                   char *out) {
+      for (auto byte : bytes) {
+        const auto &digits = table[byte];
+        out[0] = digits[0];
+        out[1] = digits[1];
+        out += 2;
+      }
+    }
+  }  // namespace
+
   std::string int_to_hex(uint64_t n, size_t fixed_width) noexcept {
     std::stringstream result;
     result.width(fixed_width);
@@ -41,13 +73,21 @@ namespace kagome::common {
 
   std::string hex_upper(const gsl::span<const uint8_t> bytes) noexcept {
     std::string res(bytes.size() * 2, '\x00');
-    boost::algorithm::hex(bytes.begin(), bytes.end(), res.begin());
+    encodeHex(bytes, kHexUpper, res.data());
     return res;
   }
 
   std::string hex_lower(const gsl::span<const uint8_t> bytes) noexcept {
     std::string res(bytes.size() * 2, '\x00');
-    boost::algorithm::hex_lower(bytes.begin(), bytes.end(), res.begin());
+    encodeHex(bytes, kHexLower, res.data());
+    return res;
+  }
+
+  std::string hex_lower_0x(const gsl::span<const uint8_t> bytes) noexcept {
+    std::string res(2 + bytes.size() * 2, '\x00');
+    res[0] = '0';
+    res[1] = 'x';
+    encodeHex(bytes, kHexLower, res.data() + 2);
     return res;
   }
 
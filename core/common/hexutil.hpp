@@ -41,6 +41,14 @@ namespace kagome::common {
    */
   std::string hex_lower(gsl::span<const uint8_t> bytes) noexcept;
 
+  /**
+   * @brief Converts bytes to hex representation with 0x in the beginning;
+   * the result is allocated once, so it suits large values
+   * @param bytes bytes
+   * @return 0x-prefixed hexstring
+   */
+  std::string hex_lower_0x(gsl::span<const uint8_t> bytes) noexcept;
+
   /**
    * @brief Converts hex representation to bytes
    * @param array individual chars
@@ -7,30 +7,34 @@
 #define KAGOME_CORE_CONSENSUS_BABE_BABE_SYNCHRONIZER_HPP
 
 #include "primitives/block.hpp"
-#include "primitives/block_id.hpp"
+#include "primitives/common.hpp"
 
 namespace kagome::consensus {
 
   /**
-   * @brief Iterates over the list of accessible peers and tries to fetch
-   * missing blocks from them
+   * @brief Fetches missing blocks from the accessible peers
    */
   class BabeSynchronizer {
    public:
     using BlocksHandler =
         std::function<void(const std::vector<primitives::Block> &)>;
+    using FinishedHandler = std::function<void()>;
 
     virtual ~BabeSynchronizer() = default;
 
     /**
      * Request blocks between provided ones
-     * @param from block id of the first requested block
-     * @param to block hash of the last requested block
-     * @param block_list_handler handles received blocks
+     * @param from the first requested block
+     * @param to the last requested block
+     * @param block_list_handler handles received blocks; can be invoked
+     * several times with consecutive parts of the requested chain in the
+     * ascending order
+     * @param finished_handler invoked after all requested blocks are handled
      */
-    virtual void request(const primitives::BlockId &from,
-                         const primitives::BlockHash &to,
-                         const BlocksHandler &block_list_handler) = 0;
+    virtual void request(const primitives::BlockInfo &from,
+                         const primitives::BlockInfo &to,
+                         const BlocksHandler &block_list_handler,
+                         const FinishedHandler &finished_handler) = 0;
   };
 
 }  // namespace kagome::consensus
@@ -27,6 +27,7 @@ namespace kagome::consensus {
       std::shared_ptr<EpochStorage> epoch_storage,
       std::shared_ptr<primitives::BabeConfiguration> configuration,
       std::shared_ptr<authorship::Proposer> proposer,
+      std::shared_ptr<transaction_pool::PoolRevalidator> pool_revalidator,
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<BabeGossiper> gossiper,
       crypto::SR25519Keypair keypair,
@@ -39,6 +40,7 @@ namespace kagome::consensus {
         epoch_storage_{std::move(epoch_storage)},
         genesis_configuration_{std::move(configuration)},
         proposer_{std::move(proposer)},
+        pool_revalidator_{std::move(pool_revalidator)},
         block_tree_{std::move(block_tree)},
         gossiper_{std::move(gossiper)},
         keypair_{keypair},
@@ -50,6 +52,7 @@ namespace kagome::consensus {
     BOOST_ASSERT(epoch_storage_);
     BOOST_ASSERT(trie_db_);
     BOOST_ASSERT(proposer_);
+    BOOST_ASSERT(pool_revalidator_);
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(gossiper_);
     BOOST_ASSERT(clock_);
@@ -287,9 +290,13 @@ namespace kagome::consensus {
     }
     auto babe_pre_digest = babe_pre_digest_res.value();
 
-    // create new block
-    auto pre_seal_block_res =
-        proposer_->propose(best_block_hash, inherent_data, {babe_pre_digest});
+    // create new block; block must be ready before the end of the next slot,
+    // so part of it is left to seal, store and announce the block
+    auto deadline = next_slot_finish_time_
+                    + genesis_configuration_->slot_duration
+                          * ProposalSlotShare::num / ProposalSlotShare::den;
+    auto pre_seal_block_res = proposer_->propose(
+        best_block_hash, inherent_data, {babe_pre_digest}, deadline);
     if (!pre_seal_block_res) {
       return log_->error("cannot propose a block: {}",
                          pre_seal_block_res.error().message());
@@ -331,6 +338,7 @@ namespace kagome::consensus {
       log_->error("Could not add block: {}", add_res.error().message());
       return;
     }
+    pool_revalidator_->onBlockImported(block);
 
     auto next_epoch_digest_res = getNextEpochDigest(block.header);
     if (next_epoch_digest_res) {
@@ -9,6 +9,7 @@
 #include "consensus/babe.hpp"
 
 #include <memory>
+#include <ratio>
 
 #include <boost/asio/basic_waitable_timer.hpp>
 #include <outcome/outcome.hpp>
@@ -25,6 +26,7 @@
 #include "primitives/babe_configuration.hpp"
 #include "primitives/common.hpp"
 #include "storage/trie/trie_db.hpp"
+#include "transaction_pool/pool_revalidator.hpp"
 
 namespace kagome::consensus {
 
@@ -46,6 +48,10 @@ namespace kagome::consensus {
 
   class BabeImpl : public Babe, public std::enable_shared_from_this<BabeImpl> {
    public:
+    /// part of the slot, which is given to build a block; the rest of it is
+    /// left to seal, store and announce the block
+    using ProposalSlotShare = std::ratio<2, 3>;
+
     /**
      * Create an instance of Babe implementation
      * @param lottery - implementation of Babe Lottery
@@ -66,6 +72,8 @@ namespace kagome::consensus {
              std::shared_ptr<EpochStorage> epoch_storage,
              std::shared_ptr<primitives::BabeConfiguration> configuration,
              std::shared_ptr<authorship::Proposer> proposer,
+             std::shared_ptr<transaction_pool::PoolRevalidator>
+                 pool_revalidator,
              std::shared_ptr<blockchain::BlockTree> block_tree,
              std::shared_ptr<BabeGossiper> gossiper,
              crypto::SR25519Keypair keypair,
@@ -127,6 +135,7 @@ namespace kagome::consensus {
     std::shared_ptr<EpochStorage> epoch_storage_;
     std::shared_ptr<primitives::BabeConfiguration> genesis_configuration_;
     std::shared_ptr<authorship::Proposer> proposer_;
+    std::shared_ptr<transaction_pool::PoolRevalidator> pool_revalidator_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<BabeGossiper> gossiper_;
     crypto::SR25519Keypair keypair_;
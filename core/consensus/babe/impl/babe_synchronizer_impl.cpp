@@ -5,54 +5,320 @@
 
 #include "consensus/babe/impl/babe_synchronizer_impl.hpp"
 
+#include <algorithm>
 #include <random>
 
 #include <boost/assert.hpp>
 #include "blockchain/block_tree_error.hpp"
-#include "common/visitor.hpp"
 #include "primitives/block.hpp"
 
 namespace kagome::consensus {
+  namespace {
+    primitives::BlocksRequestId nextRequestId() {
+      static std::random_device rd{};
+      static std::uniform_int_distribution<primitives::BlocksRequestId> dis{};
+      return dis(rd);
+    }
+  }  // namespace
+
   BabeSynchronizerImpl::BabeSynchronizerImpl(
-      std::shared_ptr<network::SyncClientsSet> sync_clients)
+      std::shared_ptr<network::SyncClientsSet> sync_clients,
+      std::shared_ptr<clock::SteadyClock> clock,
+      std::shared_ptr<boost::asio::io_context> io_context)
       : sync_clients_{std::move(sync_clients)},
+        clock_{std::move(clock)},
+        io_context_{std::move(io_context)},
         logger_{common::createLogger("BabeSynchronizer")} {
     BOOST_ASSERT(sync_clients_);
     BOOST_ASSERT(std::all_of(sync_clients_->clients.begin(),
                              sync_clients_->clients.end(),
                              [](const auto &client) { return client; }));
+    BOOST_ASSERT(clock_);
+    BOOST_ASSERT(io_context_);
+  }
+
+  void BabeSynchronizerImpl::request(const primitives::BlockInfo &from,
+                                     const primitives::BlockInfo &to,
+                                     const BlocksHandler &block_list_handler,
+                                     const FinishedHandler &finished_handler) {
+    logger_->info("Requesting blocks from {} to {}",
+                  from.block_number,
+                  to.block_number);
+
+    auto download = std::make_shared<RangeDownload>();
+    download->from = from;
+    download->to = to;
+    download->block_list_handler = block_list_handler;
+    download->finished_handler = finished_handler;
+    for (auto first = from.block_number; first <= to.block_number;
+         first += kWindowSize) {
+      auto &window = download->windows.emplace_back();
+      window.first = first;
+      window.last = std::min(first + kWindowSize - 1, to.block_number);
+    }
+    if (download->windows.empty()) {
+      logger_->warn("Requested block {} is lower than the starting block {}",
+                    to.block_number,
+                    from.block_number);
+      return finished_handler();
+    }
+
+    requestWindows(download);
+  }
+
+  std::vector<BabeSynchronizerImpl::SyncClient>
+  BabeSynchronizerImpl::rankedClients() const {
+    std::vector<SyncClient> clients{sync_clients_->clients.begin(),
+                                    sync_clients_->clients.end()};
+    auto stats = [this](const SyncClient &client) {
+      auto it = client_stats_.find(client);
+      return it == client_stats_.end() ? ClientStats{} : it->second;
+    };
+    // clients with no failures go first, then the faster ones
+    std::stable_sort(
+        clients.begin(),
+        clients.end(),
+        [&stats](const SyncClient &lhs, const SyncClient &rhs) {
+          auto lhs_stats = stats(lhs);
+          auto rhs_stats = stats(rhs);
+          return std::tie(lhs_stats.failures, lhs_stats.ms_per_block)
+                 < std::tie(rhs_stats.failures, rhs_stats.ms_per_block);
+        });
+    return clients;
+  }
+
+  void BabeSynchronizerImpl::requestWindows(
+      const std::shared_ptr<RangeDownload> &download) {
+    if (download->finished) {
+      return;
+    }
+    auto clients = rankedClients();
+    auto windows_end = std::min(download->windows.size(),
+                                download->next_to_deliver + kMaxWindowsAhead);
+    for (auto index = download->next_to_deliver; index < windows_end;
+         ++index) {
+      auto &window = download->windows[index];
+      if (window.blocks or window.client) {
+        continue;
+      }
+
+      // we want to ask each client until we get the window, but the
+      // sync_clients_ set can change between the requests, so we need to keep
+      // track of the clients we already asked
+      if (std::all_of(clients.begin(), clients.end(), [&window](auto &client) {
+            return window.failed_clients.count(client) != 0;
+          })) {
+        // we asked all clients we could, so start over
+        window.failed_clients.clear();
+      }
+      auto client_it = std::find_if(
+          clients.begin(), clients.end(), [&](const auto &client) {
+            return download->busy_clients.count(client) == 0
+                   and window.failed_clients.count(client) == 0;
+          });
+      if (client_it == clients.end()) {
+        // all suitable clients are busy; window will be requested when one of
+        // them is done
+        continue;
+      }
+      requestWindow(download, index, *client_it);
+    }
   }
 
-  void BabeSynchronizerImpl::request(const primitives::BlockId &from,
-                                     const primitives::BlockHash &to,
-                                     const BlocksHandler &block_list_handler) {
-    std::string from_str = visit_in_place(
-        from,
-        [](const primitives::BlockHash &hash) { return hash.toHex(); },
-        [](primitives::BlockNumber number) { return std::to_string(number); });
-    logger_->info("Requesting blocks from {} to {}", from_str, to.toHex());
-
-    static std::random_device rd{};
-    static std::uniform_int_distribution<primitives::BlocksRequestId> dis{};
-    network::BlocksRequest request{dis(rd),
+  void BabeSynchronizerImpl::requestWindow(
+      const std::shared_ptr<RangeDownload> &download,
+      size_t index,
+      const SyncClient &client) {
+    auto &window = download->windows[index];
+    window.client = client;
+    auto attempt = ++window.attempt;
+    download->busy_clients.insert(client);
+
+    network::BlocksRequest request{nextRequestId(),
                                    network::BlocksRequest::kBasicAttributes,
-                                   from,
-                                   to,
+                                   window.first,
+                                   boost::none,
                                    network::Direction::DESCENDING,
-                                   boost::none};
+                                   window.last - window.first};
+    if (index == 0) {
+      // start exactly from the requested block, not from the peer's block with
+      // the same number
+      request.from = download->from.block_hash;
+    }
+    if (index + 1 == download->windows.size()) {
+      request.to = download->to.block_hash;
+      request.max = boost::none;
+    }
+    logger_->debug("Requesting blocks from {} to {}", window.first, window.last);
+
+    window.timeout = std::make_shared<boost::asio::steady_timer>(*io_context_);
+    window.timeout->expires_after(kRequestTimeout);
+    window.timeout->async_wait(
+        [self_wp{weak_from_this()}, download, index, attempt](
+            const auto &ec) {
+          auto self = self_wp.lock();
+          if (ec or not self or download->finished) {
+            return;
+          }
+          auto &window = download->windows[index];
+          if (window.attempt != attempt or not window.client) {
+            return;
+          }
+          self->logger_->info("Request of blocks from {} to {} timed out",
+                              window.first,
+                              window.last);
+          self->client_stats_[window.client].failures++;
+          self->onWindowFailed(download, index);
+          self->requestWindows(download);
+        });
 
-    return pollClients(request, {}, block_list_handler);
+    client->requestBlocks(
+        request,
+        [self_wp{weak_from_this()},
+         download,
+         index,
+         attempt,
+         started = clock_->now()](auto &&response_res) mutable {
+          if (auto self = self_wp.lock()) {
+            self->onWindowResponse(
+                download, index, attempt, started, std::move(response_res));
+          }
+        });
+  }
+
+  void BabeSynchronizerImpl::onWindowResponse(
+      const std::shared_ptr<RangeDownload> &download,
+      size_t index,
+      size_t attempt,
+      clock::SteadyClock::TimePoint started,
+      outcome::result<network::BlocksResponse> response) {
+    auto &window = download->windows[index];
+    if (download->finished or window.attempt != attempt or not window.client) {
+      // late response for the window, which is already requested elsewhere
+      return;
+    }
+    window.timeout->cancel();
+    auto &stats = client_stats_[window.client];
+
+    // response must contain blocks from window.first to window.last, each of
+    // them being a child of the previous one; extra blocks are ignored
+    std::vector<primitives::Block> blocks;
+    primitives::BlockHash last_hash;
+    if (response) {
+      blocks.reserve(window.last - window.first + 1);
+      for (auto &block_data : response.value().blocks) {
+        if (not block_data.header
+            or block_data.header->number != window.first + blocks.size()
+            or (not blocks.empty()
+                and block_data.header->parent_hash != last_hash)) {
+          break;
+        }
+        // response is not needed after that, so its data is moved
+        auto &block = blocks.emplace_back();
+        block.header = std::move(*block_data.header);
+        if (block_data.body) {
+          block.body = std::move(*block_data.body);
+        }
+        last_hash = block_data.hash;
+        if (block.header.number == window.last) {
+          break;
+        }
+      }
+    }
+    if (blocks.empty() or blocks.back().header.number != window.last) {
+      logger_->debug("Could not get blocks from {} to {}",
+                     window.first,
+                     window.last);
+      stats.failures++;
+      onWindowFailed(download, index);
+      return requestWindows(download);
+    }
+
+    // update measured performance of the client
+    static constexpr double kSmoothing = 0.3;
+    auto elapsed_ms = std::chrono::duration<double, std::milli>(
+                          clock_->now() - started)
+                          .count();
+    auto ms_per_block = elapsed_ms / blocks.size();
+    stats.ms_per_block = stats.ms_per_block == 0
+                             ? ms_per_block
+                             : kSmoothing * ms_per_block
+                                   + (1 - kSmoothing) * stats.ms_per_block;
+    stats.failures = 0;
+
+    download->busy_clients.erase(window.client);
+    window.client.reset();
+    window.timeout.reset();
+    window.blocks = std::move(blocks);
+    window.last_hash = last_hash;
+
+    deliverWindows(download);
+    requestWindows(download);
+  }
+
+  void BabeSynchronizerImpl::onWindowFailed(
+      const std::shared_ptr<RangeDownload> &download, size_t index) {
+    auto &window = download->windows[index];
+    download->busy_clients.erase(window.client);
+    window.failed_clients.insert(window.client);
+    window.client.reset();
+    window.timeout.reset();
+  }
+
+  void BabeSynchronizerImpl::deliverWindows(
+      const std::shared_ptr<RangeDownload> &download) {
+    auto &windows = download->windows;
+    while (download->next_to_deliver < windows.size()
+           and windows[download->next_to_deliver].blocks) {
+      auto &window = windows[download->next_to_deliver];
+      const auto &blocks = window.blocks.value();
+      if (download->last_delivered_hash
+          and blocks.front().header.parent_hash
+                  != *download->last_delivered_hash) {
+        // peers returned windows of different forks; get the rest of the chain
+        // from a single peer
+        logger_->info("Received blocks from {} do not continue the chain",
+                      window.first);
+        download->finished = true;
+        for (auto &w : windows) {
+          if (w.timeout) {
+            w.timeout->cancel();
+          }
+        }
+        network::BlocksRequest request{nextRequestId(),
+                                       network::BlocksRequest::kBasicAttributes,
+                                       *download->last_delivered_hash,
+                                       download->to.block_hash,
+                                       network::Direction::DESCENDING,
+                                       boost::none};
+        return pollClients(
+            std::move(request),
+            {},
+            [download](const std::vector<primitives::Block> &blocks) {
+              download->block_list_handler(blocks);
+              download->finished_handler();
+            });
+      }
+
+      download->block_list_handler(blocks);
+      download->last_delivered_hash = window.last_hash;
+      window.blocks.reset();
+      download->next_to_deliver++;
+    }
+
+    if (download->next_to_deliver == windows.size()) {
+      download->finished = true;
+      download->finished_handler();
+    }
   }
 
-  std::shared_ptr<network::SyncProtocolClient>
-  BabeSynchronizerImpl::selectNextClient(
-      std::unordered_set<std::shared_ptr<network::SyncProtocolClient>>
-          &polled_clients) const {
+  BabeSynchronizerImpl::SyncClient BabeSynchronizerImpl::selectNextClient(
+      std::unordered_set<SyncClient> &polled_clients) const {
     // we want to ask each client until we get the blocks we lack, but the
     // sync_clients_ set can change between the requests, so we need to keep
     // track of the clients we already asked
-    std::shared_ptr<network::SyncProtocolClient> next_client;
-    for (const auto &client : sync_clients_->clients) {
+    SyncClient next_client;
+    for (const auto &client : rankedClients()) {
       if (polled_clients.find(client) == polled_clients.end()) {
         next_client = client;
         polled_clients.insert(client);
@@ -71,37 +337,38 @@ namespace kagome::consensus {
 
   /**
    * Get blocks from resposne
-   * @param response containing block data for blocks
+   * @param response containing block data for blocks, which is moved to the
+   * blocks
    * @return blocks from block data
    */
   boost::optional<std::vector<primitives::Block>> getBlocks(
-      const network::BlocksResponse &response) {
+      network::BlocksResponse &&response) {
     // now we need to check if every block data from response contains header;
     // if any of them does not contain block header, we should proceed to the
     // next client
     std::vector<primitives::Block> blocks;
-    for (const auto &block_data : response.blocks) {
+    blocks.reserve(response.blocks.size());
+    for (auto &block_data : response.blocks) {
       primitives::Block block;
       if (!block_data.header) {
         // that's bad, we can't insert a block, which does not have at
         // least a header
         return boost::none;
       }
-      block.header = *block_data.header;
+      block.header = std::move(*block_data.header);
 
       if (block_data.body) {
-        block.body = *block_data.body;
+        block.body = std::move(*block_data.body);
       }
 
-      blocks.push_back(block);
+      blocks.push_back(std::move(block));
     }
     return blocks;
   }
 
   void BabeSynchronizerImpl::pollClients(
       network::BlocksRequest request,
-      std::unordered_set<std::shared_ptr<network::SyncProtocolClient>>
-          &&polled_clients,
+      std::unordered_set<SyncClient> &&polled_clients,
       const BlocksHandler &requested_blocks_handler) const {
     auto next_client = selectNextClient(polled_clients);
 
@@ -115,7 +382,7 @@ namespace kagome::consensus {
           if (auto self = self_wp.lock()) {
             // if response exists then get blocks and send them to handle
             if (response_res and not response_res.value().blocks.empty()) {
-              auto blocks_opt = getBlocks(response_res.value());
+              auto blocks_opt = getBlocks(std::move(response_res.value()));
               if (blocks_opt) {
                 return requested_blocks_handler(blocks_opt.value());
               }
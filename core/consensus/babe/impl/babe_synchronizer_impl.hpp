@@ -8,6 +8,11 @@
 
 #include "consensus/babe/babe_synchronizer.hpp"
 
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/asio/steady_timer.hpp>
+#include "clock/clock.hpp"
 #include "common/logger.hpp"
 #include "network/types/sync_clients_set.hpp"
 
@@ -15,43 +20,116 @@ namespace kagome::consensus {
 
   /**
    * Implementation of babe synchronizer that requests blocks from provided
-   * peers
+   * peers. Requested range is split into windows, which are downloaded from
+   * several peers concurrently; faster peers are asked first. Downloaded
+   * windows are handed to the handler in order, as soon as they are contiguous
    */
   class BabeSynchronizerImpl
       : public BabeSynchronizer,
         public std::enable_shared_from_this<BabeSynchronizerImpl> {
+    using SyncClient = std::shared_ptr<network::SyncProtocolClient>;
+
    public:
+    /// max number of blocks requested at once
+    static constexpr primitives::BlockNumber kWindowSize = 128;
+    /// max number of windows, which are downloaded ahead of the first
+    /// undelivered one
+    static constexpr size_t kMaxWindowsAhead = 16;
+    /// time after which window is requested from another peer
+    static constexpr std::chrono::seconds kRequestTimeout{10};
+
     ~BabeSynchronizerImpl() override = default;
 
-    explicit BabeSynchronizerImpl(
-        std::shared_ptr<network::SyncClientsSet> sync_clients);
+    BabeSynchronizerImpl(std::shared_ptr<network::SyncClientsSet> sync_clients,
+                         std::shared_ptr<clock::SteadyClock> clock,
+                         std::shared_ptr<boost::asio::io_context> io_context);
 
-    void request(const primitives::BlockId &from,
-                 const primitives::BlockHash &to,
-                 const BlocksHandler &block_list_handler) override;
+    void request(const primitives::BlockInfo &from,
+                 const primitives::BlockInfo &to,
+                 const BlocksHandler &block_list_handler,
+                 const FinishedHandler &finished_handler) override;
 
    private:
+    /// Consecutive blocks downloaded by a single request
+    struct Window {
+      primitives::BlockNumber first;
+      primitives::BlockNumber last;
+      /// client the window is requested from
+      SyncClient client;
+      /// incremented on each request of the window to ignore late responses
+      size_t attempt{0};
+      std::shared_ptr<boost::asio::steady_timer> timeout;
+      std::unordered_set<SyncClient> failed_clients;
+      boost::optional<std::vector<primitives::Block>> blocks;
+      primitives::BlockHash last_hash;
+    };
+
+    /// State of the single request() call
+    struct RangeDownload {
+      primitives::BlockInfo from;
+      primitives::BlockInfo to;
+      BlocksHandler block_list_handler;
+      FinishedHandler finished_handler;
+      std::vector<Window> windows;
+      size_t next_to_deliver{0};
+      boost::optional<primitives::BlockHash> last_delivered_hash;
+      std::unordered_set<SyncClient> busy_clients;
+      bool finished{false};
+    };
+
+    /// Measured performance of a client
+    struct ClientStats {
+      /// exponential moving average of time spent per block
+      double ms_per_block{0};
+      size_t failures{0};
+    };
+
+    /// Request windows of \param download from the idle clients
+    void requestWindows(const std::shared_ptr<RangeDownload> &download);
+
+    /// Request window \param index of \param download from \param client
+    void requestWindow(const std::shared_ptr<RangeDownload> &download,
+                       size_t index,
+                       const SyncClient &client);
+
+    /// Handle response for the \param attempt of window \param index
+    void onWindowResponse(const std::shared_ptr<RangeDownload> &download,
+                          size_t index,
+                          size_t attempt,
+                          clock::SteadyClock::TimePoint started,
+                          outcome::result<network::BlocksResponse> response);
+
+    /// Make window \param index available to be requested from other clients
+    void onWindowFailed(const std::shared_ptr<RangeDownload> &download,
+                        size_t index);
+
+    /// Hand the contiguous downloaded windows to the handler
+    void deliverWindows(const std::shared_ptr<RangeDownload> &download);
+
+    /// @return clients ordered from the best to the worst
+    std::vector<SyncClient> rankedClients() const;
+
     /**
      * Select next client to be polled
      * @param polled_clients clients that we already polled
      * @return next clint to be polled
      */
-    std::shared_ptr<network::SyncProtocolClient> selectNextClient(
-        std::unordered_set<std::shared_ptr<network::SyncProtocolClient>>
-            &polled_clients) const;
+    SyncClient selectNextClient(
+        std::unordered_set<SyncClient> &polled_clients) const;
     /**
-     * Request blocks from provided peers
+     * Request blocks from provided peers one by one until they are received
      * @param request block request message
      * @param polled_clients peers that were already requested
      * @param requested_blocks_handler handler of received blocks
      */
-    void pollClients(
-        network::BlocksRequest request,
-        std::unordered_set<std::shared_ptr<network::SyncProtocolClient>>
-            &&polled_clients,
-        const BlocksHandler &requested_blocks_handler) const;
+    void pollClients(network::BlocksRequest request,
+                     std::unordered_set<SyncClient> &&polled_clients,
+                     const BlocksHandler &requested_blocks_handler) const;
 
     std::shared_ptr<network::SyncClientsSet> sync_clients_;
+    std::shared_ptr<clock::SteadyClock> clock_;
+    std::shared_ptr<boost::asio::io_context> io_context_;
+    std::unordered_map<SyncClient, ClientStats> client_stats_;
     common::Logger logger_;
   };
 }  // namespace kagome::consensus
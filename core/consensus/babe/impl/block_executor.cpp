@@ -5,6 +5,9 @@
 
 #include "consensus/babe/impl/block_executor.hpp"
 
+#include <deque>
+
+#include <boost/asio/post.hpp>
 #include "blockchain/block_tree_error.hpp"
 #include "consensus/babe/impl/babe_digests_util.hpp"
 #include "consensus/babe/impl/threshold_util.hpp"
@@ -19,7 +22,9 @@ namespace kagome::consensus {
       std::shared_ptr<consensus::BabeSynchronizer> babe_synchronizer,
       std::shared_ptr<consensus::BlockValidator> block_validator,
       std::shared_ptr<consensus::EpochStorage> epoch_storage,
-      std::shared_ptr<crypto::Hasher> hasher)
+      std::shared_ptr<crypto::Hasher> hasher,
+      std::shared_ptr<transaction_pool::PoolRevalidator> pool_revalidator,
+      Params params)
       : block_tree_{std::move(block_tree)},
         core_{std::move(core)},
         genesis_configuration_{std::move(configuration)},
@@ -27,6 +32,10 @@ namespace kagome::consensus {
         block_validator_{std::move(block_validator)},
         epoch_storage_{std::move(epoch_storage)},
         hasher_{std::move(hasher)},
+        pool_revalidator_{std::move(pool_revalidator)},
+        sync_request_scheduler_{std::make_shared<SyncRequestScheduler>(
+            block_tree_, babe_synchronizer_)},
+        verification_workers_{params.verification_workers},
         logger_{common::createLogger("BlockExecutor")} {
     BOOST_ASSERT(block_tree_ != nullptr);
     BOOST_ASSERT(core_ != nullptr);
@@ -35,18 +44,25 @@ namespace kagome::consensus {
     BOOST_ASSERT(block_validator_ != nullptr);
     BOOST_ASSERT(epoch_storage_ != nullptr);
     BOOST_ASSERT(hasher_ != nullptr);
+    BOOST_ASSERT(pool_revalidator_ != nullptr);
     BOOST_ASSERT(logger_ != nullptr);
   }
 
+  BlockExecutor::~BlockExecutor() {
+    verification_workers_.join();
+  }
+
   void BlockExecutor::processNextBlock(
       const primitives::BlockHeader &header,
       const std::function<void(const primitives::BlockHeader &)>
           &new_block_handler) {
-    auto block_hash = hasher_->blake2b_256(scale::encode(header).value());
+    primitives::HashedHeader hashed_header{header, hasher_};
+    const auto &block_hash = hashed_header.hash();
 
     // insert block_header if it is missing
     if (not block_tree_->getBlockHeader(block_hash)) {
-      if (auto add_res = block_tree_->addBlockHeader(header); not add_res) {
+      if (auto add_res = block_tree_->addBlockHeader(hashed_header);
+          not add_res) {
         logger_->warn(
             "Could not add block header during import. Number: {}, Hash: {}, "
             "Reason: {}",
@@ -61,84 +77,130 @@ namespace kagome::consensus {
                       header.number,
                       block_hash.toHex());
       }
-      const auto &[last_number, last_hash] = block_tree_->getLastFinalized();
-
       // we should request blocks between last finalized one and received block
-      requestBlocks(last_hash, block_hash, [] {});
+      requestBlocks(primitives::BlockInfo{header.number, block_hash},
+                    header.parent_hash,
+                    [] {});
     }
   }
 
   void BlockExecutor::requestBlocks(const primitives::BlockHeader &new_header,
                                     std::function<void()> &&next) {
-    const auto &[last_number, last_hash] = block_tree_->getLastFinalized();
+    BOOST_ASSERT(new_header.number
+                 >= block_tree_->getLastFinalized().block_number);
     auto new_block_hash =
         hasher_->blake2b_256(scale::encode(new_header).value());
-    BOOST_ASSERT(new_header.number >= last_number);
-    return requestBlocks(last_hash, new_block_hash, std::move(next));
+    return requestBlocks(
+        primitives::BlockInfo{new_header.number, new_block_hash},
+        new_header.parent_hash,
+        std::move(next));
   }
 
-  void BlockExecutor::requestBlocks(const primitives::BlockId &from,
-                                    const primitives::BlockHash &to,
+  void BlockExecutor::requestBlocks(const primitives::BlockInfo &to,
+                                    const primitives::BlockHash &parent_hash,
                                     std::function<void()> &&next) {
-    babe_synchronizer_->request(
-        from,
+    sync_request_scheduler_->schedule(
         to,
-        [self_wp{weak_from_this()},
-         next(std::move(next))](const std::vector<primitives::Block> &blocks) {
+        parent_hash,
+        [self_wp{weak_from_this()}](
+            const std::vector<primitives::Block> &blocks) {
           auto self = self_wp.lock();
           if (not self) return;
 
           if (blocks.empty()) {
             self->logger_->warn("Received empty list of blocks");
           } else {
-            auto front_block_hex =
-                self->hasher_
-                    ->blake2b_256(scale::encode(blocks.front().header).value())
-                    .toHex();
-            auto back_block_hex =
-                self->hasher_
-                    ->blake2b_256(scale::encode(blocks.back().header).value())
-                    .toHex();
+            // blocks are hashed once they are applied
             self->logger_->info("Received blocks from: {}, to {}",
-                                front_block_hex,
-                                back_block_hex);
-          }
-          for (const auto &block : blocks) {
-            if (auto apply_res = self->applyBlock(block); not apply_res) {
-              if (apply_res
-                  == outcome::failure(
-                         blockchain::BlockTreeError::BLOCK_EXISTS)) {
-                continue;
-              }
-              self->logger_->error(
-                  "Could not apply block during synchronizing slots.Error: {}",
-                  apply_res.error().message());
-            }
+                                blocks.front().header.number,
+                                blocks.back().header.number);
           }
-          next();
-        });
+          self->applyBlocks(blocks);
+        },
+        std::move(next));
   }
 
-  outcome::result<void> BlockExecutor::applyBlock(
-      const primitives::Block &block) {
-    auto block_hash = hasher_->blake2b_256(scale::encode(block.header).value());
+  void BlockExecutor::applyBlocks(const std::vector<primitives::Block> &blocks) {
+    std::unordered_map<EpochIndex, NextEpochDescriptor> next_epochs;
+    std::deque<std::future<VerifiedHeader>> verified_headers;
+    size_t verified_end = 0;
+    for (size_t i = 0; i < blocks.size(); ++i) {
+      // keep headers of the next blocks being verified, while the current one
+      // is executed
+      for (; verified_end < blocks.size()
+             and verified_end <= i + kVerificationLookahead;
+           ++verified_end) {
+        verified_headers.push_back(
+            verifyHeader(blocks[verified_end].header, next_epochs));
+      }
+      auto verified_header = verified_headers.front().get();
+      verified_headers.pop_front();
 
-    // check if block body already exists. If so, do not apply
-    if (block_tree_->getBlockBody(block_hash)) {
-      return blockchain::BlockTreeError::BLOCK_EXISTS;
+      if (auto apply_res = applyBlock(blocks[i], verified_header);
+          not apply_res) {
+        if (apply_res
+            == outcome::failure(blockchain::BlockTreeError::BLOCK_EXISTS)) {
+          continue;
+        }
+        logger_->error(
+            "Could not apply block during synchronizing slots.Error: {}",
+            apply_res.error().message());
+      }
     }
-    logger_->info(
-        "Applying block number: {}, hash: {}",
-        block.header.number,
-        hasher_->blake2b_256(scale::encode(block.header).value()).toHex());
-
-    OUTCOME_TRY(babe_digests, getBabeDigests(block.header));
+  }
 
-    auto [seal, babe_header] = babe_digests;
+  std::future<BlockExecutor::VerifiedHeader> BlockExecutor::verifyHeader(
+      const primitives::BlockHeader &header,
+      std::unordered_map<EpochIndex, NextEpochDescriptor> &next_epochs) {
+    auto promise = std::make_shared<std::promise<VerifiedHeader>>();
+    auto future = promise->get_future();
 
+    // digests are cheap to decode and needed to find the epoch of the block, so
+    // it is done here in the order of blocks
+    auto babe_digests_res = getBabeDigests(header);
+    if (not babe_digests_res) {
+      promise->set_value({primitives::HashedHeader{header, hasher_},
+                          babe_digests_res.error()});
+      return future;
+    }
+    const auto &babe_header = babe_digests_res.value().second;
     auto epoch_index =
         babe_header.slot_number / genesis_configuration_->epoch_length;
 
+    auto epoch_it = next_epochs.find(epoch_index);
+    auto epoch_descriptor = epoch_it != next_epochs.end()
+                                ? epoch_it->second
+                                : getEpochDescriptor(epoch_index);
+    if (auto next_epoch_digest_res = getNextEpochDigest(header)) {
+      next_epochs[epoch_index + 2] = next_epoch_digest_res.value();
+    }
+
+    auto threshold = calculateThreshold(genesis_configuration_->leadership_rate,
+                                        epoch_descriptor.authorities,
+                                        babe_header.authority_index);
+
+    boost::asio::post(
+        verification_workers_,
+        [promise,
+         header,
+         authority =
+             epoch_descriptor.authorities[babe_header.authority_index].id,
+         threshold,
+         randomness = epoch_descriptor.randomness,
+         block_validator = block_validator_,
+         hasher = hasher_] {
+          // encoding and hashes of the header are taken here once and reused
+          // by the validation and the storage
+          primitives::HashedHeader hashed_header{header, hasher};
+          auto result = block_validator->validateHeaderSignatures(
+              hashed_header, authority, threshold, randomness);
+          promise->set_value({std::move(hashed_header), std::move(result)});
+        });
+    return future;
+  }
+
+  NextEpochDescriptor BlockExecutor::getEpochDescriptor(
+      EpochIndex epoch_index) const {
     // TODO (kamilsa): PRE-364 uncomment outcome try and remove dirty workaround
     // below
     //    OUTCOME_TRY(this_block_epoch_descriptor,
@@ -148,15 +210,31 @@ namespace kagome::consensus {
     if (not this_block_epoch_descriptor_res) {  // take authorities and
                                                 // randomness
                                                 // from config
-      this_block_epoch_descriptor_res = NextEpochDescriptor{
+      return NextEpochDescriptor{
           .authorities = genesis_configuration_->genesis_authorities,
           .randomness = genesis_configuration_->randomness};
     }
-    auto this_block_epoch_descriptor = this_block_epoch_descriptor_res.value();
+    return this_block_epoch_descriptor_res.value();
+  }
 
-    auto threshold = calculateThreshold(genesis_configuration_->leadership_rate,
-                                        this_block_epoch_descriptor.authorities,
-                                        babe_header.authority_index);
+  outcome::result<void> BlockExecutor::applyBlock(
+      const primitives::Block &block, const VerifiedHeader &verified_header) {
+    const auto &block_hash = verified_header.header.hash();
+
+    // check if block body already exists. If so, do not apply
+    if (block_tree_->getBlockBody(block_hash)) {
+      return blockchain::BlockTreeError::BLOCK_EXISTS;
+    }
+    logger_->info("Applying block number: {}, hash: {}",
+                  block.header.number,
+                  block_hash.toHex());
+
+    OUTCOME_TRY(babe_digests, getBabeDigests(block.header));
+
+    auto [seal, babe_header] = babe_digests;
+
+    auto epoch_index =
+        babe_header.slot_number / genesis_configuration_->epoch_length;
 
     // update authorities and randomnesss
     auto next_epoch_digest_res = getNextEpochDigest(block.header);
@@ -166,11 +244,10 @@ namespace kagome::consensus {
           epoch_index + 2, next_epoch_digest_res.value()));
     }
 
-    OUTCOME_TRY(block_validator_->validateHeader(
-        block.header,
-        this_block_epoch_descriptor.authorities[babe_header.authority_index].id,
-        threshold,
-        this_block_epoch_descriptor.randomness));
+    // seal and VRF were checked in advance, producer can be checked only in
+    // the order of blocks
+    OUTCOME_TRY(verified_header.result);
+    OUTCOME_TRY(block_validator_->validateHeaderProducer(block.header));
 
     auto block_without_seal_digest = block;
 
@@ -181,7 +258,7 @@ namespace kagome::consensus {
 
     // add block header if it does not exist
     if (not block_tree_->getBlockHeader(block_hash).has_value()) {
-      OUTCOME_TRY(block_tree_->addBlockHeader(block.header));
+      OUTCOME_TRY(block_tree_->addBlockHeader(verified_header.header));
     }
     OUTCOME_TRY(
         block_tree_->addBlockBody(block.header.number, block_hash, block.body));
@@ -189,6 +266,8 @@ namespace kagome::consensus {
     logger_->info("Imported block with number: {}, hash: {}",
                   block.header.number,
                   block_hash.toHex());
+
+    pool_revalidator_->onBlockImported(block);
     return outcome::success();
   }
 
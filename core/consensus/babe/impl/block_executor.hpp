@@ -6,27 +6,54 @@
 #ifndef KAGOME_CORE_CONSENSUS_BABE_IMPL_BLOCK_EXECUTOR_HPP
 #define KAGOME_CORE_CONSENSUS_BABE_IMPL_BLOCK_EXECUTOR_HPP
 
+#include <future>
+#include <unordered_map>
+
+#include <boost/asio/thread_pool.hpp>
 #include "blockchain/block_tree.hpp"
 #include "common/logger.hpp"
 #include "consensus/babe/babe_synchronizer.hpp"
 #include "consensus/babe/epoch_storage.hpp"
+#include "consensus/babe/impl/sync_request_scheduler.hpp"
 #include "consensus/validation/block_validator.hpp"
 #include "crypto/hasher.hpp"
 #include "primitives/babe_configuration.hpp"
 #include "primitives/block_header.hpp"
+#include "primitives/hashed_header.hpp"
 #include "runtime/core.hpp"
+#include "transaction_pool/pool_revalidator.hpp"
 
 namespace kagome::consensus {
 
+  /**
+   * Imports blocks. Blocks are applied to the state on the thread of the
+   * io_context, which owns the block tree and the runtime; the worker threads
+   * only verify the headers and touch neither the storage nor the runtime
+   */
   class BlockExecutor : public std::enable_shared_from_this<BlockExecutor> {
    public:
+    /// number of blocks after the executed one, which headers are verified
+    /// in advance
+    static constexpr size_t kVerificationLookahead = 16;
+
+    struct Params {
+      /// number of threads, which verify headers, while blocks are executed
+      /// on the io_context thread
+      size_t verification_workers{1};
+    };
+
+    ~BlockExecutor();
+
     BlockExecutor(std::shared_ptr<blockchain::BlockTree> block_tree,
                   std::shared_ptr<runtime::Core> core,
                   std::shared_ptr<primitives::BabeConfiguration> configuration,
                   std::shared_ptr<BabeSynchronizer> babe_synchronizer,
                   std::shared_ptr<BlockValidator> block_validator,
                   std::shared_ptr<EpochStorage> epoch_storage,
-                  std::shared_ptr<crypto::Hasher> hasher);
+                  std::shared_ptr<crypto::Hasher> hasher,
+                  std::shared_ptr<transaction_pool::PoolRevalidator>
+                      pool_revalidator,
+                  Params params);
 
     /**
      * Processes next header: if header is observed first it is added to the
@@ -42,26 +69,53 @@ namespace kagome::consensus {
             &new_block_handler);
 
     /**
-     * Synchronize all missing blocks between the last finalized and the new one
+     * Synchronize all missing blocks between the last finalized and the new
+     * one. Blocks, which are already imported or being downloaded, are not
+     * requested again
      * @param new_header header defining new block
      * @param next action after the sync is done
      */
     void requestBlocks(const primitives::BlockHeader &new_header,
                        std::function<void()> &&next);
 
+   private:
     /**
-     * Synchronize all missing blocks between provided blocks (from and to)
-     * @param from starting block of syncing blocks
-     * @param to last block of syncing block
+     * Synchronize missing blocks up to \param to
+     * @param parent_hash hash of the parent of \param to
      * @param next action after the sync is done
      */
-    void requestBlocks(const primitives::BlockId &from,
-                       const primitives::BlockHash &to,
+    void requestBlocks(const primitives::BlockInfo &to,
+                       const primitives::BlockHash &parent_hash,
                        std::function<void()> &&next);
 
-   private:
+    /// Result of the checks of the header, which do not depend on the state
+    struct VerifiedHeader {
+      primitives::HashedHeader header;
+      outcome::result<void> result;
+    };
+
+    /**
+     * Apply \param blocks one by one. Headers of the next blocks are verified
+     * on the worker threads, while the current block is executed
+     */
+    void applyBlocks(const std::vector<primitives::Block> &blocks);
+
+    /**
+     * Launch verification of seal and VRF of the \param header on the worker
+     * threads. Must be invoked in the order of blocks
+     * @param next_epochs descriptors of the epochs announced by the headers,
+     * which are passed to this method before, but are not applied yet
+     */
+    std::future<VerifiedHeader> verifyHeader(
+        const primitives::BlockHeader &header,
+        std::unordered_map<EpochIndex, NextEpochDescriptor> &next_epochs);
+
+    /// @return descriptor of the epoch \param epoch_index
+    NextEpochDescriptor getEpochDescriptor(EpochIndex epoch_index) const;
+
     // should only be invoked when parent of block exists
-    outcome::result<void> applyBlock(const primitives::Block &block);
+    outcome::result<void> applyBlock(const primitives::Block &block,
+                                     const VerifiedHeader &verified_header);
 
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<runtime::Core> core_;
@@ -70,6 +124,9 @@ namespace kagome::consensus {
     std::shared_ptr<BlockValidator> block_validator_;
     std::shared_ptr<EpochStorage> epoch_storage_;
     std::shared_ptr<crypto::Hasher> hasher_;
+    std::shared_ptr<transaction_pool::PoolRevalidator> pool_revalidator_;
+    std::shared_ptr<SyncRequestScheduler> sync_request_scheduler_;
+    boost::asio::thread_pool verification_workers_;
 
     common::Logger logger_;
   };
@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/babe/impl/sync_request_scheduler.hpp"
+
+namespace kagome::consensus {
+
+  SyncRequestScheduler::SyncRequestScheduler(
+      std::shared_ptr<blockchain::BlockTree> block_tree,
+      std::shared_ptr<BabeSynchronizer> babe_synchronizer)
+      : block_tree_{std::move(block_tree)},
+        babe_synchronizer_{std::move(babe_synchronizer)},
+        logger_{common::createLogger("SyncRequestScheduler")} {
+    BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(babe_synchronizer_ != nullptr);
+  }
+
+  void SyncRequestScheduler::schedule(const primitives::BlockInfo &to,
+                                      const primitives::BlockHash &parent_hash,
+                                      const BlocksHandler &blocks_handler,
+                                      FinishedHandler finished_handler) {
+    if (isImported(to.block_hash)) {
+      return finished_handler();
+    }
+    if (auto it = requests_.find(to.block_hash); it != requests_.end()) {
+      logger_->debug("Block {} is already requested", to.block_number);
+      it->second->finished_handlers.push_back(std::move(finished_handler));
+      return;
+    }
+
+    // find the closest ancestor, which is either imported or requested;
+    // headers of the announced blocks are stored, so the chain can be followed
+    // while they are known
+    auto base = block_tree_->getLastFinalized();
+    std::shared_ptr<Request> base_request;
+    if (to.block_number > base.block_number) {
+      primitives::BlockInfo ancestor{to.block_number - 1, parent_hash};
+      while (ancestor.block_number > base.block_number) {
+        if (auto it = requests_.find(ancestor.block_hash);
+            it != requests_.end()) {
+          base_request = it->second;
+          break;
+        }
+        if (isImported(ancestor.block_hash)) {
+          base = ancestor;
+          break;
+        }
+        auto header_res = block_tree_->getBlockHeader(ancestor.block_hash);
+        if (not header_res) {
+          break;
+        }
+        ancestor = {ancestor.block_number - 1, header_res.value().parent_hash};
+      }
+    }
+
+    if (base_request and not base_request->started) {
+      // request is not sent yet, so it can be extended to the new block
+      logger_->debug("Request of blocks up to {} is extended to {}",
+                     base_request->to.block_number,
+                     to.block_number);
+      requests_.erase(base_request->to.block_hash);
+      base_request->to = to;
+      base_request->finished_handlers.push_back(std::move(finished_handler));
+      requests_.emplace(to.block_hash, base_request);
+      return;
+    }
+
+    auto request = std::make_shared<Request>();
+    request->from = base_request ? base_request->to : base;
+    request->to = to;
+    request->blocks_handler = blocks_handler;
+    request->finished_handlers.push_back(std::move(finished_handler));
+    requests_.emplace(to.block_hash, request);
+    if (base_request) {
+      logger_->debug("Blocks from {} to {} are requested after {}",
+                     request->from.block_number,
+                     to.block_number,
+                     base_request->to.block_number);
+      base_request->dependents.push_back(std::move(request));
+      return;
+    }
+    start(request);
+  }
+
+  size_t SyncRequestScheduler::size() const {
+    return requests_.size();
+  }
+
+  void SyncRequestScheduler::start(const std::shared_ptr<Request> &request) {
+    if (isImported(request->to.block_hash)) {
+      return onFinished(request);
+    }
+    request->started = true;
+    babe_synchronizer_->request(
+        request->from,
+        request->to,
+        request->blocks_handler,
+        [self_wp{weak_from_this()}, request] {
+          if (auto self = self_wp.lock()) {
+            self->onFinished(request);
+          }
+        });
+  }
+
+  void SyncRequestScheduler::onFinished(
+      const std::shared_ptr<Request> &request) {
+    requests_.erase(request->to.block_hash);
+    auto finished_handlers = std::move(request->finished_handlers);
+    auto dependents = std::move(request->dependents);
+    for (auto &handler : finished_handlers) {
+      handler();
+    }
+    for (auto &dependent : dependents) {
+      start(dependent);
+    }
+  }
+
+  bool SyncRequestScheduler::isImported(
+      const primitives::BlockHash &hash) const {
+    return block_tree_->getBlockBody(hash).has_value();
+  }
+
+}  // namespace kagome::consensus
@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_CONSENSUS_BABE_IMPL_SYNC_REQUEST_SCHEDULER_HPP
+#define KAGOME_CORE_CONSENSUS_BABE_IMPL_SYNC_REQUEST_SCHEDULER_HPP
+
+#include <unordered_map>
+
+#include "blockchain/block_tree.hpp"
+#include "common/logger.hpp"
+#include "consensus/babe/babe_synchronizer.hpp"
+
+namespace kagome::consensus {
+
+  /**
+   * Schedules requests of the missing blocks to the babe synchronizer. Only
+   * the part of the chain, which is neither imported nor being downloaded, is
+   * requested: announce of the block, which continues a chain being
+   * downloaded, is coalesced into a single follow-up request of that chain
+   */
+  class SyncRequestScheduler
+      : public std::enable_shared_from_this<SyncRequestScheduler> {
+   public:
+    using BlocksHandler = BabeSynchronizer::BlocksHandler;
+    using FinishedHandler = BabeSynchronizer::FinishedHandler;
+
+    SyncRequestScheduler(std::shared_ptr<blockchain::BlockTree> block_tree,
+                         std::shared_ptr<BabeSynchronizer> babe_synchronizer);
+
+    /**
+     * Get the blocks between the last finalized one and \param to
+     * @param parent_hash hash of the parent of \param to
+     * @param blocks_handler handles downloaded blocks
+     * @param finished_handler invoked after block \param to is downloaded and
+     * handled
+     */
+    void schedule(const primitives::BlockInfo &to,
+                  const primitives::BlockHash &parent_hash,
+                  const BlocksHandler &blocks_handler,
+                  FinishedHandler finished_handler);
+
+    /// @return number of requests, which are being downloaded or wait for
+    /// their base to be downloaded
+    size_t size() const;
+
+   private:
+    /// Request of the chain of blocks from \a from to \a to
+    struct Request {
+      primitives::BlockInfo from;
+      primitives::BlockInfo to;
+      BlocksHandler blocks_handler;
+      std::vector<FinishedHandler> finished_handlers;
+      /// requests, which start from the last block of this one, so they wait
+      /// until it is downloaded
+      std::vector<std::shared_ptr<Request>> dependents;
+      bool started{false};
+    };
+
+    /// Pass \param request to the synchronizer
+    void start(const std::shared_ptr<Request> &request);
+
+    /// Finish \param request and start requests, which depend on it
+    void onFinished(const std::shared_ptr<Request> &request);
+
+    /// @return true if body of \param hash is in the storage
+    bool isImported(const primitives::BlockHash &hash) const;
+
+    std::shared_ptr<blockchain::BlockTree> block_tree_;
+    std::shared_ptr<BabeSynchronizer> babe_synchronizer_;
+    /// scheduled requests by the hash of their last block
+    std::unordered_map<primitives::BlockHash, std::shared_ptr<Request>>
+        requests_;
+    common::Logger logger_;
+  };
+
+}  // namespace kagome::consensus
+
+#endif  // KAGOME_CORE_CONSENSUS_BABE_IMPL_SYNC_REQUEST_SCHEDULER_HPP
@@ -42,8 +42,8 @@ namespace kagome::consensus::grandpa {
      * @returns true if {@param block} is a descendent of or equal to the
      * given {@param base}.
      */
-    inline bool isEqualOrDescendOf(const primitives::BlockHash &base,
-                            const primitives::BlockHash &block) const {
+    virtual bool isEqualOrDescendOf(const primitives::BlockHash &base,
+                                    const primitives::BlockHash &block) const {
       return base == block ? true : getAncestry(base, block).has_value();
     }
   };
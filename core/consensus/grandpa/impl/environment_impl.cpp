@@ -40,6 +40,11 @@ namespace kagome::consensus::grandpa {
     return result_chain;
   }
 
+  bool EnvironmentImpl::isEqualOrDescendOf(const BlockHash &base,
+                                           const BlockHash &block) const {
+    return block_tree_->hasDirectChain(base, block);
+  }
+
   outcome::result<BlockInfo> EnvironmentImpl::bestChainContaining(
       const BlockHash &base) const {
     logger_->debug("Finding best chain containing block {}", base.toHex());
@@ -23,15 +23,19 @@ namespace kagome::consensus::grandpa {
       std::shared_ptr<storage::BufferStorage> storage,
       std::shared_ptr<crypto::ED25519Provider> crypto_provider,
       const crypto::ED25519Keypair &keypair,
+      std::shared_ptr<crypto::Hasher> hasher,
       std::shared_ptr<Clock> clock,
-      std::shared_ptr<boost::asio::io_context> io_context)
+      std::shared_ptr<boost::asio::io_context> io_context,
+      Params params)
       : environment_{std::move(environment)},
         storage_{std::move(storage)},
         crypto_provider_{std::move(crypto_provider)},
         keypair_{keypair},
         clock_{std::move(clock)},
         io_context_{std::move(io_context)},
-        liveness_checker_{*io_context_} {
+        liveness_checker_{*io_context_},
+        vote_verifier_{std::make_shared<VoteVerifier>(
+            std::move(hasher), io_context_, params.vote_verification_workers)} {
     BOOST_ASSERT(environment_ != nullptr);
     BOOST_ASSERT(storage_ != nullptr);
     BOOST_ASSERT(crypto_provider_ != nullptr);
@@ -127,6 +131,7 @@ namespace kagome::consensus::grandpa {
                          .peer_id = keypair_.public_key};
     auto &&vote_crypto_provider = std::make_shared<VoteCryptoProviderImpl>(
         keypair_, crypto_provider_, round_number, voters);
+    current_vote_crypto_provider_ = vote_crypto_provider;
 
     current_round_ =
         std::make_shared<VotingRoundImpl>(std::move(config),
@@ -175,21 +180,38 @@ namespace kagome::consensus::grandpa {
   }
 
   void LauncherImpl::onVoteMessage(const VoteMessage &msg) {
+    if (current_round_ == nullptr
+        or msg.round_number != current_round_->roundNumber()) {
+      return;
+    }
+    vote_verifier_->verify(
+        msg,
+        current_vote_crypto_provider_,
+        [self_weak{weak_from_this()}](const VoteMessage &verified_msg) {
+          if (auto self = self_weak.lock()) {
+            self->onVerifiedVoteMessage(verified_msg);
+          }
+        });
+  }
+
+  void LauncherImpl::onVerifiedVoteMessage(const VoteMessage &msg) {
     auto current_round = current_round_;
-    auto current_round_number = current_round->roundNumber();
-    if (msg.round_number == current_round_number) {
-      visit_in_place(
-          msg.vote,
-          [&current_round](const SignedPrimaryPropose &primary_propose) {
-            current_round->onPrimaryPropose(primary_propose);
-          },
-          [&current_round](const SignedPrevote &prevote) {
-            current_round->onPrevote(prevote);
-          },
-          [&current_round](const SignedPrecommit &precommit) {
-            current_round->onPrecommit(precommit);
-          });
+    // round might be changed while vote was verified
+    if (current_round == nullptr
+        or msg.round_number != current_round->roundNumber()) {
+      return;
     }
+    visit_in_place(
+        msg.vote,
+        [&current_round](const SignedPrimaryPropose &primary_propose) {
+          current_round->onPrimaryPropose(primary_propose);
+        },
+        [&current_round](const SignedPrevote &prevote) {
+          current_round->onPrevote(prevote);
+        },
+        [&current_round](const SignedPrecommit &precommit) {
+          current_round->onPrecommit(precommit);
+        });
   }
 
   void LauncherImpl::onFinalize(const Fin &f) {
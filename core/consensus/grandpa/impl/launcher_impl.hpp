@@ -10,10 +10,12 @@
 #include "common/logger.hpp"
 #include "consensus/grandpa/completed_round.hpp"
 #include "consensus/grandpa/environment.hpp"
+#include "consensus/grandpa/impl/vote_verifier.hpp"
 #include "consensus/grandpa/launcher.hpp"
 #include "consensus/grandpa/voter_set.hpp"
 #include "consensus/grandpa/voting_round.hpp"
 #include "crypto/ed25519_provider.hpp"
+#include "crypto/hasher.hpp"
 #include "network/gossiper.hpp"
 #include "storage/buffer_map_types.hpp"
 
@@ -22,14 +24,21 @@ namespace kagome::consensus::grandpa {
   class LauncherImpl : public Launcher,
                        public std::enable_shared_from_this<LauncherImpl> {
    public:
+    struct Params {
+      /// number of threads, which verify signatures of the votes
+      size_t vote_verification_workers{1};
+    };
+
     ~LauncherImpl() override = default;
 
     LauncherImpl(std::shared_ptr<Environment> environment,
                  std::shared_ptr<storage::BufferStorage> storage,
                  std::shared_ptr<crypto::ED25519Provider> crypto_provider,
                  const crypto::ED25519Keypair &keypair,
+                 std::shared_ptr<crypto::Hasher> hasher,
                  std::shared_ptr<Clock> clock,
-                 std::shared_ptr<boost::asio::io_context> io_context);
+                 std::shared_ptr<boost::asio::io_context> io_context,
+                 Params params);
 
     void start() override;
 
@@ -41,6 +50,10 @@ namespace kagome::consensus::grandpa {
      */
     void startLivenessChecker();
 
+    /**
+     * Votes for the current round are passed to the current round after their
+     * signatures are verified by the vote verifier (\see VoteVerifier)
+     */
     void onVoteMessage(const VoteMessage &msg) override;
 
     void onFinalize(const Fin &f) override;
@@ -51,7 +64,11 @@ namespace kagome::consensus::grandpa {
     outcome::result<std::shared_ptr<VoterSet>> getVoters() const;
     outcome::result<CompletedRound> getLastCompletedRound() const;
 
+    /// Pass verified \param msg to the current round if it is still actual
+    void onVerifiedVoteMessage(const VoteMessage &msg);
+
     std::shared_ptr<VotingRound> current_round_;
+    std::shared_ptr<VoteCryptoProvider> current_vote_crypto_provider_;
 
     std::shared_ptr<Environment> environment_;
     std::shared_ptr<storage::BufferStorage> storage_;
@@ -60,6 +77,7 @@ namespace kagome::consensus::grandpa {
     std::shared_ptr<Clock> clock_;
     std::shared_ptr<boost::asio::io_context> io_context_;
     Timer liveness_checker_;
+    std::shared_ptr<VoteVerifier> vote_verifier_;
 
     common::Logger logger_ = common::createLogger("Grandpa launcher");
   };
@@ -0,0 +1,116 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/grandpa/impl/vote_verifier.hpp"
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/post.hpp>
+
+#include "common/visitor.hpp"
+#include "scale/scale.hpp"
+
+namespace kagome::consensus::grandpa {
+
+  VoteVerifier::VoteVerifier(
+      std::shared_ptr<crypto::Hasher> hasher,
+      std::shared_ptr<boost::asio::io_context> io_context,
+      size_t workers,
+      size_t seen_capacity)
+      : hasher_{std::move(hasher)},
+        io_context_{std::move(io_context)},
+        workers_{workers},
+        seen_capacity_{seen_capacity} {
+    BOOST_ASSERT(hasher_ != nullptr);
+    BOOST_ASSERT(io_context_ != nullptr);
+    BOOST_ASSERT(workers > 0);
+    BOOST_ASSERT(seen_capacity_ > 0);
+  }
+
+  VoteVerifier::~VoteVerifier() {
+    // votes, which are not verified yet, are not needed anymore
+    workers_.stop();
+    workers_.join();
+  }
+
+  void VoteVerifier::verify(const VoteMessage &msg,
+                            std::shared_ptr<VoteCryptoProvider> crypto_provider,
+                            OnVerified on_verified) {
+    BOOST_ASSERT(crypto_provider != nullptr);
+    auto encoded = scale::encode(msg);
+    if (not encoded) {
+      logger_->error("Could not encode vote message: {}",
+                     encoded.error().message());
+      return;
+    }
+    if (not markSeen(hasher_->blake2b_256(encoded.value()))) {
+      logger_->trace("Vote of round {} was already seen", msg.round_number);
+      return;
+    }
+
+    boost::asio::post(
+        workers_,
+        [self_weak{weak_from_this()},
+         work = boost::asio::make_work_guard(*io_context_),
+         io_context = io_context_,
+         seq = next_seq_++,
+         msg,
+         crypto_provider = std::move(crypto_provider),
+         on_verified = std::move(on_verified)]() mutable {
+          bool verified = visit_in_place(
+              msg.vote,
+              [&](const SignedPrimaryPropose &primary_propose) {
+                return crypto_provider->verifyPrimaryPropose(primary_propose);
+              },
+              [&](const SignedPrevote &prevote) {
+                return crypto_provider->verifyPrevote(prevote);
+              },
+              [&](const SignedPrecommit &precommit) {
+                return crypto_provider->verifyPrecommit(precommit);
+              });
+
+          std::function<void()> deliver;
+          if (verified) {
+            deliver = [msg = std::move(msg),
+                       on_verified = std::move(on_verified)] {
+              on_verified(msg);
+            };
+          }
+          boost::asio::post(*io_context,
+                            [self_weak = std::move(self_weak),
+                             seq,
+                             deliver = std::move(deliver)]() mutable {
+                              if (auto self = self_weak.lock()) {
+                                self->onVerified(seq, std::move(deliver));
+                              }
+                            });
+        });
+  }
+
+  bool VoteVerifier::markSeen(const common::Hash256 &hash) {
+    if (not seen_.insert(hash).second) {
+      return false;
+    }
+    seen_order_.push_back(hash);
+    if (seen_order_.size() > seen_capacity_) {
+      seen_.erase(seen_order_.front());
+      seen_order_.pop_front();
+    }
+    return true;
+  }
+
+  void VoteVerifier::onVerified(uint64_t seq, std::function<void()> deliver) {
+    pending_.emplace(seq, std::move(deliver));
+    for (auto it = pending_.begin();
+         it != pending_.end() and it->first == next_to_deliver_;
+         it = pending_.erase(it), ++next_to_deliver_) {
+      if (it->second) {
+        it->second();
+      } else {
+        logger_->warn("Received vote with invalid signature");
+      }
+    }
+  }
+
+}  // namespace kagome::consensus::grandpa
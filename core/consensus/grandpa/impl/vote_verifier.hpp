@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_CONSENSUS_GRANDPA_IMPL_VOTE_VERIFIER_HPP
+#define KAGOME_CORE_CONSENSUS_GRANDPA_IMPL_VOTE_VERIFIER_HPP
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <unordered_set>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+#include "common/blob.hpp"
+#include "common/logger.hpp"
+#include "consensus/grandpa/structs.hpp"
+#include "consensus/grandpa/vote_crypto_provider.hpp"
+#include "crypto/hasher.hpp"
+
+namespace kagome::consensus::grandpa {
+
+  /**
+   * Verifies signatures of received votes off the io_context thread. Each vote
+   * passes through three stages:
+   * 1. Seen-filter: vote, which hash was already seen, is dropped, so the same
+   * vote gossiped by several peers is verified only once
+   * 2. Signature verification on the worker pool
+   * 3. Delivery of the verified vote back on the io_context thread. Votes are
+   * delivered in the order they were received, votes with invalid signature
+   * are dropped
+   */
+  class VoteVerifier : public std::enable_shared_from_this<VoteVerifier> {
+   public:
+    using OnVerified = std::function<void(const VoteMessage &)>;
+
+    /// default number of hashes remembered by the seen-filter
+    static constexpr size_t kDefaultSeenCapacity = 8192;
+
+    ~VoteVerifier();
+
+    /**
+     * @param hasher used to take hashes of received votes
+     * @param io_context to deliver verified votes to
+     * @param workers number of threads verifying signatures
+     * @param seen_capacity number of last seen votes remembered
+     */
+    VoteVerifier(std::shared_ptr<crypto::Hasher> hasher,
+                 std::shared_ptr<boost::asio::io_context> io_context,
+                 size_t workers,
+                 size_t seen_capacity = kDefaultSeenCapacity);
+
+    /**
+     * Schedules verification of \param msg signature using \param
+     * crypto_provider. If the signature is valid, \param on_verified is invoked
+     * on the io_context thread. Must be called from the io_context thread
+     */
+    void verify(const VoteMessage &msg,
+                std::shared_ptr<VoteCryptoProvider> crypto_provider,
+                OnVerified on_verified);
+
+   private:
+    /// @return true if \param hash was not seen before, false otherwise
+    bool markSeen(const common::Hash256 &hash);
+
+    /// Stores result of verification with sequence number \param seq and
+    /// delivers all results which are next in order
+    void onVerified(uint64_t seq, std::function<void()> deliver);
+
+    std::shared_ptr<crypto::Hasher> hasher_;
+    std::shared_ptr<boost::asio::io_context> io_context_;
+    boost::asio::thread_pool workers_;
+
+    const size_t seen_capacity_;
+    std::unordered_set<common::Hash256> seen_;
+    std::deque<common::Hash256> seen_order_;
+
+    uint64_t next_seq_{0};
+    uint64_t next_to_deliver_{0};
+    // verified votes waiting for the preceding ones; empty function means that
+    // vote was rejected
+    std::map<uint64_t, std::function<void()>> pending_;
+
+    common::Logger logger_ = common::createLogger("Grandpa vote verifier");
+  };
+
+}  // namespace kagome::consensus::grandpa
+
+#endif  // KAGOME_CORE_CONSENSUS_GRANDPA_IMPL_VOTE_VERIFIER_HPP
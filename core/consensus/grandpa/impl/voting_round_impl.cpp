@@ -5,6 +5,8 @@
 
 #include "consensus/grandpa/impl/voting_round_impl.hpp"
 
+#include <algorithm>
+
 #include <boost/range/adaptors.hpp>
 #include <boost/range/algorithm/find_if.hpp>
 #include <boost/range/numeric.hpp>
@@ -139,6 +141,12 @@ namespace kagome::consensus::grandpa {
       logger_->error("Last round state is empty during finalization");
       return false;
     }
+    // precommits might not yet give supermajority to a block above the one
+    // finalized in the last round; the round waits for further votes then
+    if (not cur_round_state_.finalized
+        or cur_round_state_.finalized == last_round_state_->finalized) {
+      return false;
+    }
     // check if new state differs with the old one and broadcast new state
     if (auto notify_res = notify(*last_round_state_); not notify_res) {
       logger_->debug("Did not notify. Reason: {}",
@@ -147,6 +155,7 @@ namespace kagome::consensus::grandpa {
       env_->onCompleted(notify_res.error());
       return false;
     }
+    finalized_ = true;
     return true;
   }
 
@@ -186,18 +195,26 @@ namespace kagome::consensus::grandpa {
   }
 
   void VotingRoundImpl::onPrevote(const SignedPrevote &prevote) {
-    onSignedPrevote(prevote);
-    updatePrevoteGhost();
-    update();
+    const auto state_before = cur_round_state_;
+
+    // only a vote which might move prevote ghost can change the round state,
+    // the rest of them just add weight to blocks having supermajority already
+    if (onSignedPrevote(prevote) and updatePrevoteGhost()) {
+      update();
+    }
 
     // stop prevote timer if round is completable
     if (completable() and clock_->now() < prevote_timer_.expires_at()) {
       prevote_timer_.cancel();
     }
-    tryFinalize();
+    if (cur_round_state_ != state_before or (completable_ and not finalized_)) {
+      tryFinalize();
+    }
   }
 
   void VotingRoundImpl::onPrecommit(const SignedPrecommit &precommit) {
+    const auto state_before = cur_round_state_;
+
     if (not onSignedPrecommit(precommit)) {
       env_->onCompleted(VotingRoundError::LAST_ESTIMATE_BETTER_THAN_PREVOTE);
       return;
@@ -208,13 +225,15 @@ namespace kagome::consensus::grandpa {
     if (completable() and clock_->now() < precommit_timer_.expires_at()) {
       precommit_timer_.cancel();
     }
-    tryFinalize();
+    if (cur_round_state_ != state_before or (completable_ and not finalized_)) {
+      tryFinalize();
+    }
   }
 
-  void VotingRoundImpl::onSignedPrevote(const SignedPrevote &vote) {
+  bool VotingRoundImpl::onSignedPrevote(const SignedPrevote &vote) {
     auto weight = voter_set_->voterWeight(vote.id);
     if (not weight) {
-      return;
+      return false;
     }
     switch (prevotes_->push(vote, weight.value())) {
       case VoteTracker<Prevote>::PushResult::SUCCESS: {
@@ -226,7 +245,7 @@ namespace kagome::consensus::grandpa {
         auto index = voter_set_->voterIndex(vote.id);
         if (not index) {
           logger_->warn("Voter {} is not known: {}", vote.id.toHex());
-          return;
+          return false;
         }
 
         v.prevotes[index.value()] = voter_set_->voterWeight(vote.id).value();
@@ -235,22 +254,41 @@ namespace kagome::consensus::grandpa {
           logger_->warn("Vote {} was not inserted with error: {}",
                         vote.message.block_hash.toHex(),
                         inserted.error().message());
+          return false;
         }
-        break;
+        return mayMovePrevoteGhost(vote.message);
       }
       case VoteTracker<Prevote>::PushResult::DUPLICATED: {
-        break;
+        return false;
       }
       case VoteTracker<Prevote>::PushResult::EQUIVOCATED: {
         auto index = voter_set_->voterIndex(vote.id);
         if (not index) {
           logger_->warn("Voter {} is not known: {}", vote.id.toHex());
-          return;
+          return false;
         }
+        // equivocator's weight is counted for every block, so the whole graph
+        // has to be reevaluated
         prevote_equivocators_[index.value()] = true;
-        break;
+        return true;
       }
     }
+    return false;
+  }
+
+  bool VotingRoundImpl::mayMovePrevoteGhost(const Prevote &prevote) const {
+    if (not cur_round_state_.prevote_ghost) {
+      return true;
+    }
+
+    // prevote ghost only moves towards descendants of the current one, and
+    // weights of those are changed by the votes for descendants only
+    const auto &ghost = cur_round_state_.prevote_ghost.value();
+    if (prevote.block_number <= ghost.block_number) {
+      return false;
+    }
+    return graph_->findAncestorBlockBy(prevote.block_hash, ghost.block_number)
+           == ghost.block_hash;
   }
 
   bool VotingRoundImpl::onSignedPrecommit(const SignedPrecommit &vote) {
@@ -279,6 +317,16 @@ namespace kagome::consensus::grandpa {
                         inserted.error().message());
           return false;
         }
+        // equivocators' weight is counted for every block, which is not
+        // tracked per block, so with them the whole graph is reevaluated
+        auto crossed = addPrecommitWeight(vote.message, weight.value());
+        if (crossed
+            or std::find(precommit_equivocators_.begin(),
+                         precommit_equivocators_.end(),
+                         true)
+                   != precommit_equivocators_.end()) {
+          finalized_outdated_ = true;
+        }
         break;
       }
       case VoteTracker<Precommit>::PushResult::DUPLICATED: {
@@ -291,30 +339,61 @@ namespace kagome::consensus::grandpa {
           return false;
         }
         precommit_equivocators_[index.value()] = true;
+        finalized_outdated_ = true;
         break;
       }
     }
     return true;
   }
 
-  void VotingRoundImpl::updatePrevoteGhost() {
-    if (prevotes_->getTotalWeight() >= threshold_) {
-      const auto &ghost_block_info =
-          cur_round_state_.prevote_ghost.map(convertToBlockInfo);
-      cur_round_state_.prevote_ghost =
-          graph_
-              ->findGhost(ghost_block_info,
-                          [this](const VoteWeight &vote_weight) {
-                            return vote_weight
-                                       .totalWeight(prevote_equivocators_,
-                                                    precommit_equivocators_,
-                                                    voter_set_)
-                                       .prevote
-                                   >= threshold_;
-                          })
-              // convert block info to prevote
-              .map(convertToPrevote);
+  bool VotingRoundImpl::addPrecommitWeight(const Precommit &precommit,
+                                           size_t weight) {
+    // the vote adds its weight to the block and all of its ancestors down to
+    // the base of the graph
+    const auto base_number = graph_->getBase().block_number;
+    bool crossed = false;
+    for (auto number = precommit.block_number; number >= base_number;
+         --number) {
+      auto hash = graph_->findAncestorBlockBy(precommit.block_hash, number);
+      BOOST_ASSERT_MSG(hash, "vote is inserted to the graph; qed");
+      auto &block_weight = precommit_weights_[hash.value()];
+      if (block_weight < threshold_ and block_weight + weight >= threshold_) {
+        crossed = true;
+      }
+      block_weight += weight;
+      if (number == 0) {
+        break;
+      }
+    }
+    return crossed;
+  }
+
+  bool VotingRoundImpl::updatePrevoteGhost() {
+    if (prevotes_->getTotalWeight() < threshold_) {
+      return false;
+    }
+    const auto ghost_before = cur_round_state_.prevote_ghost;
+    const auto &ghost_block_info =
+        cur_round_state_.prevote_ghost.map(convertToBlockInfo);
+    cur_round_state_.prevote_ghost =
+        graph_
+            ->findGhost(ghost_block_info,
+                        [this](const VoteWeight &vote_weight) {
+                          return vote_weight
+                                     .totalWeight(prevote_equivocators_,
+                                                  precommit_equivocators_,
+                                                  voter_set_)
+                                     .prevote
+                                 >= threshold_;
+                        })
+            // convert block info to prevote
+            .map(convertToPrevote);
+    if (cur_round_state_.prevote_ghost == ghost_before) {
+      return false;
     }
+    // finalized block is searched among the ancestors of prevote ghost
+    finalized_outdated_ = true;
+    return true;
   }
 
   bool VotingRoundImpl::completable() const {
@@ -568,7 +647,10 @@ namespace kagome::consensus::grandpa {
     // 2/3+ prevote and precommit weight.
     auto current_precommits = precommits_->getTotalWeight();
 
-    if (current_precommits >= threshold_) {
+    // the highest block with supermajority of precommits only changes, when
+    // one more block gets it, which is tracked per block on each precommit
+    if (finalized_outdated_ and current_precommits >= threshold_) {
+      finalized_outdated_ = false;
       cur_round_state_.finalized = graph_->findAncestor(
           BlockInfo{
               prevote_ghost.block_number,
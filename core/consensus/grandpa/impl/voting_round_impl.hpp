@@ -8,6 +8,8 @@
 
 #include "consensus/grandpa/voting_round.hpp"
 
+#include <unordered_map>
+
 #include <boost/asio/basic_waitable_timer.hpp>
 #include <boost/signals2.hpp>
 
@@ -51,15 +53,18 @@ namespace kagome::consensus::grandpa {
     /**
      * Triggered when we receive prevote for current round
      * \param prevote is stored in prevote tracker and vote graph
-     * Then we try to update prevote ghost (\see updatePrevoteGhost) and round
-     * state (\see update)
+     * Then, if the vote might move prevote ghost, we try to update it (\see
+     * updatePrevoteGhost) and round state (\see update). Finalization is only
+     * attempted when round state has changed
      */
     void onPrevote(const SignedPrevote &prevote) override;
 
     /**
      * Triggered when we receive precommit for the current round
      * \param precommit is stored in precommit tracker and vote graph
-     * Then we try to update round state and finalize
+     * Then we try to update round state and finalize. While the round is
+     * completable and nothing is committed, finalization is attempted on
+     * every vote
      */
     void onPrecommit(const SignedPrecommit &precommit) override;
 
@@ -120,17 +125,28 @@ namespace kagome::consensus::grandpa {
     size_t getThreshold(const std::shared_ptr<VoterSet> &voters);
 
     /// Triggered when we receive \param signed_prevote for the current peer
-    void onSignedPrevote(const SignedPrevote &signed_prevote);
+    /// \return true if the vote might move prevote ghost, false otherwise
+    bool onSignedPrevote(const SignedPrevote &signed_prevote);
+
+    /// Check if \param prevote added to the graph might move prevote ghost,
+    /// i.e. if it is for a descendant of the current prevote ghost
+    bool mayMovePrevoteGhost(const Prevote &prevote) const;
 
     /// Triggered when we receive \param signed_precommit for the current peer
     bool onSignedPrecommit(const SignedPrecommit &signed_precommit);
 
+    /// Add \param weight of \param precommit to the precommit weights of the
+    /// voted block and its ancestors
+    /// \return true if any of the blocks got supermajority, false otherwise
+    bool addPrecommitWeight(const Precommit &precommit, size_t weight);
+
     /**
-     * Invoked during each onSingedPrevote.
+     * Invoked after each onSingedPrevote, which might move prevote ghost.
      * Updates current round's prevote ghost. New prevote-ghost is the highest
      * block with supermajority of prevotes
+     * @return true if prevote ghost has changed, false otherwise
      */
-    void updatePrevoteGhost();
+    bool updatePrevoteGhost();
 
     /// Update current state of the round. In particular we update:
     /// 1. If round is completable
@@ -203,6 +219,15 @@ namespace kagome::consensus::grandpa {
 
     boost::optional<PrimaryPropose> primary_vote_;
     bool completable_{false};
+    // whether a block is committed in this round
+    bool finalized_{false};
+
+    // precommit weight of the blocks, i.e. the weight of the voters, who
+    // precommitted for the block or its descendants, without equivocators
+    std::unordered_map<BlockHash, size_t> precommit_weights_;
+    // whether the highest block with supermajority of precommits has to be
+    // searched again
+    bool finalized_outdated_{true};
   };
 }  // namespace kagome::consensus::grandpa
 
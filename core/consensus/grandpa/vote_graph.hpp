@@ -102,6 +102,14 @@ namespace kagome::consensus::grandpa {
     virtual boost::optional<BlockInfo> findGhost(
         const boost::optional<BlockInfo> &current_best,
         const Condition &condition) const = 0;
+
+    /// Find the block with given number in the ancestry of the vote-node with
+    /// given hash (which may be the node itself).
+    ///
+    /// Returns `None` if there is no such node or the number is out of the
+    /// known ancestry.
+    virtual boost::optional<BlockHash> findAncestorBlockBy(
+        const BlockHash &node_hash, BlockNumber number) const = 0;
   };
 
 }  // namespace kagome::consensus::grandpa
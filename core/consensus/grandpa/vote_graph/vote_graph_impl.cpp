@@ -5,6 +5,7 @@
 
 #include "consensus/grandpa/vote_graph/vote_graph_impl.hpp"
 
+#include <algorithm>
 #include <functional>
 
 #include <boost/range/adaptors.hpp>
@@ -48,42 +49,119 @@ namespace kagome::consensus::grandpa {
     std::vector<BlockHash> containing;
     std::unordered_set<BlockHash> visited;
 
-    // iterate vote-heads and their ancestry backwards until we find the one
-    // with this target hash in that chain.
+    // for every vote-head jump back to the lowest node above the target
+    // number, its ancestor-edge is the only one of the branch, which might
+    // contain the target.
     for (const auto &headHash : heads_) {
-      BlockHash current = headHash;
-      while (true) {
-        auto active = entries_.find(current);
-        if (active == entries_.end()) {
-          break;
-        }
+      auto nodeOpt = findLowestNodeAbove(headHash, block.block_number);
+      if (!nodeOpt) {
+        continue;
+      }
 
-        // if node has been checked already, break
-        if (auto [_, inserted] = visited.insert(current); !inserted) {
-          break;
-        }
+      // if node has been checked already, skip
+      if (auto [_, inserted] = visited.insert(*nodeOpt); !inserted) {
+        continue;
+      }
 
-        auto ancestorOpt =
-            active->second.getAncestorBlockBy(block.block_number);
-        if (ancestorOpt && *ancestorOpt == block.block_hash) {
-          containing.push_back(current);
-        } else if (ancestorOpt && *ancestorOpt != block.block_hash) {
-          // nothing in this branch. continue search.
-        } else {
-          const Entry &activeEntry = active->second;
-          auto lastAncestorIt = activeEntry.ancestors.rbegin();
-          if (lastAncestorIt != activeEntry.ancestors.rend()) {
-            // iterate backwards
-            current = *lastAncestorIt;
-            continue;
-          }
-        }
+      if (inDirectAncestry(
+              entries_.at(*nodeOpt), block.block_hash, block.block_number)) {
+        containing.push_back(*nodeOpt);
+      }
+    }
+
+    return containing;
+  }
+
+  boost::optional<BlockHash> VoteGraphImpl::findAncestorBlockBy(
+      const BlockHash &node_hash, BlockNumber number) const {
+    auto entryIt = entries_.find(node_hash);
+    if (entryIt == entries_.end() || entryIt->second.number < number) {
+      return boost::none;
+    }
+    if (entryIt->second.number == number) {
+      return node_hash;
+    }
 
+    auto nodeOpt = findLowestNodeAbove(node_hash, number);
+    BOOST_ASSERT_MSG(nodeOpt, "node is above the number; qed");
+    return entries_.at(*nodeOpt).getAncestorBlockBy(number);
+  }
+
+  boost::optional<BlockHash> VoteGraphImpl::findLowestNodeAbove(
+      const BlockHash &node_hash, BlockNumber number) const {
+    auto entryIt = entries_.find(node_hash);
+    if (entryIt == entries_.end() || entryIt->second.number <= number) {
+      return boost::none;
+    }
+
+    BlockHash current = node_hash;
+    while (true) {
+      const auto &jumps = getJumps(current);
+
+      // take the longest jump, which still stays above the number
+      auto jumpIt = std::find_if(
+          jumps.rbegin(), jumps.rend(), [this, number](const BlockHash &hash) {
+            return entries_.at(hash).number > number;
+          });
+      if (jumpIt == jumps.rend()) {
+        return current;
+      }
+      current = *jumpIt;
+    }
+  }
+
+  const std::vector<BlockHash> &VoteGraphImpl::getJumps(
+      const BlockHash &node_hash) const {
+    if (auto it = jumps_.find(node_hash); it != jumps_.end()) {
+      return it->second;
+    }
+
+    // collect the nodes without skip lists, those of the ancestors must be
+    // built first
+    std::vector<BlockHash> pending;
+    BlockHash current = node_hash;
+    while (!contains(jumps_, current)) {
+      pending.push_back(current);
+      const auto &ancestors = entries_.at(current).ancestors;
+      if (ancestors.empty()) {
         break;
       }
+      current = ancestors.back();
     }
 
-    return containing;
+    for (auto it = pending.rbegin(); it != pending.rend(); ++it) {
+      std::vector<BlockHash> jumps;
+      const auto &ancestors = entries_.at(*it).ancestors;
+      if (!ancestors.empty()) {
+        jumps.push_back(ancestors.back());
+        // k-th jump is (k-1)-th jump of the (k-1)-th jump
+        while (true) {
+          auto k = jumps.size();
+          const auto &prev_jumps = jumps_.at(jumps[k - 1]);
+          if (prev_jumps.size() < k) {
+            break;
+          }
+          jumps.push_back(prev_jumps[k - 1]);
+        }
+      }
+      jumps_.emplace(*it, std::move(jumps));
+    }
+
+    return jumps_.at(node_hash);
+  }
+
+  void VoteGraphImpl::invalidateJumps(const std::vector<BlockHash> &nodes) {
+    std::vector<BlockHash> pending = nodes;
+    while (!pending.empty()) {
+      auto hash = std::move(pending.back());
+      pending.pop_back();
+      // descendents of a node without skip list have none as well
+      if (jumps_.erase(hash) == 0) {
+        continue;
+      }
+      const auto &descendents = entries_.at(hash).descendents;
+      pending.insert(pending.end(), descendents.begin(), descendents.end());
+    }
   }
 
   outcome::result<void> VoteGraphImpl::insert(const BlockInfo &block,
@@ -209,6 +287,9 @@ namespace kagome::consensus::grandpa {
     }
 
     entries_.insert({ancestor.block_hash, std::move(newEntry)});
+
+    // the new node is in the middle of the ancestry of descendents now
+    invalidateJumps(descendents);
   }
 
   boost::optional<BlockInfo> VoteGraphImpl::findGhost(
@@ -380,6 +461,9 @@ namespace kagome::consensus::grandpa {
 
     entries_[new_hash] = std::move(newEntry);
     base_ = BlockInfo{new_number, new_hash};
+
+    // every node has got a new ancestor
+    jumps_.clear();
   }
 
   boost::optional<BlockInfo> VoteGraphImpl::findAncestor(
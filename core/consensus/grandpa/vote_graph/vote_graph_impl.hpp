@@ -83,6 +83,14 @@ namespace kagome::consensus::grandpa {
     boost::optional<std::vector<primitives::BlockHash>> findContainingNodes(
         const BlockInfo &block) const;
 
+    /// Find the block with given number in the ancestry of the vote-node with
+    /// given hash (which may be the node itself).
+    ///
+    /// Returns `None` if there is no such node or the number is out of the
+    /// known ancestry.
+    boost::optional<BlockHash> findAncestorBlockBy(
+        const BlockHash &node_hash, BlockNumber number) const override;
+
     const BlockInfo &getBase() const override {
       return base_;
     }
@@ -97,10 +105,32 @@ namespace kagome::consensus::grandpa {
     }
 
    private:
+    // find the lowest vote-node in the ancestry of the given one (including
+    // itself) which number is greater than the given one. Its ancestor-edge
+    // is the one containing the block with given number.
+    //
+    // returns `None` if the given node is not higher than the number.
+    boost::optional<BlockHash> findLowestNodeAbove(const BlockHash &node_hash,
+                                                   BlockNumber number) const;
+
+    // get skip list of the given vote-node, building it (and the ones of its
+    // ancestor nodes) if needed.
+    const std::vector<BlockHash> &getJumps(const BlockHash &node_hash) const;
+
+    // drop skip lists of the given nodes and all their descendents, as their
+    // ancestry has changed.
+    void invalidateJumps(const std::vector<BlockHash> &nodes);
+
     std::shared_ptr<Chain> chain_;
     BlockInfo base_;
     std::unordered_map<BlockHash, Entry> entries_;
     std::unordered_set<BlockHash> heads_;
+
+    // skip list over the ancestry of vote-nodes: k-th element is the 2^k-th
+    // ancestor node. Built lazily, so that the graph could answer if a block
+    // is in the ancestry of a node in O(log n) instead of walking back all the
+    // ancestor nodes.
+    mutable std::unordered_map<BlockHash, std::vector<BlockHash>> jumps_;
   };
 
 }  // namespace kagome::consensus::grandpa
@@ -14,28 +14,21 @@ namespace kagome::consensus::grandpa {
       const std::vector<bool> &prevotes_equivocators,
       const std::vector<bool> &precommits_equivocators,
       const std::shared_ptr<VoterSet> &voter_set) const {
-    std::vector<size_t> prevotes_weight_with_equivocators(prevotes);
-    std::vector<size_t> precommits_weight_with_equivocators(precommits);
+    TotalWeight weight{
+        .prevote = std::accumulate(prevotes.begin(), prevotes.end(), 0UL),
+        .precommit =
+            std::accumulate(precommits.begin(), precommits.end(), 0UL)};
 
+    // equivocators are counted as voters for every block
     for (size_t i = 0; i < voter_set->size(); i++) {
       if (prevotes[i] == 0 and prevotes_equivocators[i]) {
-        prevotes_weight_with_equivocators[i] +=
-            voter_set->voterWeight(i).value();
+        weight.prevote += voter_set->voterWeight(i).value();
       }
       if (precommits[i] == 0 and precommits_equivocators[i]) {
-        precommits_weight_with_equivocators[i] +=
-            voter_set->voterWeight(i).value();
+        weight.precommit += voter_set->voterWeight(i).value();
       }
     }
 
-    TotalWeight weight{
-        .prevote = std::accumulate(prevotes_weight_with_equivocators.begin(),
-                                   prevotes_weight_with_equivocators.end(),
-                                   0UL),
-        .precommit =
-            std::accumulate(precommits_weight_with_equivocators.begin(),
-                            precommits_weight_with_equivocators.end(),
-                            0UL)};
     return weight;
   }
 
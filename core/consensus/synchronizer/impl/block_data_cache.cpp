@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/synchronizer/impl/block_data_cache.hpp"
+
+#include <iterator>
+
+#include <boost/assert.hpp>
+#include <boost/container_hash/hash.hpp>
+
+namespace kagome::consensus {
+
+  BlockDataCache::BlockDataCache(size_t max_bytes) : max_bytes_{max_bytes} {}
+
+  BlockDataCache::EncodedBlockData BlockDataCache::get(
+      const primitives::BlockHash &hash, uint8_t fields) {
+    auto it = index_.find(Key{hash, fields});
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+  }
+
+  void BlockDataCache::put(const primitives::BlockHash &hash,
+                           uint8_t fields,
+                           EncodedBlockData block_data) {
+    BOOST_ASSERT(block_data != nullptr);
+    Key key{hash, fields};
+    if (auto it = index_.find(key); it != index_.end()) {
+      erase(it->second);
+    }
+    if (block_data->size() > max_bytes_) {
+      return;
+    }
+    while (size_ + block_data->size() > max_bytes_) {
+      erase(std::prev(entries_.end()));
+    }
+    size_ += block_data->size();
+    entries_.emplace_front(key, std::move(block_data));
+    index_.emplace(key, entries_.begin());
+  }
+
+  size_t BlockDataCache::size() const {
+    return size_;
+  }
+
+  void BlockDataCache::erase(Entries::iterator entry) {
+    size_ -= entry->second->size();
+    index_.erase(entry->first);
+    entries_.erase(entry);
+  }
+
+  size_t BlockDataCache::KeyHash::operator()(const Key &key) const {
+    auto seed = boost::hash_range(key.hash.begin(), key.hash.end());
+    boost::hash_combine(seed, key.fields);
+    return seed;
+  }
+
+}  // namespace kagome::consensus
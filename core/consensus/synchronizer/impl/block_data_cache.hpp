@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_BLOCK_DATA_CACHE_HPP
+#define KAGOME_BLOCK_DATA_CACHE_HPP
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "primitives/common.hpp"
+
+namespace kagome::consensus {
+
+  /**
+   * LRU cache of SCALE-encoded BlockData, which is sent in the responses to
+   * the blocks requests. The same block can be requested with different sets
+   * of attributes, so an entry is identified by both hash and attributes.
+   * Entries contain block bodies, so the cache is bounded by their total size
+   */
+  class BlockDataCache {
+   public:
+    using EncodedBlockData = std::shared_ptr<const std::vector<uint8_t>>;
+
+    /**
+     * @param max_bytes - max total size of the cached block data in bytes
+     */
+    explicit BlockDataCache(size_t max_bytes);
+
+    /**
+     * @return encoded BlockData of the block \param hash with \param fields
+     * attributes, nullptr if it is not cached
+     */
+    EncodedBlockData get(const primitives::BlockHash &hash, uint8_t fields);
+
+    /**
+     * Cache encoded BlockData of the block \param hash with \param fields
+     * attributes; the least recently used entries are evicted until it fits
+     * into the cache, data larger than the whole cache is not cached
+     */
+    void put(const primitives::BlockHash &hash,
+             uint8_t fields,
+             EncodedBlockData block_data);
+
+    /// @return total size of the cached block data in bytes
+    size_t size() const;
+
+   private:
+    struct Key {
+      primitives::BlockHash hash;
+      uint8_t fields;
+
+      bool operator==(const Key &other) const {
+        return hash == other.hash && fields == other.fields;
+      }
+    };
+
+    struct KeyHash {
+      size_t operator()(const Key &key) const;
+    };
+
+    using Entries = std::list<std::pair<Key, EncodedBlockData>>;
+
+    /// Forget \param entry
+    void erase(Entries::iterator entry);
+
+    size_t max_bytes_;
+    /// entries ordered from the most to the least recently used
+    Entries entries_;
+    std::unordered_map<Key, Entries::iterator, KeyHash> index_;
+    size_t size_{0};
+  };
+
+}  // namespace kagome::consensus
+
+#endif  // KAGOME_BLOCK_DATA_CACHE_HPP
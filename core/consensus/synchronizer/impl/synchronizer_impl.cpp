@@ -6,35 +6,57 @@
 #include "consensus/synchronizer/impl/synchronizer_impl.hpp"
 
 #include <boost/assert.hpp>
+#include "libp2p/multi/uvarint.hpp"
 #include "network/common.hpp"
-#include "network/helpers/scale_message_read_writer.hpp"
-#include "network/rpc.hpp"
 #include "network/types/block_announce.hpp"
+#include "scale/scale.hpp"
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::consensus, SynchronizerError, e) {
   using E = kagome::consensus::SynchronizerError;
   switch (e) {
     case E::REQUEST_ID_EXIST:
       return "Either peer requests himself, or request was already processed";
+    case E::REQUEST_TIMEOUT:
+      return "Peer has not responded to the request in time";
+    case E::SESSION_CLOSED:
+      return "Stream to the peer was closed before the response arrived";
+    case E::RESPONSE_TOO_LARGE:
+      return "Peer sent response, which exceeds the size limit";
   }
   return "unknown error";
 }
 
 namespace kagome::consensus {
+  namespace {
+    /// max number of bytes in varint, which encodes 64-bit number
+    constexpr size_t kMaxVarintSize = 10;
+  }  // namespace
+
   SynchronizerImpl::SynchronizerImpl(
       libp2p::Host &host,
       libp2p::peer::PeerInfo peer_info,
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers,
+      std::shared_ptr<boost::asio::io_context> io_context,
       SynchronizerConfig config)
       : host_{host},
         peer_info_{std::move(peer_info)},
         block_tree_{std::move(block_tree)},
         blocks_headers_{std::move(blocks_headers)},
+        io_context_{std::move(io_context)},
         config_{config},
+        block_data_cache_{config_.block_data_cache_bytes},
         log_(common::createLogger("Synchronizer")) {
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(blocks_headers_);
+    BOOST_ASSERT(io_context_);
+    BOOST_ASSERT(config_.max_in_flight_requests > 0);
+  }
+
+  SynchronizerImpl::~SynchronizerImpl() {
+    if (stream_) {
+      stream_->reset();
+    }
   }
 
   void SynchronizerImpl::requestBlocks(
@@ -54,23 +76,272 @@ namespace kagome::consensus {
                      }
                    });
     requested_ids_.insert(request.id);
-    network::RPC<network::ScaleMessageReadWriter>::write<BlocksRequest,
-                                                         BlocksResponse>(
-        host_, peer_info_, network::kSyncProtocol, request, std::move(cb));
+    queued_requests_.emplace_back(request, std::move(cb));
+    if (read_writer_) {
+      return writeRequests();
+    }
+    openSession();
+  }
+
+  void SynchronizerImpl::openSession() {
+    if (opening_session_) {
+      return;
+    }
+    opening_session_ = true;
+    host_.newStream(
+        peer_info_,
+        pipelining_ ? network::kSyncPipelinedProtocol : network::kSyncProtocol,
+        [self_wp{weak_from_this()}](auto &&stream_res) {
+          auto self = self_wp.lock();
+          if (not self) {
+            return;
+          }
+          self->opening_session_ = false;
+          if (not stream_res and self->pipelining_) {
+            // the peer may not support the pipelined protocol, so the legacy
+            // one is tried
+            self->log_->debug("cannot open pipelined sync stream to {}: {}",
+                              self->peer_info_.id.toBase58(),
+                              stream_res.error().message());
+            self->pipelining_ = false;
+            return self->openSession();
+          }
+          if (not stream_res) {
+            self->log_->warn("cannot open sync stream to {}: {}",
+                             self->peer_info_.id.toBase58(),
+                             stream_res.error().message());
+            // neither protocol is opened, so the pipelined one is tried again
+            // next time
+            self->pipelining_ = true;
+            // the peer is unreachable, so the queued requests are failed
+            // instead of trying again
+            auto queued_requests = std::move(self->queued_requests_);
+            for (auto &[request, cb] : queued_requests) {
+              cb(stream_res.error());
+            }
+            return;
+          }
+          self->stream_ = std::move(stream_res.value());
+          self->stream_requests_ = 0;
+          self->read_writer_ =
+              std::make_shared<network::ScaleMessageReadWriter>(self->stream_);
+          self->readResponse(self->read_writer_);
+          self->writeRequests();
+        });
+  }
+
+  void SynchronizerImpl::writeRequests() {
+    if (not read_writer_ or writing_ or queued_requests_.empty()
+        or in_flight_requests_.size() >= config_.max_in_flight_requests) {
+      return;
+    }
+    if (not pipelining_ and stream_requests_ != 0) {
+      // the legacy protocol serves one request per stream
+      return;
+    }
+    ++stream_requests_;
+    auto [request, cb] = std::move(queued_requests_.front());
+    queued_requests_.pop_front();
+
+    auto timeout = std::make_shared<boost::asio::steady_timer>(*io_context_);
+    timeout->expires_after(config_.request_timeout);
+    timeout->async_wait(
+        [self_wp{weak_from_this()}, id = request.id](const auto &error) {
+          if (error) {
+            return;
+          }
+          if (auto self = self_wp.lock()) {
+            self->failRequest(id, SynchronizerError::REQUEST_TIMEOUT);
+            if (not self->pipelining_ and self->read_writer_) {
+              // the stream of the legacy protocol is not used anymore
+              return self->finishLegacySession();
+            }
+            self->writeRequests();
+          }
+        });
+    in_flight_requests_[request.id] =
+        InFlightRequest{std::move(cb), std::move(timeout)};
+
+    // requests are written one by one, as the stream does not allow
+    // concurrent writes
+    writing_ = true;
+    read_writer_->write<BlocksRequest>(
+        request,
+        [self_wp{weak_from_this()}, read_writer = read_writer_](
+            auto &&write_res) {
+          auto self = self_wp.lock();
+          if (not self or self->read_writer_ != read_writer) {
+            return;
+          }
+          self->writing_ = false;
+          if (not write_res) {
+            return self->closeSession(write_res.error());
+          }
+          self->writeRequests();
+        });
+  }
+
+  void SynchronizerImpl::readResponse(
+      std::shared_ptr<network::ScaleMessageReadWriter> read_writer) {
+    readResponseSize(std::move(read_writer),
+                     std::make_shared<std::vector<uint8_t>>());
+  }
+
+  void SynchronizerImpl::readResponseSize(
+      std::shared_ptr<network::ScaleMessageReadWriter> read_writer,
+      std::shared_ptr<std::vector<uint8_t>> size_bytes) {
+    // size of the message is a varint, which is read byte by byte
+    size_bytes->push_back(0);
+    auto size_byte = gsl::make_span(&size_bytes->back(), 1);
+    stream_->read(
+        size_byte,
+        1,
+        [self_wp{weak_from_this()}, read_writer, size_bytes](
+            auto &&read_res) mutable {
+          auto self = self_wp.lock();
+          if (not self or self->read_writer_ != read_writer) {
+            return;
+          }
+          if (not read_res) {
+            return self->closeSession(read_res.error());
+          }
+          auto size = libp2p::multi::UVarint::create(*size_bytes);
+          if (not size) {
+            if (size_bytes->size() >= kMaxVarintSize) {
+              return self->closeSession(
+                  SynchronizerError::RESPONSE_TOO_LARGE);
+            }
+            return self->readResponseSize(std::move(read_writer),
+                                          std::move(size_bytes));
+          }
+
+          auto message_size = size->toUInt64();
+          if (message_size == 0
+              or message_size > self->config_.max_received_response_bytes) {
+            self->log_->warn("{} sent response of invalid size {}",
+                             self->peer_info_.id.toBase58(),
+                             message_size);
+            return self->closeSession(SynchronizerError::RESPONSE_TOO_LARGE);
+          }
+          self->readResponsePart(
+              std::move(read_writer),
+              std::make_shared<network::BlocksResponseDecoder>(message_size),
+              std::make_shared<std::vector<uint8_t>>(
+                  std::min<size_t>(message_size, kResponsePartSize)));
+        });
+  }
+
+  void SynchronizerImpl::readResponsePart(
+      std::shared_ptr<network::ScaleMessageReadWriter> read_writer,
+      std::shared_ptr<network::BlocksResponseDecoder> decoder,
+      std::shared_ptr<std::vector<uint8_t>> part) {
+    // blocks are decoded as their parts arrive, so the whole encoded response
+    // is never kept in memory
+    auto part_size = std::min(decoder->remaining(), part->size());
+    stream_->read(
+        gsl::make_span(part->data(), part_size),
+        part_size,
+        [self_wp{weak_from_this()}, read_writer, decoder, part, part_size](
+            auto &&read_res) mutable {
+          auto self = self_wp.lock();
+          if (not self or self->read_writer_ != read_writer) {
+            return;
+          }
+          if (not read_res) {
+            return self->closeSession(read_res.error());
+          }
+          if (auto feed_res =
+                  decoder->feed(gsl::make_span(part->data(), part_size));
+              not feed_res) {
+            return self->closeSession(feed_res.error());
+          }
+          if (not decoder->finished()) {
+            return self->readResponsePart(
+                std::move(read_writer), std::move(decoder), std::move(part));
+          }
+          self->onResponse(std::move(read_writer), decoder->takeResponse());
+        });
+  }
+
+  void SynchronizerImpl::onResponse(
+      std::shared_ptr<network::ScaleMessageReadWriter> read_writer,
+      BlocksResponse response) {
+    auto it = in_flight_requests_.find(response.id);
+    if (it == in_flight_requests_.end()) {
+      // request is already timed out
+      log_->debug("Dropped late response to the request {}", response.id);
+    } else {
+      auto cb = std::move(it->second.cb);
+      it->second.timeout->cancel();
+      in_flight_requests_.erase(it);
+      cb(std::move(response));
+    }
+    if (read_writer_ != read_writer) {
+      return;
+    }
+    if (not pipelining_) {
+      return finishLegacySession();
+    }
+    readResponse(std::move(read_writer));
+    writeRequests();
+  }
+
+  void SynchronizerImpl::finishLegacySession() {
+    stream_->close([](auto &&) {});
+    stream_.reset();
+    read_writer_.reset();
+    writing_ = false;
+    if (not queued_requests_.empty()) {
+      openSession();
+    }
+  }
+
+  void SynchronizerImpl::failRequest(primitives::BlocksRequestId id,
+                                     std::error_code error) {
+    auto it = in_flight_requests_.find(id);
+    if (it == in_flight_requests_.end()) {
+      return;
+    }
+    auto cb = std::move(it->second.cb);
+    it->second.timeout->cancel();
+    in_flight_requests_.erase(it);
+    cb(error);
+  }
+
+  void SynchronizerImpl::closeSession(std::error_code error) {
+    log_->debug("sync stream to {} is closed: {}",
+                peer_info_.id.toBase58(),
+                error.message());
+    stream_->reset();
+    stream_.reset();
+    read_writer_.reset();
+    writing_ = false;
+
+    auto in_flight_requests = std::move(in_flight_requests_);
+    in_flight_requests_.clear();
+    for (auto &[id, in_flight_request] : in_flight_requests) {
+      in_flight_request.timeout->cancel();
+      in_flight_request.cb(SynchronizerError::SESSION_CLOSED);
+    }
+
+    // requests, which were not sent yet, are sent over a new stream
+    if (not queued_requests_.empty()) {
+      openSession();
+    }
   }
 
-  outcome::result<network::BlocksResponse> SynchronizerImpl::onBlocksRequest(
-      const BlocksRequest &request) const {
+  outcome::result<std::shared_ptr<const std::vector<uint8_t>>>
+  SynchronizerImpl::onBlocksRequestEncoded(const BlocksRequest &request) const {
     if (requested_ids_.find(request.id) != requested_ids_.end()) {
       return SynchronizerError::REQUEST_ID_EXIST;
     }
-    BlocksResponse response{request.id};
 
     // firstly, check if we have both "from" & "to" blocks (if set)
     auto from_hash_res = blocks_headers_->getHashById(request.from);
     if (!from_hash_res) {
       log_->warn("cannot find a requested block with id {}", request.from);
-      return response;
+      return std::make_shared<const std::vector<uint8_t>>(
+          encodeBlocksResponse(request, {}));
     }
 
     // secondly, retrieve hashes of blocks the other peer is interested in
@@ -79,15 +350,17 @@ namespace kagome::consensus {
     if (!chain_hash_res) {
       log_->error("cannot retrieve a chain of blocks: {}",
                   chain_hash_res.error().message());
-      return response;
+      return std::make_shared<const std::vector<uint8_t>>(
+          encodeBlocksResponse(request, {}));
     }
 
-    // thirdly, fill the resulting response with data, which we were asked for
-    fillBlocksResponse(request, response, chain_hash_res.value());
-    if (not response.blocks.empty()) {
-      log_->debug("Return response: {}", response.blocks[0].hash.toHex());
+    // thirdly, encode the response with data, which we were asked for
+    const auto &hash_chain = chain_hash_res.value();
+    if (not hash_chain.empty()) {
+      log_->debug("Return response: {}", hash_chain.front().toHex());
     }
-    return response;
+    return std::make_shared<const std::vector<uint8_t>>(
+        encodeBlocksResponse(request, hash_chain));
   }
 
   blockchain::BlockTree::BlockHashVecRes
@@ -98,9 +371,13 @@ namespace kagome::consensus {
         request.direction == network::Direction::ASCENDING;
     blockchain::BlockTree::BlockHashVecRes chain_hash_res{{}};
     if (!request.to) {
-      // if there's no "stop" block, get as many as possible
+      // if there's no "stop" block, get as many as requested, but no more than
+      // we can send at once
+      auto max_blocks = std::min(
+          config_.max_request_blocks,
+          request.max.value_or(config_.max_request_blocks));
       chain_hash_res = block_tree_->getChainByBlock(
-          from_hash, ascending_direction, config_.max_request_blocks);
+          from_hash, ascending_direction, max_blocks);
     } else {
       // else, both blocks are specified
       OUTCOME_TRY(chain_hash,
@@ -113,10 +390,50 @@ namespace kagome::consensus {
     return chain_hash_res;
   }
 
-  void SynchronizerImpl::fillBlocksResponse(
+  std::vector<uint8_t> SynchronizerImpl::encodeBlocksResponse(
       const BlocksRequest &request,
-      BlocksResponse &response,
       const std::vector<primitives::BlockHash> &hash_chain) const {
+    // justification is added to the block on its finalization, so data of the
+    // blocks above the last finalized one can change
+    boost::optional<primitives::BlockNumber> last_finalized;
+    if (request.attributeIsSet(network::BlockAttributesBits::JUSTIFICATION)) {
+      last_finalized = block_tree_->getLastFinalized().block_number;
+    }
+
+    std::vector<BlockDataCache::EncodedBlockData> blocks_data;
+    size_t blocks_size = 0;
+    for (const auto &hash : hash_chain) {
+      auto block_data = encodeBlockData(request, hash, last_finalized);
+      if (not block_data) {
+        break;
+      }
+      if (not blocks_data.empty()
+          and blocks_size + block_data->size() > config_.max_response_bytes) {
+        log_->debug("Response is limited to {} of {} blocks due to its size",
+                    blocks_data.size(),
+                    hash_chain.size());
+        break;
+      }
+      blocks_size += block_data->size();
+      blocks_data.push_back(std::move(block_data));
+    }
+
+    // encoded BlocksResponse is the id followed by the encoded vector of
+    // BlockData, so the cached encodings are spliced as they are
+    scale::ScaleEncoderStream s;
+    s << request.id << scale::CompactInteger{blocks_data.size()};
+    auto response = s.data();
+    response.reserve(response.size() + blocks_size);
+    for (const auto &block_data : blocks_data) {
+      response.insert(response.end(), block_data->begin(), block_data->end());
+    }
+    return response;
+  }
+
+  BlockDataCache::EncodedBlockData SynchronizerImpl::encodeBlockData(
+      const BlocksRequest &request,
+      const primitives::BlockHash &hash,
+      const boost::optional<primitives::BlockNumber> &last_finalized) const {
     // TODO(akvinikym): understand, where to take receipt and message_queue
     auto header_needed =
         request.attributeIsSet(network::BlockAttributesBits::HEADER);
@@ -124,28 +441,58 @@ namespace kagome::consensus {
         request.attributeIsSet(network::BlockAttributesBits::BODY);
     auto justification_needed =
         request.attributeIsSet(network::BlockAttributesBits::JUSTIFICATION);
-    for (const auto &hash : hash_chain) {
-      auto &new_block =
-          response.blocks.emplace_back(primitives::BlockData{hash});
-
-      if (header_needed) {
-        auto header_res = blocks_headers_->getBlockHeader(hash);
-        if (header_res) {
-          new_block.header = std::move(header_res.value());
-        }
+    // receipt and message queue are not served, so they do not distinguish
+    // the cached entries
+    auto fields = static_cast<uint8_t>(
+        request.fields.attributes.to_ulong()
+        & (network::BlockAttributesBits::HEADER
+           | network::BlockAttributesBits::BODY
+           | network::BlockAttributesBits::JUSTIFICATION));
+
+    if (auto cached = block_data_cache_.get(hash, fields)) {
+      return cached;
+    }
+
+    primitives::BlockData new_block{hash};
+    if (header_needed) {
+      auto header_res = blocks_headers_->getBlockHeader(hash);
+      if (header_res) {
+        new_block.header = std::move(header_res.value());
       }
-      if (body_needed) {
-        auto body_res = block_tree_->getBlockBody(hash);
-        if (body_res) {
-          new_block.body = std::move(body_res.value());
-        }
+    }
+    if (body_needed) {
+      auto body_res = block_tree_->getBlockBody(hash);
+      if (body_res) {
+        new_block.body = std::move(body_res.value());
       }
-      if (justification_needed) {
-        auto justification_res = block_tree_->getBlockJustification(hash);
-        if (justification_res) {
-          new_block.justification = std::move(justification_res.value());
-        }
+    }
+    if (justification_needed) {
+      auto justification_res = block_tree_->getBlockJustification(hash);
+      if (justification_res) {
+        new_block.justification = std::move(justification_res.value());
       }
     }
+
+    auto encoded_res = scale::encode(new_block);
+    if (not encoded_res) {
+      log_->error("cannot encode data of block {}: {}",
+                  hash.toHex(),
+                  encoded_res.error().message());
+      return nullptr;
+    }
+    auto encoded = std::make_shared<const std::vector<uint8_t>>(
+        std::move(encoded_res.value()));
+
+    // header or body may be missing yet, justification may be added until the
+    // block is finalized
+    auto is_complete = (not header_needed or new_block.header)
+                       and (not body_needed or new_block.body);
+    auto is_final = not justification_needed or new_block.justification
+                    or (new_block.header and last_finalized
+                        and new_block.header->number <= *last_finalized);
+    if (is_complete and is_final) {
+      block_data_cache_.put(hash, fields, encoded);
+    }
+    return encoded;
   }
 }  // namespace kagome::consensus
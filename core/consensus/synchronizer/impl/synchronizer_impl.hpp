@@ -6,62 +6,161 @@
 #ifndef KAGOME_SYNCHRONIZER_IMPL_HPP
 #define KAGOME_SYNCHRONIZER_IMPL_HPP
 
+#include <deque>
 #include <memory>
+#include <unordered_map>
 
+#include <boost/asio/steady_timer.hpp>
 #include "blockchain/block_header_repository.hpp"
 #include "blockchain/block_tree.hpp"
 #include "common/logger.hpp"
+#include "consensus/synchronizer/impl/block_data_cache.hpp"
 #include "consensus/synchronizer/synchronizer.hpp"
 #include "consensus/synchronizer/synchronizer_config.hpp"
+#include "libp2p/connection/stream.hpp"
 #include "libp2p/host/host.hpp"
 #include "libp2p/peer/peer_info.hpp"
+#include "network/helpers/blocks_response_decoder.hpp"
+#include "network/helpers/scale_message_read_writer.hpp"
 #include "primitives/common.hpp"
 
 namespace kagome::consensus {
 
-  enum class SynchronizerError { REQUEST_ID_EXIST = 1 };
+  enum class SynchronizerError {
+    REQUEST_ID_EXIST = 1,
+    REQUEST_TIMEOUT,
+    SESSION_CLOSED,
+    RESPONSE_TOO_LARGE
+  };
 
+  /**
+   * Synchronizer with a single peer. Requests to the peer are sent over a
+   * long-lived stream, several of them can wait for the responses at once;
+   * responses are matched with the requests by their ids. Peers, which do
+   * not support the pipelined version of the sync protocol, are sent one
+   * request per stream
+   */
   class SynchronizerImpl
       : public Synchronizer,
         public std::enable_shared_from_this<SynchronizerImpl> {
     using BlocksResponse = network::BlocksResponse;
     using BlocksRequest = network::BlocksRequest;
+    using ResponseHandler =
+        std::function<void(outcome::result<BlocksResponse>)>;
 
    public:
+    /// responses are read from the stream by parts of that size
+    static constexpr size_t kResponsePartSize = 64 * 1024;
+
     SynchronizerImpl(
         libp2p::Host &host,
         libp2p::peer::PeerInfo peer_info,
         std::shared_ptr<blockchain::BlockTree> block_tree,
         std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers,
+        std::shared_ptr<boost::asio::io_context> io_context,
         SynchronizerConfig config);
 
-    ~SynchronizerImpl() override = default;
+    ~SynchronizerImpl() override;
 
     void requestBlocks(
         const BlocksRequest &request,
         std::function<void(outcome::result<BlocksResponse>)> cb) override;
 
-    outcome::result<BlocksResponse> onBlocksRequest(
-        const BlocksRequest &request) const override;
+    outcome::result<std::shared_ptr<const std::vector<uint8_t>>>
+    onBlocksRequestEncoded(const BlocksRequest &request) const override;
 
    private:
+    /// Request, which waits for the response
+    struct InFlightRequest {
+      ResponseHandler cb;
+      std::shared_ptr<boost::asio::steady_timer> timeout;
+    };
+
+    /// Open the stream to the peer, if it is not opened or being opened
+    void openSession();
+
+    /// Write the queued requests, while there are free slots for them
+    void writeRequests();
+
+    /// Read the next response from the stream of \param read_writer
+    void readResponse(
+        std::shared_ptr<network::ScaleMessageReadWriter> read_writer);
+
+    /// Read the size of the response, \param size_bytes are the bytes of
+    /// the size, which are already read
+    void readResponseSize(
+        std::shared_ptr<network::ScaleMessageReadWriter> read_writer,
+        std::shared_ptr<std::vector<uint8_t>> size_bytes);
+
+    /// Read the next \param part of the response and pass it to \param
+    /// decoder
+    void readResponsePart(
+        std::shared_ptr<network::ScaleMessageReadWriter> read_writer,
+        std::shared_ptr<network::BlocksResponseDecoder> decoder,
+        std::shared_ptr<std::vector<uint8_t>> part);
+
+    /// Pass \param response to the handler of its request
+    void onResponse(
+        std::shared_ptr<network::ScaleMessageReadWriter> read_writer,
+        BlocksResponse response);
+
+    /// Fail the request \param id with \param error, if it still waits for
+    /// the response
+    void failRequest(primitives::BlocksRequestId id, std::error_code error);
+
+    /// Close the stream and fail all requests in flight with \param error
+    void closeSession(std::error_code error);
+
+    /// Close the stream of the legacy protocol, which is responded, and open
+    /// a new one for the queued requests
+    void finishLegacySession();
+
     blockchain::BlockTree::BlockHashVecRes retrieveRequestedHashes(
         const network::BlocksRequest &request,
         const primitives::BlockHash &from_hash) const;
 
-    void fillBlocksResponse(
+    /**
+     * Encode the response with data of the blocks from \param hash_chain;
+     * the blocks are added while the response fits into the size limit
+     */
+    std::vector<uint8_t> encodeBlocksResponse(
         const network::BlocksRequest &request,
-        network::BlocksResponse &response,
         const std::vector<primitives::BlockHash> &hash_chain) const;
 
+    /**
+     * Take the encoded data of block \param hash from the cache or read it
+     * from the storage. Data of the block is cached, if it cannot change
+     * anymore
+     */
+    BlockDataCache::EncodedBlockData encodeBlockData(
+        const network::BlocksRequest &request,
+        const primitives::BlockHash &hash,
+        const boost::optional<primitives::BlockNumber> &last_finalized) const;
+
     libp2p::Host &host_;
     libp2p::peer::PeerInfo peer_info_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers_;
+    std::shared_ptr<boost::asio::io_context> io_context_;
     SynchronizerConfig config_;
+    mutable BlockDataCache block_data_cache_;
     std::unordered_set<primitives::BlocksRequestId>
         requested_ids_{};  // requested ids from current peer. TODO: clean after
                            // some period
+
+    std::shared_ptr<libp2p::connection::Stream> stream_;
+    std::shared_ptr<network::ScaleMessageReadWriter> read_writer_;
+    bool opening_session_{false};
+    bool writing_{false};
+    /// whether the peer supports the pipelined protocol; it is assumed until
+    /// the peer fails to negotiate it
+    bool pipelining_{true};
+    /// number of requests written to the current stream
+    size_t stream_requests_{0};
+    /// requests, which wait for a free slot or for the stream to be opened
+    std::deque<std::pair<BlocksRequest, ResponseHandler>> queued_requests_;
+    std::unordered_map<primitives::BlocksRequestId, InFlightRequest>
+        in_flight_requests_;
     common::Logger log_;
   };
 }  // namespace kagome::consensus
@@ -6,12 +6,25 @@
 #ifndef KAGOME_SYNCHRONIZER_CONFIG_HPP
 #define KAGOME_SYNCHRONIZER_CONFIG_HPP
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 
 namespace kagome::consensus {
   struct SynchronizerConfig {
     /// how much blocks we can send at once
     uint32_t max_request_blocks = 128u;
+    /// max size of the encoded response; at least one block is sent anyway
+    size_t max_response_bytes = 16u * 1024 * 1024;
+    /// max size of the encoded response, which is accepted from the peers
+    size_t max_received_response_bytes = 64u * 1024 * 1024;
+    /// how much encoded blocks data in bytes is kept to serve the repeated
+    /// requests
+    size_t block_data_cache_bytes = 64u * 1024 * 1024;
+    /// how much requests can wait for the responses from the peer at once
+    size_t max_in_flight_requests = 4u;
+    /// time after which a request is failed, if there is no response to it
+    std::chrono::seconds request_timeout{10};
   };
 }  // namespace kagome::consensus
 
@@ -77,15 +77,53 @@ namespace kagome::consensus {
       const primitives::AuthorityId &authority_id,
       const Threshold &threshold,
       const Randomness &randomness) const {
-    log_->debug("Validates block signed by authority: {}",
-                authority_id.id.toHex());
+    OUTCOME_TRY(babe_digests, getBabeDigests(header));
+    // the header is validated once here, so there is nothing to memoize
+    auto pre_seal_hash =
+        hasher_->blake2b_256(primitives::HashedHeader::encodePreSeal(header));
+    OUTCOME_TRY(verifySignatures(
+        pre_seal_hash, babe_digests, authority_id, threshold, randomness));
+    return validateHeaderProducer(header);
+  }
 
-    // get BABE-specific digests, which must be inside of this block
+  outcome::result<void> BabeBlockValidator::validateHeaderSignatures(
+      const primitives::HashedHeader &header,
+      const primitives::AuthorityId &authority_id,
+      const Threshold &threshold,
+      const Randomness &randomness) const {
+    OUTCOME_TRY(babe_digests, getBabeDigests(header.header()));
+    // BABE digests are there, so the header has a Seal
+    BOOST_ASSERT(header.preSealHash());
+    return verifySignatures(*header.preSealHash(),
+                            babe_digests,
+                            authority_id,
+                            threshold,
+                            randomness);
+  }
+
+  outcome::result<void> BabeBlockValidator::validateHeaderProducer(
+      const primitives::BlockHeader &header) const {
     OUTCOME_TRY(babe_digests, getBabeDigests(header));
-    auto [seal, babe_header] = babe_digests;
+
+    // peer must not send two blocks in one slot
+    if (!verifyProducer(babe_digests.second)) {
+      return ValidationError::TWO_BLOCKS_IN_SLOT;
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> BabeBlockValidator::verifySignatures(
+      const primitives::BlockHash &pre_seal_hash,
+      const std::pair<Seal, BabeBlockHeader> &babe_digests,
+      const primitives::AuthorityId &authority_id,
+      const Threshold &threshold,
+      const Randomness &randomness) const {
+    log_->debug("Validates block signed by authority: {}",
+                authority_id.id.toHex());
+    const auto &[seal, babe_header] = babe_digests;
 
     // signature in seal of the header must be valid
-    if (!verifySignature(header, babe_header, seal, authority_id.id)) {
+    if (!verifySignature(pre_seal_hash, seal, authority_id.id)) {
       return ValidationError::INVALID_SIGNATURE;
     }
 
@@ -93,31 +131,16 @@ namespace kagome::consensus {
     if (!verifyVRF(babe_header, authority_id.id, threshold, randomness)) {
       return ValidationError::INVALID_VRF;
     }
-
-    // peer must not send two blocks in one slot
-    if (!verifyProducer(babe_header)) {
-      return ValidationError::TWO_BLOCKS_IN_SLOT;
-    }
     return outcome::success();
   }
 
   bool BabeBlockValidator::verifySignature(
-      const primitives::BlockHeader &header,
-      const BabeBlockHeader &babe_header,
+      const primitives::BlockHash &pre_seal_hash,
       const Seal &seal,
       const primitives::SessionKey &public_key) const {
-    // firstly, take hash of the block's header without Seal, which is the last
-    // digest
-    auto unsealed_header = header;
-    unsealed_header.digest.pop_back();
-
-    auto unsealed_header_encoded = scale::encode(unsealed_header).value();
-
-    auto block_hash = hasher_->blake2b_256(unsealed_header_encoded);
-
-    // secondly, use verify function to check the signature
-    auto res =
-        sr25519_provider_->verify(seal.signature, block_hash, public_key);
+    // provider takes a mutable span
+    auto message = pre_seal_hash;
+    auto res = sr25519_provider_->verify(seal.signature, message, public_key);
     return res && res.value();
   }
 
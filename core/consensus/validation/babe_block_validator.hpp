@@ -68,18 +68,38 @@ namespace kagome::consensus {
         const Threshold &threshold,
         const Randomness &randomness) const override;
 
+    outcome::result<void> validateHeaderSignatures(
+        const primitives::HashedHeader &header,
+        const primitives::AuthorityId &authority_id,
+        const Threshold &threshold,
+        const Randomness &randomness) const override;
+
+    outcome::result<void> validateHeaderProducer(
+        const primitives::BlockHeader &header) const override;
+
    private:
+    /**
+     * Verify seal signature and VRF of the header
+     * @param pre_seal_hash hash of the header without Seal
+     * @param babe_digests Seal and BabeBlockHeader of the header
+     * @return nothing or validation error
+     */
+    outcome::result<void> verifySignatures(
+        const primitives::BlockHash &pre_seal_hash,
+        const std::pair<Seal, BabeBlockHeader> &babe_digests,
+        const primitives::AuthorityId &authority_id,
+        const Threshold &threshold,
+        const Randomness &randomness) const;
+
     /**
      * Verify that block is signed by valid signature
-     * @param header Header to be checked
-     * @param babe_header BabeBlockHeader corresponding to (fetched from) header
+     * @param pre_seal_hash hash of the header without Seal, which is signed
      * @param seal Seal corresponding to (fetched from) header
      * @param public_key public key that corresponds to the authority by
      * authority index
      * @return true if signature is valid, false otherwise
      */
-    bool verifySignature(const primitives::BlockHeader &header,
-                         const BabeBlockHeader &babe_header,
+    bool verifySignature(const primitives::BlockHash &pre_seal_hash,
                          const Seal &seal,
                          const primitives::SessionKey &public_key) const;
 
@@ -9,6 +9,7 @@
 #include <outcome/outcome.hpp>
 #include "consensus/babe/types/epoch.hpp"
 #include "primitives/block.hpp"
+#include "primitives/hashed_header.hpp"
 
 namespace kagome::consensus {
   /**
@@ -45,6 +46,30 @@ namespace kagome::consensus {
         const primitives::AuthorityId &authority_id,
         const Threshold &threshold,
         const Randomness &randomness) const = 0;
+
+    /**
+     * Validate the parts of the block header, which do not depend on the
+     * state: digests, seal signature and VRF. Can be invoked concurrently
+     * @param block_header to be validated together with its memoized hashes
+     * @param authority_id authority that sent this block
+     * @param threshold is vrf threshold for this epoch
+     * @param randomness is randomness used in this epoch
+     * @return nothing or validation error
+     */
+    virtual outcome::result<void> validateHeaderSignatures(
+        const primitives::HashedHeader &block_header,
+        const primitives::AuthorityId &authority_id,
+        const Threshold &threshold,
+        const Randomness &randomness) const = 0;
+
+    /**
+     * Validate that the producer of the block header has not produced another
+     * block in the same slot, and remember the producer
+     * @param block_header to be validated
+     * @return nothing or validation error
+     */
+    virtual outcome::result<void> validateHeaderProducer(
+        const primitives::BlockHeader &block_header) const = 0;
   };
 }  // namespace kagome::consensus
 
@@ -15,13 +15,17 @@
 #include "api/extrinsic/extrinsic_jrpc_processor.hpp"
 #include "api/extrinsic/impl/extrinsic_api_impl.hpp"
 #include "api/service/api_service.hpp"
+#include "api/service/response_cache.hpp"
 #include "api/state/impl/readonly_trie_builder_impl.hpp"
 #include "api/state/impl/state_api_impl.hpp"
 #include "api/state/state_jrpc_processor.hpp"
+#include "api/subscription/subscription_jrpc_processor.hpp"
+#include "api/transport/rpc_io_context.hpp"
 #include "api/transport/impl/http/http_listener_impl.hpp"
 #include "api/transport/impl/http/http_session.hpp"
 #include "api/transport/impl/ws/ws_listener_impl.hpp"
 #include "api/transport/impl/ws/ws_session.hpp"
+#include "application/execution_config.hpp"
 #include "application/impl/configuration_storage_impl.hpp"
 #include "authorship/impl/block_builder_factory_impl.hpp"
 #include "authorship/impl/block_builder_impl.hpp"
@@ -36,6 +40,7 @@
 #include "common/outcome_throw.hpp"
 #include "consensus/babe/babe_lottery.hpp"
 #include "consensus/babe/common.hpp"
+#include "consensus/babe/impl/block_executor.hpp"
 #include "consensus/babe/impl/babe_lottery_impl.hpp"
 #include "consensus/babe/impl/babe_synchronizer_impl.hpp"
 #include "consensus/babe/impl/epoch_storage_impl.hpp"
@@ -51,6 +56,8 @@
 #include "crypto/sr25519/sr25519_provider_impl.hpp"
 #include "crypto/vrf/vrf_provider_impl.hpp"
 #include "extensions/impl/extension_factory_impl.hpp"
+#include "network/impl/batched_extrinsic_gossiper.hpp"
+#include "network/impl/extrinsic_observer_impl.hpp"
 #include "network/impl/gossiper_broadcast.hpp"
 #include "network/impl/router_libp2p.hpp"
 #include "network/sync_protocol_client.hpp"
@@ -73,6 +80,7 @@
 #include "storage/trie/impl/trie_db_backend_impl.hpp"
 #include "storage/trie/trie_db_reader.hpp"
 #include "transaction_pool/impl/pool_moderator_impl.hpp"
+#include "transaction_pool/impl/pool_revalidator_impl.hpp"
 #include "transaction_pool/impl/transaction_pool_impl.hpp"
 
 namespace kagome::injector {
@@ -125,9 +133,48 @@ namespace kagome::injector {
     std::vector<std::shared_ptr<api::JRpcProcessor>> processors{
         injector.template create<std::shared_ptr<api::StateJrpcProcessor>>(),
         injector
-            .template create<std::shared_ptr<api::ExtrinsicJRpcProcessor>>()};
-    initialized =
-        std::make_shared<api::ApiService>(listeners, server, processors);
+            .template create<std::shared_ptr<api::ExtrinsicJRpcProcessor>>(),
+        injector.template create<
+            std::shared_ptr<api::SubscriptionJrpcProcessor>>()};
+    initialized = std::make_shared<api::ApiService>(
+        injector.template create<sptr<api::RpcExecutor>>(),
+        listeners,
+        server,
+        processors);
+    return initialized.value();
+  };
+
+  // subscription engine getter, the engine observes the block tree
+  auto get_subscription_engine =
+      [](const auto &injector) -> sptr<api::SubscriptionEngine> {
+    static auto initialized =
+        boost::optional<sptr<api::SubscriptionEngine>>(boost::none);
+    if (initialized) {
+      return initialized.value();
+    }
+    auto block_tree = injector.template create<sptr<blockchain::BlockTree>>();
+    auto engine = std::make_shared<api::SubscriptionEngine>(
+        injector.template create<sptr<blockchain::BlockHeaderRepository>>(),
+        block_tree,
+        injector.template create<sptr<api::ReadonlyTrieBuilder>>());
+    block_tree->addObserver(engine);
+    initialized = engine;
+    return initialized.value();
+  };
+
+  // rpc response cache getter, the cache observes pruning of the block tree
+  auto get_response_cache =
+      [](const auto &injector) -> sptr<api::ResponseCache> {
+    static auto initialized =
+        boost::optional<sptr<api::ResponseCache>>(boost::none);
+    if (initialized) {
+      return initialized.value();
+    }
+    auto cache = std::make_shared<api::ResponseCache>(
+        injector.template create<api::ResponseCache::Configuration>());
+    injector.template create<sptr<blockchain::BlockTree>>()->addObserver(
+        cache);
+    initialized = cache;
     return initialized.value();
   };
 
@@ -141,7 +188,7 @@ namespace kagome::injector {
       return initialized.value();
     }
 
-    auto &context = injector.template create<boost::asio::io_context &>();
+    auto &context = injector.template create<api::RpcContext &>();
     auto extrinsic_tcp_version = boost::asio::ip::tcp::v4();
     api::HttpListenerImpl::Configuration listener_config{
         boost::asio::ip::tcp::endpoint{extrinsic_tcp_version, rpc_port}};
@@ -162,7 +209,7 @@ namespace kagome::injector {
       return initialized.value();
     }
 
-    auto &context = injector.template create<boost::asio::io_context &>();
+    auto &context = injector.template create<api::RpcContext &>();
     auto extrinsic_tcp_version = boost::asio::ip::tcp::v4();
     api::WsListenerImpl::Configuration listener_config{
         boost::asio::ip::tcp::endpoint{extrinsic_tcp_version, rpc_port}};
@@ -392,6 +439,8 @@ namespace kagome::injector {
     auto block_tree = injector.template create<sptr<blockchain::BlockTree>>();
     auto block_header_repository =
         injector.template create<sptr<blockchain::BlockHeaderRepository>>();
+    auto io_context =
+        injector.template create<sptr<boost::asio::io_context>>();
 
     auto res = std::make_shared<network::SyncClientsSet>();
     auto current_peer_synchronizer =
@@ -406,6 +455,7 @@ namespace kagome::injector {
             peer_info,
             block_tree,
             block_header_repository,
+            io_context,
             injector.template create<consensus::SynchronizerConfig>()));
       }
     }
@@ -413,6 +463,22 @@ namespace kagome::injector {
     return res;
   };
 
+  auto get_extrinsic_gossiper =
+      [](const auto &injector) -> sptr<network::ExtrinsicGossiper> {
+    static auto initialized =
+        boost::optional<sptr<network::ExtrinsicGossiper>>(boost::none);
+    if (initialized) {
+      return *initialized;
+    }
+
+    // transactions are collected into batches before they get to the peers
+    initialized = std::make_shared<network::BatchedExtrinsicGossiper>(
+        injector.template create<sptr<network::Gossiper>>(),
+        injector.template create<sptr<boost::asio::io_context>>(),
+        injector.template create<network::BatchedExtrinsicGossiper::Params>());
+    return *initialized;
+  };
+
   auto get_babe_configuration =
       [](const auto &injector) -> sptr<primitives::BabeConfiguration> {
     static auto initialized =
@@ -437,6 +503,7 @@ namespace kagome::injector {
                                const std::string &leveldb_path,
                                uint16_t rpc_http_port,
                                uint16_t rpc_ws_port,
+                               const application::ExecutionConfig &execution,
                                Ts &&... args) {
     using namespace boost;  // NOLINT;
 
@@ -444,15 +511,31 @@ namespace kagome::injector {
     api::HttpSession::Configuration http_config{};
     api::WsSession::Configuration ws_config{};
     transaction_pool::PoolModeratorImpl::Params pool_moderator_config{};
+    transaction_pool::PoolRevalidatorImpl::Params pool_revalidator_config{};
     consensus::SynchronizerConfig synchronizer_config{};
     transaction_pool::TransactionPool::Limits tp_pool_limits{};
+    network::BatchedExtrinsicGossiper::Params extrinsic_gossiper_config{};
+    authorship::ProposerImpl::Limits proposer_limits{};
+    // threads of all the components are bounded by the same config
+    const auto threads = execution.resolved();
+    consensus::BlockExecutor::Params block_executor_config{
+        threads.import_workers};
+    api::RpcExecutor::Params rpc_executor_config{};
+    api::ResponseCache::Configuration response_cache_config{};
+    rpc_executor_config.workers = threads.rpc_workers;
     return di::make_injector(
         // bind configs
         injector::useConfig(http_config),
         injector::useConfig(ws_config),
         injector::useConfig(pool_moderator_config),
+        injector::useConfig(pool_revalidator_config),
         injector::useConfig(synchronizer_config),
         injector::useConfig(tp_pool_limits),
+        injector::useConfig(extrinsic_gossiper_config),
+        injector::useConfig(proposer_limits),
+        injector::useConfig(block_executor_config),
+        injector::useConfig(rpc_executor_config),
+        injector::useConfig(response_cache_config),
 
         // inherit host injector
         libp2p::injector::makeHostInjector(),
@@ -462,6 +545,8 @@ namespace kagome::injector {
         // bind io_context: 1 per injector
         di::bind<::boost::asio::io_context>.in(
             di::extension::shared)[boost::di::override],
+        // bind io_context of the rpc transport: 1 per injector
+        di::bind<api::RpcContext>.in(di::extension::shared),
 
         // bind interfaces
         di::bind<api::HttpListenerImpl>.to(
@@ -475,6 +560,9 @@ namespace kagome::injector {
         di::bind<api::ExtrinsicApi>.template to<api::ExtrinsicApiImpl>(),
         di::bind<api::StateApi>.template to<api::StateApiImpl>(),
         di::bind<api::ApiService>.to(std::move(get_jrpc_api_service)),
+        di::bind<api::SubscriptionEngine>.to(
+            std::move(get_subscription_engine)),
+        di::bind<api::ResponseCache>.to(std::move(get_response_cache)),
         di::bind<api::JRpcServer>.template to<api::JRpcServerImpl>(),
         di::bind<authorship::Proposer>.template to<authorship::ProposerImpl>(),
         di::bind<authorship::BlockBuilder>.template to<authorship::BlockBuilderImpl>(),
@@ -505,6 +593,8 @@ namespace kagome::injector {
         di::bind<consensus::BabeGossiper>.template to<network::GossiperBroadcast>(),
         di::bind<consensus::grandpa::Gossiper>.template to<network::GossiperBroadcast>(),
         di::bind<network::Gossiper>.template to<network::GossiperBroadcast>(),
+        di::bind<network::ExtrinsicGossiper>.to(std::move(get_extrinsic_gossiper)),
+        di::bind<network::ExtrinsicObserver>.template to<network::ExtrinsicObserverImpl>(),
         di::bind<network::SyncClientsSet>.to(std::move(get_sync_clients_set)),
         di::bind<network::SyncProtocolClient>.template to<consensus::SynchronizerImpl>(),
         di::bind<network::SyncProtocolObserver>.template to<consensus::SynchronizerImpl>(),
@@ -518,6 +608,7 @@ namespace kagome::injector {
         di::bind<runtime::BlockBuilder>.template to<runtime::binaryen::BlockBuilderImpl>(),
         di::bind<transaction_pool::TransactionPool>.template to<transaction_pool::TransactionPoolImpl>(),
         di::bind<transaction_pool::PoolModerator>.template to<transaction_pool::PoolModeratorImpl>(),
+        di::bind<transaction_pool::PoolRevalidator>.template to<transaction_pool::PoolRevalidatorImpl>(),
         di::bind<storage::trie::TrieDbBackend>.to(
             std::move(get_polkadot_trie_db_backend)),
         di::bind<storage::trie::PolkadotTrieDb>.to(
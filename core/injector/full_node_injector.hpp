@@ -129,6 +129,7 @@ namespace kagome::injector {
         injector.template create<sptr<consensus::EpochStorage>>(),
         injector.template create<sptr<primitives::BabeConfiguration>>(),
         injector.template create<sptr<authorship::Proposer>>(),
+        injector.template create<sptr<transaction_pool::PoolRevalidator>>(),
         injector.template create<sptr<blockchain::BlockTree>>(),
         injector.template create<sptr<network::Gossiper>>(),
         injector.template create<crypto::SR25519Keypair>(),
@@ -147,12 +148,17 @@ namespace kagome::injector {
                             uint16_t p2p_port,
                             uint16_t rpc_http_port,
                             uint16_t rpc_ws_port,
+                            const application::ExecutionConfig &execution,
                             Ts &&... args) {
     using namespace boost;  // NOLINT;
 
+    consensus::grandpa::LauncherImpl::Params launcher_config{
+        execution.resolved().vote_workers};
+
     return di::make_injector(
         makeApplicationInjector(
-            genesis_path, leveldb_path, rpc_http_port, rpc_ws_port),
+            genesis_path, leveldb_path, rpc_http_port, rpc_ws_port, execution),
+        injector::useConfig(launcher_config),
         // bind sr25519 keypair
         di::bind<crypto::SR25519Keypair>.to(std::move(get_sr25519_keypair)),
         // bind ed25519 keypair
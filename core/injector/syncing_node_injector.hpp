@@ -55,6 +55,7 @@ namespace kagome::injector {
                                uint16_t p2p_port,
                                uint16_t rpc_http_port,
                                uint16_t rpc_ws_port,
+                               const application::ExecutionConfig &execution,
                                Ts &&... args) {
     using namespace boost;  // NOLINT;
 
@@ -62,7 +63,7 @@ namespace kagome::injector {
 
         // inherit application injector
         makeApplicationInjector(
-            genesis_path, leveldb_path, rpc_http_port, rpc_ws_port),
+            genesis_path, leveldb_path, rpc_http_port, rpc_ws_port, execution),
 
         // peer info
         di::bind<libp2p::peer::PeerInfo>.to([p2p_port](const auto &injector) {
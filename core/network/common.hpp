@@ -9,7 +9,10 @@
 #include "libp2p/peer/protocol.hpp"
 
 namespace kagome::network {
+  /// one blocks request is sent per stream
   const libp2p::peer::Protocol kSyncProtocol = "/polkadot-sync/1.0.0";
+  /// blocks requests are pipelined over a long-lived stream
+  const libp2p::peer::Protocol kSyncPipelinedProtocol = "/polkadot-sync/1.1.0";
   const libp2p::peer::Protocol kGossipProtocol = "/polkadot-gossip/1.0.0";
 }  // namespace kagome::network
 
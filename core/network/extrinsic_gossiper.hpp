@@ -0,0 +1,28 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_EXTRINSIC_GOSSIPER_HPP
+#define KAGOME_EXTRINSIC_GOSSIPER_HPP
+
+#include <gsl/span>
+#include "primitives/transaction.hpp"
+
+namespace kagome::network {
+  /**
+   * Sends transactions over the Gossip protocol
+   */
+  struct ExtrinsicGossiper {
+    virtual ~ExtrinsicGossiper() = default;
+
+    /**
+     * Send transactions to the peers, which do not know them yet
+     * @param txs to be sent
+     */
+    virtual void propagateTransactions(
+        gsl::span<const primitives::Transaction> txs) = 0;
+  };
+}  // namespace kagome::network
+
+#endif  // KAGOME_EXTRINSIC_GOSSIPER_HPP
@@ -0,0 +1,26 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_EXTRINSIC_OBSERVER_HPP
+#define KAGOME_EXTRINSIC_OBSERVER_HPP
+
+#include "network/types/transaction_announce.hpp"
+
+namespace kagome::network {
+  /**
+   * Reacts to transactions, which are received from the network
+   */
+  struct ExtrinsicObserver {
+    virtual ~ExtrinsicObserver() = default;
+
+    /**
+     * Triggered when a TransactionAnnounce message arrives
+     * @param announce - arrived message
+     */
+    virtual void onTxMessage(const TransactionAnnounce &announce) = 0;
+  };
+}  // namespace kagome::network
+
+#endif  // KAGOME_EXTRINSIC_OBSERVER_HPP
@@ -8,18 +8,34 @@
 
 #include "consensus/babe/babe_gossiper.hpp"
 #include "consensus/grandpa/gossiper.hpp"
+#include "network/extrinsic_gossiper.hpp"
 
 #include <libp2p/connection/stream.hpp>
+#include <libp2p/peer/peer_id.hpp>
+#include "network/types/gossip_message.hpp"
+#include "network/types/transaction_announce.hpp"
 
 namespace kagome::network {
   /**
    * Joins all available gossipers
    */
   struct Gossiper : public consensus::BabeGossiper,
-                    public consensus::grandpa::Gossiper {
+                    public consensus::grandpa::Gossiper,
+                    public ExtrinsicGossiper {
     // Add new stream to gossip
     virtual void addStream(
         std::shared_ptr<libp2p::connection::Stream> stream) = 0;
+
+    // Remember that the message was received from the peer, so that it is not
+    // sent back to this peer
+    virtual void markKnown(const libp2p::peer::PeerId &peer_id,
+                           const GossipMessage &msg) = 0;
+
+    // Remember that the transactions of the decoded announce were received
+    // from the peer: they are gossiped in batches, so they are known one by
+    // one
+    virtual void markKnown(const libp2p::peer::PeerId &peer_id,
+                           const TransactionAnnounce &announce) = 0;
   };
 }  // namespace kagome::network
 
@@ -0,0 +1,115 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/helpers/blocks_response_decoder.hpp"
+
+#include <boost/assert.hpp>
+#include "scale/scale_decoder_stream.hpp"
+#include "scale/scale_error.hpp"
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::network, BlocksResponseDecoder::Error, e) {
+  using E = kagome::network::BlocksResponseDecoder::Error;
+  switch (e) {
+    case E::UNEXPECTED_END:
+      return "blocks response ended before all blocks were decoded";
+    case E::EXTRA_DATA:
+      return "blocks response contains data after the last block";
+  }
+  return "unknown error";
+}
+
+namespace kagome::network {
+
+  BlocksResponseDecoder::BlocksResponseDecoder(size_t message_size)
+      : message_size_{message_size} {}
+
+  outcome::result<void> BlocksResponseDecoder::feed(
+      gsl::span<const uint8_t> bytes) {
+    if (static_cast<size_t>(bytes.size()) > remaining()) {
+      return Error::EXTRA_DATA;
+    }
+    received_ += bytes.size();
+    buffer_.insert(buffer_.end(), bytes.begin(), bytes.end());
+    OUTCOME_TRY(decodeBuffered());
+
+    if (remaining() == 0) {
+      if (stage_ != Stage::FINISHED) {
+        return Error::UNEXPECTED_END;
+      }
+      if (offset_ != buffer_.size()) {
+        return Error::EXTRA_DATA;
+      }
+    }
+    return outcome::success();
+  }
+
+  size_t BlocksResponseDecoder::remaining() const {
+    return message_size_ - received_;
+  }
+
+  bool BlocksResponseDecoder::finished() const {
+    return stage_ == Stage::FINISHED and remaining() == 0;
+  }
+
+  BlocksResponse BlocksResponseDecoder::takeResponse() {
+    BOOST_ASSERT(finished());
+    return std::move(response_);
+  }
+
+  outcome::result<void> BlocksResponseDecoder::decodeBuffered() {
+    // the last part of the message must be decoded in any case
+    if (buffer_.size() - offset_ < retry_size_ and remaining() != 0) {
+      return outcome::success();
+    }
+
+    while (stage_ != Stage::FINISHED and offset_ < buffer_.size()) {
+      gsl::span<const uint8_t> buffered{buffer_};
+      scale::ScaleDecoderStream s{buffered.subspan(offset_)};
+      try {
+        switch (stage_) {
+          case Stage::ID:
+            s >> response_.id;
+            stage_ = Stage::BLOCKS_COUNT;
+            break;
+          case Stage::BLOCKS_COUNT: {
+            scale::CompactInteger blocks_count;
+            s >> blocks_count;
+            blocks_left_ = blocks_count.convert_to<size_t>();
+            stage_ = blocks_left_ == 0 ? Stage::FINISHED : Stage::BLOCKS;
+            break;
+          }
+          case Stage::BLOCKS: {
+            primitives::BlockData block_data;
+            s >> block_data;
+            response_.blocks.push_back(std::move(block_data));
+            if (--blocks_left_ == 0) {
+              stage_ = Stage::FINISHED;
+            }
+            break;
+          }
+          case Stage::FINISHED:
+            break;
+        }
+      } catch (std::system_error &e) {
+        if (e.code() != scale::DecodeError::NOT_ENOUGH_DATA) {
+          return e.code();
+        }
+        // wait until the buffered part of the item doubles
+        retry_size_ = 2 * (buffer_.size() - offset_);
+        break;
+      }
+      offset_ += s.currentIndex();
+      retry_size_ = 0;
+    }
+
+    // drop the decoded bytes, once they take most of the buffer
+    if (offset_ > buffer_.size() / 2) {
+      buffer_.erase(buffer_.begin(), buffer_.begin() + offset_);
+      offset_ = 0;
+    }
+    return outcome::success();
+  }
+
+}  // namespace kagome::network
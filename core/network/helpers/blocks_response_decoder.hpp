@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_BLOCKS_RESPONSE_DECODER_HPP
+#define KAGOME_BLOCKS_RESPONSE_DECODER_HPP
+
+#include <vector>
+
+#include <gsl/span>
+#include <outcome/outcome.hpp>
+#include "network/types/blocks_response.hpp"
+
+namespace kagome::network {
+
+  /**
+   * Decodes SCALE-encoded BlocksResponse from the parts of the message, as
+   * they are received, so that the whole encoded message is not kept in
+   * memory and decoding goes along with receiving
+   */
+  class BlocksResponseDecoder {
+   public:
+    enum class Error { UNEXPECTED_END = 1, EXTRA_DATA };
+
+    /**
+     * @param message_size - size of the whole encoded message
+     */
+    explicit BlocksResponseDecoder(size_t message_size);
+
+    /**
+     * Decode the next part \param bytes of the message; blocks are decoded as
+     * soon as all their bytes are received
+     * @return error if the message is malformed or is bigger than expected
+     */
+    outcome::result<void> feed(gsl::span<const uint8_t> bytes);
+
+    /// @return number of bytes of the message, which are not received yet
+    size_t remaining() const;
+
+    /// @return true if the whole message is received and decoded
+    bool finished() const;
+
+    /**
+     * Take the decoded response, must be called after the decoder is finished
+     */
+    BlocksResponse takeResponse();
+
+   private:
+    enum class Stage { ID, BLOCKS_COUNT, BLOCKS, FINISHED };
+
+    /// Decode as much of the buffered bytes as possible
+    outcome::result<void> decodeBuffered();
+
+    size_t message_size_;
+    size_t received_{0};
+    Stage stage_{Stage::ID};
+    size_t blocks_left_{0};
+    BlocksResponse response_;
+
+    /// received bytes, which are not decoded yet, start at offset_
+    std::vector<uint8_t> buffer_;
+    size_t offset_{0};
+    /// decoding of the incomplete item is retried once so many bytes are
+    /// buffered, so that big items are not decoded again on each part
+    size_t retry_size_{0};
+  };
+
+}  // namespace kagome::network
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::network, BlocksResponseDecoder::Error);
+
+#endif  // KAGOME_BLOCKS_RESPONSE_DECODER_HPP
@@ -5,6 +5,8 @@
 
 #include "network/helpers/scale_message_read_writer.hpp"
 
+#include <boost/assert.hpp>
+
 namespace kagome::network {
   ScaleMessageReadWriter::ScaleMessageReadWriter(
       std::shared_ptr<libp2p::basic::MessageReadWriter> read_writer)
@@ -14,4 +16,20 @@ namespace kagome::network {
       const std::shared_ptr<libp2p::basic::ReadWriter> &read_writer)
       : read_writer_{std::make_shared<libp2p::basic::MessageReadWriterUvarint>(
           read_writer)} {}
+
+  void ScaleMessageReadWriter::writeEncoded(
+      std::shared_ptr<const std::vector<uint8_t>> encoded_msg,
+      libp2p::basic::Writer::WriteCallbackFunc cb) const {
+    BOOST_ASSERT(encoded_msg != nullptr);
+    const auto &msg = *encoded_msg;
+    read_writer_->write(msg,
+                        [self{shared_from_this()},
+                         encoded_msg = std::move(encoded_msg),
+                         cb = std::move(cb)](auto &&write_res) {
+                          if (!write_res) {
+                            return cb(write_res.error());
+                          }
+                          cb(outcome::success());
+                        });
+  }
 }  // namespace kagome::network
@@ -78,6 +78,15 @@ namespace kagome::network {
                           });
     }
 
+    /**
+     * Write an already SCALE-encoded message to the channel; allows to encode
+     * a message once and write it to several channels
+     * @param encoded_msg to be written; kept alive until the write is finished
+     * @param cb to be called, when the message is written, or error happens
+     */
+    void writeEncoded(std::shared_ptr<const std::vector<uint8_t>> encoded_msg,
+                      libp2p::basic::Writer::WriteCallbackFunc cb) const;
+
    private:
     std::shared_ptr<libp2p::basic::MessageReadWriter> read_writer_;
   };
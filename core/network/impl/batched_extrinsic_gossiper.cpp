@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/batched_extrinsic_gossiper.hpp"
+
+namespace kagome::network {
+
+  BatchedExtrinsicGossiper::BatchedExtrinsicGossiper(
+      std::shared_ptr<ExtrinsicGossiper> gossiper,
+      std::shared_ptr<boost::asio::io_context> io_context,
+      Params params)
+      : gossiper_{std::move(gossiper)},
+        params_{params},
+        timer_{*io_context},
+        logger_{common::createLogger("BatchedExtrinsicGossiper")} {
+    BOOST_ASSERT(gossiper_ != nullptr);
+  }
+
+  void BatchedExtrinsicGossiper::propagateTransactions(
+      gsl::span<const primitives::Transaction> txs) {
+    for (const auto &tx : txs) {
+      batch_.push_back(tx);
+      batch_bytes_ += tx.bytes;
+    }
+    if (batch_.empty()) {
+      return;
+    }
+    if (batch_bytes_ >= params_.max_batch_bytes) {
+      return flush();
+    }
+    if (timer_armed_) {
+      return;
+    }
+
+    timer_armed_ = true;
+    timer_.expires_after(params_.flush_interval);
+    timer_.async_wait([self_wp{weak_from_this()}](const auto &ec) {
+      auto self = self_wp.lock();
+      // timer is cancelled, when the batch is flushed because of its size
+      if (not self or ec == boost::asio::error::operation_aborted) {
+        return;
+      }
+      self->flush();
+    });
+  }
+
+  void BatchedExtrinsicGossiper::flush() {
+    if (timer_armed_) {
+      timer_armed_ = false;
+      timer_.cancel();
+    }
+    auto batch = std::move(batch_);
+    batch_.clear();
+    batch_bytes_ = 0;
+
+    logger_->debug("Propagate batch of {} transactions", batch.size());
+    gossiper_->propagateTransactions(batch);
+  }
+
+}  // namespace kagome::network
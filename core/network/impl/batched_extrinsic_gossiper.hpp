@@ -0,0 +1,76 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_BATCHED_EXTRINSIC_GOSSIPER_HPP
+#define KAGOME_BATCHED_EXTRINSIC_GOSSIPER_HPP
+
+#include "network/extrinsic_gossiper.hpp"
+
+#include <chrono>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include "common/logger.hpp"
+
+namespace kagome::network {
+
+  /**
+   * Collects transactions into batches, which are passed to the underlying
+   * gossiper, when the batch gets big enough or when its flush interval is
+   * over, so transactions submitted at about the same time share a message
+   */
+  class BatchedExtrinsicGossiper
+      : public ExtrinsicGossiper,
+        public std::enable_shared_from_this<BatchedExtrinsicGossiper> {
+   public:
+    /**
+     * Default size of the batch, which is sent at once
+     */
+    static constexpr size_t kDefaultMaxBatchBytes = 64 * 1024;
+
+    /**
+     * Default time, for which the first transaction of a batch may wait
+     */
+    static constexpr std::chrono::milliseconds kDefaultFlushInterval{100};
+
+    /**
+     * @param max_batch_bytes total size of the transactions, after which the
+     * batch is sent without waiting
+     * @param flush_interval time, after which the batch is sent regardless of
+     * its size
+     */
+    struct Params {
+      size_t max_batch_bytes = kDefaultMaxBatchBytes;
+      std::chrono::milliseconds flush_interval = kDefaultFlushInterval;
+    };
+
+    BatchedExtrinsicGossiper(
+        std::shared_ptr<ExtrinsicGossiper> gossiper,
+        std::shared_ptr<boost::asio::io_context> io_context,
+        Params params);
+
+    ~BatchedExtrinsicGossiper() override = default;
+
+    void propagateTransactions(
+        gsl::span<const primitives::Transaction> txs) override;
+
+   private:
+    /// Pass the collected batch to the gossiper
+    void flush();
+
+    std::shared_ptr<ExtrinsicGossiper> gossiper_;
+    Params params_;
+    boost::asio::steady_timer timer_;
+    bool timer_armed_{false};
+
+    std::vector<primitives::Transaction> batch_;
+    size_t batch_bytes_{0};
+
+    common::Logger logger_;
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_BATCHED_EXTRINSIC_GOSSIPER_HPP
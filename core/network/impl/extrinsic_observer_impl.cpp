@@ -0,0 +1,29 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/extrinsic_observer_impl.hpp"
+
+namespace kagome::network {
+
+  ExtrinsicObserverImpl::ExtrinsicObserverImpl(
+      std::shared_ptr<api::ExtrinsicApi> extrinsic_api)
+      : extrinsic_api_{std::move(extrinsic_api)},
+        logger_{common::createLogger("ExtrinsicObserver")} {
+    BOOST_ASSERT(extrinsic_api_ != nullptr);
+  }
+
+  void ExtrinsicObserverImpl::onTxMessage(const TransactionAnnounce &announce) {
+    for (const auto &ext : announce.extrinsics) {
+      // transactions, which are already in the pool or invalid, are expected
+      // in gossip, so they are not reported as errors
+      if (auto submit_res = extrinsic_api_->submitExtrinsic(ext);
+          not submit_res) {
+        logger_->debug("Received transaction is not imported: {}",
+                       submit_res.error().message());
+      }
+    }
+  }
+
+}  // namespace kagome::network
@@ -0,0 +1,37 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_EXTRINSIC_OBSERVER_IMPL_HPP
+#define KAGOME_EXTRINSIC_OBSERVER_IMPL_HPP
+
+#include "network/extrinsic_observer.hpp"
+
+#include "api/extrinsic/extrinsic_api.hpp"
+#include "common/logger.hpp"
+
+namespace kagome::network {
+
+  /**
+   * Submits transactions received from the network as if they were submitted
+   * through RPC, so they are validated, imported to the pool and propagated
+   * further
+   */
+  class ExtrinsicObserverImpl : public ExtrinsicObserver {
+   public:
+    explicit ExtrinsicObserverImpl(
+        std::shared_ptr<api::ExtrinsicApi> extrinsic_api);
+
+    ~ExtrinsicObserverImpl() override = default;
+
+    void onTxMessage(const TransactionAnnounce &announce) override;
+
+   private:
+    std::shared_ptr<api::ExtrinsicApi> extrinsic_api_;
+    common::Logger logger_;
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_EXTRINSIC_OBSERVER_IMPL_HPP
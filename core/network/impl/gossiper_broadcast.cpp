@@ -5,16 +5,21 @@
 
 #include "network/impl/gossiper_broadcast.hpp"
 
+#include <algorithm>
+
 #include <boost/assert.hpp>
 #include "network/common.hpp"
-#include "network/helpers/scale_message_read_writer.hpp"
 
 namespace kagome::network {
 
   GossiperBroadcast::GossiperBroadcast(libp2p::Host &host,
-                                       const PeerList &peer_infos)
-      : host_{host}, logger_{common::createLogger("GossiperBroadcast")} {
+                                       const PeerList &peer_infos,
+                                       std::shared_ptr<crypto::Hasher> hasher)
+      : host_{host},
+        hasher_{std::move(hasher)},
+        logger_{common::createLogger("GossiperBroadcast")} {
     BOOST_ASSERT(!peer_infos.peers.empty());
+    BOOST_ASSERT(hasher_ != nullptr);
 
     streams_.reserve(peer_infos.peers.size());
     for (const auto &info : peer_infos.peers) {
@@ -52,59 +57,281 @@ namespace kagome::network {
     broadcast(std::move(message));
   }
 
+  void GossiperBroadcast::propagateTransactions(
+      gsl::span<const primitives::Transaction> txs) {
+    if (txs.empty()) {
+      return;
+    }
+    logger_->debug("Gossip {} transactions", txs.size());
+    auto batch = std::make_shared<TransactionsBatch>();
+    batch->hashes.reserve(txs.size());
+    batch->announce.extrinsics.reserve(txs.size());
+    for (const auto &tx : txs) {
+      batch->hashes.push_back(tx.hash);
+      batch->announce.extrinsics.push_back(tx.ext);
+    }
+
+    // message with the whole batch is encoded once and shared by the peers,
+    // which know none of its transactions
+    GossipMessage message;
+    message.type = GossipMessage::Type::TRANSACTIONS;
+    message.data.put(scale::encode(batch->announce).value());
+    auto encoded_res = scale::encode(message);
+    if (!encoded_res) {
+      logger_->error("Could not encode gossip message: {}",
+                     encoded_res.error().message());
+      return;
+    }
+    batch->encoded = std::make_shared<const std::vector<uint8_t>>(
+        std::move(encoded_res.value()));
+
+    forEachStream([self{shared_from_this()},
+                   batch{std::shared_ptr<const TransactionsBatch>(batch)}](
+                      const auto &stream) {
+      self->enqueueTransactions(stream, *batch);
+    });
+  }
+
   void GossiperBroadcast::addStream(
       std::shared_ptr<libp2p::connection::Stream> stream) {
     syncing_streams_.push_back(stream);
   }
 
+  void GossiperBroadcast::markKnown(const libp2p::peer::PeerId &peer_id,
+                                    const GossipMessage &msg) {
+    auto encoded_res = scale::encode(msg);
+    if (!encoded_res) {
+      return;
+    }
+    addKnown(peer_id, hasher_->blake2b_256(encoded_res.value()));
+  }
+
+  void GossiperBroadcast::markKnown(const libp2p::peer::PeerId &peer_id,
+                                    const TransactionAnnounce &announce) {
+    for (const auto &ext : announce.extrinsics) {
+      addKnown(peer_id, hasher_->blake2b_256(ext.data));
+    }
+  }
+
   void GossiperBroadcast::broadcast(GossipMessage &&msg) {
-    auto msg_send_lambda = [msg](auto stream) {
-      auto read_writer =
-          std::make_shared<ScaleMessageReadWriter>(std::move(stream));
-      read_writer->write(
-          msg,
-          [](auto &&) {  // we have nowhere to report the error to
-          });
-    };
+    auto encoded_res = scale::encode(msg);
+    if (!encoded_res) {
+      logger_->error("Could not encode gossip message: {}",
+                     encoded_res.error().message());
+      return;
+    }
+    auto hash = hasher_->blake2b_256(encoded_res.value());
+    EncodedMessage encoded =
+        std::make_shared<const std::vector<uint8_t>>(
+            std::move(encoded_res.value()));
+    auto is_consensus = msg.type == GossipMessage::Type::CONSENSUS;
+
+    forEachStream([self{shared_from_this()}, encoded, hash, is_consensus](
+                      const auto &stream) {
+      self->enqueue(stream, encoded, hash, is_consensus);
+    });
+  }
 
+  void GossiperBroadcast::forEachStream(
+      const std::function<void(const std::shared_ptr<Stream> &)> &send) {
     // iterate over the existing streams and send them the msg. If stream is
     // closed it is removed
     auto stream_it = syncing_streams_.begin();
     while (stream_it != syncing_streams_.end()) {
       auto stream = *stream_it;
       if (stream && !stream->isClosed()) {
-        msg_send_lambda(stream);
+        send(stream);
         stream_it++;
       } else {
         // remove this stream
+        removeStream(stream);
         stream_it = syncing_streams_.erase(stream_it);
       }
     }
     for (const auto &[info, stream] : streams_) {
       if (stream && !stream->isClosed()) {
-        msg_send_lambda(stream);
+        send(stream);
         continue;
       }
+      removeStream(stream);
       // if stream does not exist or expired, open a new one
-      host_.newStream(info,
-                      kGossipProtocol,
-                      [self{shared_from_this()}, info = info, msg_send_lambda](
-                          auto &&stream_res) mutable {
-                        if (!stream_res) {
-                          // we will try to open the stream again, when
-                          // another gossip message arrives later
-                          self->logger_->error(
-                              "Could not send message to {} Error: {}",
-                              info.id.toBase58(),
-                              stream_res.error().message());
-                          return;
-                        }
-
-                        // save the stream and send the message
-                        self->streams_[info] = stream_res.value();
-                        msg_send_lambda(std::move(stream_res.value()));
-                      });
+      host_.newStream(
+          info,
+          kGossipProtocol,
+          [self{shared_from_this()}, info = info, send](
+              auto &&stream_res) mutable {
+            if (!stream_res) {
+              // we will try to open the stream again, when
+              // another gossip message arrives later
+              self->logger_->error("Could not send message to {} Error: {}",
+                                   info.id.toBase58(),
+                                   stream_res.error().message());
+              return;
+            }
+
+            // save the stream and send the message
+            self->streams_[info] = stream_res.value();
+            send(stream_res.value());
+          });
+    }
+  }
+
+  void GossiperBroadcast::enqueue(const std::shared_ptr<Stream> &stream,
+                                  const EncodedMessage &msg,
+                                  const common::Hash256 &hash,
+                                  bool is_consensus) {
+    if (auto peer_id_res = stream->remotePeerId();
+        peer_id_res && !addKnown(peer_id_res.value(), hash)) {
+      // peer has already got this message
+      return;
+    }
+
+    push(stream, msg, is_consensus);
+  }
+
+  void GossiperBroadcast::enqueueTransactions(
+      const std::shared_ptr<Stream> &stream, const TransactionsBatch &batch) {
+    auto peer_id_res = stream->remotePeerId();
+    if (!peer_id_res) {
+      return push(stream, batch.encoded, false);
+    }
+
+    std::vector<size_t> unknown;
+    for (size_t i = 0; i < batch.hashes.size(); ++i) {
+      if (addKnown(peer_id_res.value(), batch.hashes[i])) {
+        unknown.push_back(i);
+      }
+    }
+    if (unknown.empty()) {
+      // peer has already got all of the transactions
+      return;
+    }
+    if (unknown.size() == batch.hashes.size()) {
+      return push(stream, batch.encoded, false);
+    }
+
+    TransactionAnnounce announce;
+    announce.extrinsics.reserve(unknown.size());
+    for (auto i : unknown) {
+      announce.extrinsics.push_back(batch.announce.extrinsics[i]);
+    }
+    GossipMessage message;
+    message.type = GossipMessage::Type::TRANSACTIONS;
+    message.data.put(scale::encode(announce).value());
+    auto encoded_res = scale::encode(message);
+    if (!encoded_res) {
+      logger_->error("Could not encode gossip message: {}",
+                     encoded_res.error().message());
+      return;
+    }
+    push(stream,
+         std::make_shared<const std::vector<uint8_t>>(
+             std::move(encoded_res.value())),
+         false);
+  }
+
+  void GossiperBroadcast::push(const std::shared_ptr<Stream> &stream,
+                               const EncodedMessage &msg,
+                               bool is_consensus) {
+    auto &queue = send_queues_[stream];
+    if (!queue.read_writer) {
+      queue.read_writer = std::make_shared<ScaleMessageReadWriter>(stream);
+    }
+    (is_consensus ? queue.consensus : queue.announces).push_back(msg);
+
+    // slow peer: drop the oldest message, announces go first
+    if (queue.consensus.size() + queue.announces.size() > kMaxQueueSize) {
+      logger_->debug("Gossip queue of a stream is full, dropping a message");
+      if (!queue.announces.empty()) {
+        queue.announces.pop_front();
+      } else {
+        queue.consensus.pop_front();
+      }
+    }
+
+    if (!queue.writing) {
+      writeNext(stream);
+    }
+  }
+
+  void GossiperBroadcast::writeNext(const std::shared_ptr<Stream> &stream) {
+    auto queue_it = send_queues_.find(stream);
+    if (queue_it == send_queues_.end()) {
+      return;
+    }
+    auto &queue = queue_it->second;
+    auto &messages =
+        queue.consensus.empty() ? queue.announces : queue.consensus;
+    if (messages.empty()) {
+      queue.writing = false;
+      return;
+    }
+    auto msg = std::move(messages.front());
+    messages.pop_front();
+
+    queue.writing = true;
+    queue.read_writer->writeEncoded(
+        std::move(msg),
+        [self_weak{weak_from_this()}, stream](auto &&write_res) {
+          auto self = self_weak.lock();
+          if (!self) {
+            return;
+          }
+          if (!write_res) {
+            // we have nowhere to report the error to; stream will be
+            // removed or reopened on the next broadcast
+            self->send_queues_.erase(stream);
+            return;
+          }
+          self->writeNext(stream);
+        });
+  }
+
+  void GossiperBroadcast::removeStream(const std::shared_ptr<Stream> &stream) {
+    if (!stream) {
+      return;
+    }
+    send_queues_.erase(stream);
+    auto peer_id_res = stream->remotePeerId();
+    if (!peer_id_res) {
+      return;
+    }
+
+    // messages known by the peer are forgotten with its last stream only,
+    // otherwise they would be sent again over the other streams
+    auto is_other_stream_of_peer = [&](const std::shared_ptr<Stream> &other) {
+      if (!other || other == stream || other->isClosed()) {
+        return false;
+      }
+      auto other_peer_id_res = other->remotePeerId();
+      return other_peer_id_res
+             && other_peer_id_res.value() == peer_id_res.value();
+    };
+    if (std::any_of(syncing_streams_.begin(),
+                    syncing_streams_.end(),
+                    is_other_stream_of_peer)
+        || std::any_of(streams_.begin(),
+                       streams_.end(),
+                       [&](const auto &entry) {
+                         return is_other_stream_of_peer(entry.second);
+                       })) {
+      return;
+    }
+    known_messages_.erase(peer_id_res.value());
+  }
+
+  bool GossiperBroadcast::addKnown(const libp2p::peer::PeerId &peer_id,
+                                   const common::Hash256 &hash) {
+    auto &known = known_messages_[peer_id];
+    if (!known.hashes.insert(hash).second) {
+      return false;
+    }
+    known.order.push_back(hash);
+    if (known.order.size() > kMaxKnownMessages) {
+      known.hashes.erase(known.order.front());
+      known.order.pop_front();
     }
+    return true;
   }
 
 }  // namespace kagome::network
@@ -6,20 +6,29 @@
 #ifndef KAGOME_GOSSIPER_BROADCAST_HPP
 #define KAGOME_GOSSIPER_BROADCAST_HPP
 
+#include <deque>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <gsl/span>
 #include "common/logger.hpp"
+#include "crypto/hasher.hpp"
 #include "libp2p/connection/stream.hpp"
 #include "libp2p/host/host.hpp"
 #include "libp2p/peer/peer_info.hpp"
 #include "network/gossiper.hpp"
+#include "network/helpers/scale_message_read_writer.hpp"
 #include "network/types/gossip_message.hpp"
 #include "network/types/peer_list.hpp"
+#include "network/types/transaction_announce.hpp"
 
 namespace kagome::network {
   /**
-   * Sends gossip messages using broadcast strategy
+   * Sends gossip messages using broadcast strategy. Message is encoded once and
+   * the same buffer is written to every stream. Each stream has a bounded
+   * outbound queue, where consensus messages are sent before block and
+   * transaction announces. Transactions, which a peer already knows, are not
+   * sent to it again
    */
   class GossiperBroadcast
       : public Gossiper,
@@ -27,9 +36,18 @@ namespace kagome::network {
     using Precommit = consensus::grandpa::Precommit;
     using Prevote = consensus::grandpa::Prevote;
     using PrimaryPropose = consensus::grandpa::PrimaryPropose;
+    using Stream = libp2p::connection::Stream;
+    using EncodedMessage = std::shared_ptr<const std::vector<uint8_t>>;
 
    public:
-    GossiperBroadcast(libp2p::Host &host, const PeerList &peer_infos);
+    /// max number of messages waiting to be written to a single stream
+    static constexpr size_t kMaxQueueSize = 256;
+    /// max number of message hashes remembered for a single peer
+    static constexpr size_t kMaxKnownMessages = 1024;
+
+    GossiperBroadcast(libp2p::Host &host,
+                      const PeerList &peer_infos,
+                      std::shared_ptr<crypto::Hasher> hasher);
 
     ~GossiperBroadcast() override = default;
 
@@ -39,16 +57,82 @@ namespace kagome::network {
 
     void finalize(const consensus::grandpa::Fin &fin) override;
 
+    void propagateTransactions(
+        gsl::span<const primitives::Transaction> txs) override;
+
     void addStream(std::shared_ptr<libp2p::connection::Stream> stream) override;
 
+    void markKnown(const libp2p::peer::PeerId &peer_id,
+                   const GossipMessage &msg) override;
+
+    void markKnown(const libp2p::peer::PeerId &peer_id,
+                   const TransactionAnnounce &announce) override;
+
    private:
+    /// Messages waiting to be written to a stream
+    struct SendQueue {
+      std::shared_ptr<ScaleMessageReadWriter> read_writer;
+      std::deque<EncodedMessage> consensus;
+      std::deque<EncodedMessage> announces;
+      bool writing{false};
+    };
+
+    /// Transactions being propagated and the message with all of them
+    struct TransactionsBatch {
+      std::vector<common::Hash256> hashes;
+      TransactionAnnounce announce;
+      EncodedMessage encoded;
+    };
+
+    /// Hashes of the messages and transactions, which the peer has already got
+    struct KnownMessages {
+      std::unordered_set<common::Hash256> hashes;
+      std::deque<common::Hash256> order;
+    };
+
     void broadcast(GossipMessage &&msg);
 
+    /// Invoke \param send for every gossip stream; streams, which are not
+    /// open, are opened first
+    void forEachStream(
+        const std::function<void(const std::shared_ptr<Stream> &)> &send);
+
+    /// Put \param msg to the queue of \param stream, unless the peer already
+    /// knows message with \param hash
+    void enqueue(const std::shared_ptr<Stream> &stream,
+                 const EncodedMessage &msg,
+                 const common::Hash256 &hash,
+                 bool is_consensus);
+
+    /// Put transactions of \param batch, which the peer of \param stream
+    /// does not know yet, to the queue of the stream
+    void enqueueTransactions(const std::shared_ptr<Stream> &stream,
+                             const TransactionsBatch &batch);
+
+    /// Put \param msg to the queue of \param stream
+    void push(const std::shared_ptr<Stream> &stream,
+              const EncodedMessage &msg,
+              bool is_consensus);
+
+    /// Write the next message from the queue of \param stream, if the stream
+    /// is not being written already
+    void writeNext(const std::shared_ptr<Stream> &stream);
+
+    /// Forget the queue of the closed \param stream and the messages known
+    /// by its peer, unless the peer has other open streams
+    void removeStream(const std::shared_ptr<Stream> &stream);
+
+    /// @return true if \param hash was not known by \param peer_id before
+    bool addKnown(const libp2p::peer::PeerId &peer_id,
+                  const common::Hash256 &hash);
+
     libp2p::Host &host_;
-    std::unordered_map<libp2p::peer::PeerInfo,
-                       std::shared_ptr<libp2p::connection::Stream>>
+    std::shared_ptr<crypto::Hasher> hasher_;
+    std::unordered_map<libp2p::peer::PeerInfo, std::shared_ptr<Stream>>
         streams_;
-    std::vector<std::shared_ptr<libp2p::connection::Stream>> syncing_streams_{};
+    std::vector<std::shared_ptr<Stream>> syncing_streams_{};
+    std::unordered_map<std::shared_ptr<Stream>, SendQueue> send_queues_;
+    std::unordered_map<libp2p::peer::PeerId, KnownMessages> known_messages_;
     common::Logger logger_;
   };
 }  // namespace kagome::network
@@ -7,10 +7,10 @@
 
 #include "consensus/grandpa/structs.hpp"
 #include "network/common.hpp"
-#include "network/rpc.hpp"
 #include "network/types/block_announce.hpp"
 #include "network/types/blocks_request.hpp"
 #include "network/types/blocks_response.hpp"
+#include "network/types/transaction_announce.hpp"
 #include "scale/scale.hpp"
 
 namespace kagome::network {
@@ -19,25 +19,33 @@ namespace kagome::network {
       std::shared_ptr<BabeObserver> babe_observer,
       std::shared_ptr<consensus::grandpa::RoundObserver> grandpa_observer,
       std::shared_ptr<SyncProtocolObserver> sync_observer,
+      std::shared_ptr<ExtrinsicObserver> extrinsic_observer,
       const std::shared_ptr<Gossiper>& gossiper)
       : host_{host},
         babe_observer_{std::move(babe_observer)},
         grandpa_observer_{std::move(grandpa_observer)},
         sync_observer_{std::move(sync_observer)},
+        extrinsic_observer_{std::move(extrinsic_observer)},
         gossiper_{gossiper},
         log_{common::createLogger("RouterLibp2p")} {
     BOOST_ASSERT_MSG(babe_observer_ != nullptr, "babe observer is nullptr");
     BOOST_ASSERT_MSG(grandpa_observer_ != nullptr,
                      "grandpa observer is nullptr");
     BOOST_ASSERT_MSG(sync_observer_ != nullptr, "sync observer is nullptr");
+    BOOST_ASSERT_MSG(extrinsic_observer_ != nullptr,
+                     "extrinsic observer is nullptr");
     BOOST_ASSERT_MSG(gossiper != nullptr, "gossiper is nullptr");
   }
 
   void RouterLibp2p::init() {
-    host_.setProtocolHandler(
-        kSyncProtocol, [self{shared_from_this()}](auto &&stream) {
-          self->handleSyncProtocol(std::forward<decltype(stream)>(stream));
-        });
+    // requests are served until the peer closes the stream, so the same
+    // handler serves both versions of the protocol
+    for (const auto &protocol : {kSyncProtocol, kSyncPipelinedProtocol}) {
+      host_.setProtocolHandler(
+          protocol, [self{shared_from_this()}](auto &&stream) {
+            self->handleSyncProtocol(std::forward<decltype(stream)>(stream));
+          });
+    }
     host_.setProtocolHandler(
         kGossipProtocol, [self{shared_from_this()}](auto &&stream) {
           self->handleGossipProtocol(std::forward<decltype(stream)>(stream));
@@ -52,20 +60,47 @@ namespace kagome::network {
 
   void RouterLibp2p::handleSyncProtocol(
       const std::shared_ptr<Stream> &stream) const {
-    RPC<ScaleMessageReadWriter>::read<BlocksRequest, BlocksResponse>(
-        stream,
-        [self{shared_from_this()}, stream](auto &&request) {
-          // std::bind didn't work :(
-          return self->sync_observer_->onBlocksRequest(
-              std::forward<decltype(request)>(request));
-        },
-        [self{shared_from_this()}, stream](auto &&err) {
-          self->log_->error(
-              "error happened while processing request/response over Sync "
-              "protocol: {}",
-              err.error().message());
-          stream->reset();
-        });
+    readSyncRequest(stream, std::make_shared<ScaleMessageReadWriter>(stream));
+  }
+
+  void RouterLibp2p::readSyncRequest(
+      std::shared_ptr<Stream> stream,
+      std::shared_ptr<ScaleMessageReadWriter> read_writer) const {
+    auto on_error = [self{shared_from_this()}, stream](const auto &err) {
+      self->log_->error(
+          "error happened while processing request/response over Sync "
+          "protocol: {}",
+          err.message());
+      stream->reset();
+    };
+
+    // response is written as it is encoded by the observer, which splices
+    // cached data of the blocks into it
+    read_writer->read<BlocksRequest>([self{shared_from_this()},
+                                      stream,
+                                      read_writer,
+                                      on_error](auto &&request_res) {
+      if (!request_res) {
+        // peer has closed the stream after its last request
+        if (stream->isClosedForRead()) {
+          return stream->close([](auto &&) {});
+        }
+        return on_error(request_res.error());
+      }
+      auto response_res =
+          self->sync_observer_->onBlocksRequestEncoded(request_res.value());
+      if (!response_res) {
+        return on_error(response_res.error());
+      }
+      read_writer->writeEncoded(
+          std::move(response_res.value()),
+          [self, stream, read_writer, on_error](auto &&write_res) {
+            if (!write_res) {
+              return on_error(write_res.error());
+            }
+            self->readSyncRequest(stream, read_writer);
+          });
+    });
   }
 
   void RouterLibp2p::handleGossipProtocol(
@@ -85,7 +120,12 @@ namespace kagome::network {
             return stream->reset();
           }
 
-          if (!self->processGossipMessage(msg_res.value())) {
+          boost::optional<libp2p::peer::PeerId> peer_id;
+          if (auto peer_id_res = stream->remotePeerId()) {
+            peer_id = std::move(peer_id_res.value());
+          }
+
+          if (!self->processGossipMessage(msg_res.value(), peer_id)) {
             stream->reset();
             return;
           }
@@ -93,9 +133,16 @@ namespace kagome::network {
         });
   }
 
-  bool RouterLibp2p::processGossipMessage(const GossipMessage &msg) const {
+  bool RouterLibp2p::processGossipMessage(
+      const GossipMessage &msg,
+      const boost::optional<libp2p::peer::PeerId> &peer_id) const {
     using MsgType = GossipMessage::Type;
 
+    // do not send this message back to the peer
+    if (peer_id) {
+      gossiper_->markKnown(*peer_id, msg);
+    }
+
     switch (msg.type) {
       case MsgType::BLOCK_ANNOUNCE: {
         auto msg_res = scale::decode<BlockAnnounce>(msg.data);
@@ -126,6 +173,21 @@ namespace kagome::network {
         log_->error("error while decoding a consensus message");
         return false;
       }
+      case MsgType::TRANSACTIONS: {
+        auto msg_res = scale::decode<TransactionAnnounce>(msg.data);
+        if (!msg_res) {
+          log_->error("error while decoding a transaction announce message: {}",
+                      msg_res.error().message());
+          return false;
+        }
+        log_->debug("Received {} transactions",
+                    msg_res.value().extrinsics.size());
+        if (peer_id) {
+          gossiper_->markKnown(*peer_id, msg_res.value());
+        }
+        extrinsic_observer_->onTxMessage(msg_res.value());
+        return true;
+      }
       case MsgType::UNKNOWN:
         log_->error("unknown message type is set");
         return false;
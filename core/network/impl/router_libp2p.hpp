@@ -8,6 +8,8 @@
 
 #include <memory>
 
+#include <boost/optional.hpp>
+
 #include "common/logger.hpp"
 #include "consensus/grandpa/round_observer.hpp"
 #include "libp2p/connection/stream.hpp"
@@ -15,6 +17,7 @@
 #include "libp2p/peer/peer_info.hpp"
 #include "libp2p/peer/protocol.hpp"
 #include "network/babe_observer.hpp"
+#include "network/extrinsic_observer.hpp"
 #include "network/gossiper.hpp"
 #include "network/helpers/scale_message_read_writer.hpp"
 #include "network/router.hpp"
@@ -30,6 +33,7 @@ namespace kagome::network {
         std::shared_ptr<BabeObserver> babe_observer,
         std::shared_ptr<consensus::grandpa::RoundObserver> grandpa_observer,
         std::shared_ptr<SyncProtocolObserver> sync_observer,
+        std::shared_ptr<ExtrinsicObserver> extrinsic_observer,
         const std::shared_ptr<Gossiper>& gossiper);
 
     ~RouterLibp2p() override = default;
@@ -41,17 +45,30 @@ namespace kagome::network {
     void handleGossipProtocol(std::shared_ptr<Stream> stream) const override;
 
    private:
+    /**
+     * Read the next blocks request from the sync \param stream and respond
+     * to it; the peer may send several requests over the same stream
+     */
+    void readSyncRequest(
+        std::shared_ptr<Stream> stream,
+        std::shared_ptr<ScaleMessageReadWriter> read_writer) const;
+
     void readGossipMessage(std::shared_ptr<Stream> stream) const;
 
     /**
-     * Process a received gossip message
+     * Process a gossip message received from \param peer_id, if it is known;
+     * the message is remembered as known to the peer, so that it is not sent
+     * back
      */
-    bool processGossipMessage(const GossipMessage &msg) const;
+    bool processGossipMessage(
+        const GossipMessage &msg,
+        const boost::optional<libp2p::peer::PeerId> &peer_id) const;
 
     libp2p::Host &host_;
     std::shared_ptr<BabeObserver> babe_observer_;
     std::shared_ptr<consensus::grandpa::RoundObserver> grandpa_observer_;
     std::shared_ptr<SyncProtocolObserver> sync_observer_;
+    std::shared_ptr<ExtrinsicObserver> extrinsic_observer_;
     std::shared_ptr<Gossiper> gossiper_;
     common::Logger log_;
   };
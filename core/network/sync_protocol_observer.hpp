@@ -6,6 +6,8 @@
 #ifndef KAGOME_SYNC_PROTOCOL_OBSERVER_HPP
 #define KAGOME_SYNC_PROTOCOL_OBSERVER_HPP
 
+#include <memory>
+
 #include <outcome/outcome.hpp>
 #include "network/types/blocks_request.hpp"
 #include "network/types/blocks_response.hpp"
@@ -20,10 +22,11 @@ namespace kagome::network {
     /**
      * Process a blocks request
      * @param request to be processed
-     * @return blocks request or error
+     * @return SCALE-encoded blocks response, ready to be written to the
+     * channel, or error
      */
-    virtual outcome::result<BlocksResponse> onBlocksRequest(
-        const BlocksRequest &request) const = 0;
+    virtual outcome::result<std::shared_ptr<const std::vector<uint8_t>>>
+    onBlocksRequestEncoded(const BlocksRequest &request) const = 0;
   };
 }  // namespace kagome::network
 
@@ -0,0 +1,63 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TRANSACTION_ANNOUNCE_HPP
+#define KAGOME_TRANSACTION_ANNOUNCE_HPP
+
+#include <vector>
+
+#include "primitives/extrinsic.hpp"
+
+namespace kagome::network {
+  /**
+   * Announce a batch of transactions on the network
+   */
+  struct TransactionAnnounce {
+    std::vector<primitives::Extrinsic> extrinsics;
+  };
+
+  /**
+   * @brief compares two TransactionAnnounce instances
+   * @param lhs first instance
+   * @param rhs second instance
+   * @return true if equal false otherwise
+   */
+  inline bool operator==(const TransactionAnnounce &lhs,
+                         const TransactionAnnounce &rhs) {
+    return lhs.extrinsics == rhs.extrinsics;
+  }
+  inline bool operator!=(const TransactionAnnounce &lhs,
+                         const TransactionAnnounce &rhs) {
+    return !(lhs == rhs);
+  }
+
+  /**
+   * @brief outputs object of type TransactionAnnounce to stream
+   * @tparam Stream output stream type
+   * @param s stream reference
+   * @param v value to output
+   * @return reference to stream
+   */
+  template <class Stream,
+            typename = std::enable_if_t<Stream::is_encoder_stream>>
+  Stream &operator<<(Stream &s, const TransactionAnnounce &v) {
+    return s << v.extrinsics;
+  }
+
+  /**
+   * @brief decodes object of type TransactionAnnounce from stream
+   * @tparam Stream input stream type
+   * @param s stream reference
+   * @param v value to decode
+   * @return reference to stream
+   */
+  template <class Stream,
+            typename = std::enable_if_t<Stream::is_decoder_stream>>
+  Stream &operator>>(Stream &s, TransactionAnnounce &v) {
+    return s >> v.extrinsics;
+  }
+}  // namespace kagome::network
+
+#endif  // KAGOME_TRANSACTION_ANNOUNCE_HPP
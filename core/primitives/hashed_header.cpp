@@ -0,0 +1,43 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "primitives/hashed_header.hpp"
+
+#include <boost/assert.hpp>
+#include "scale/scale.hpp"
+
+namespace kagome::primitives {
+
+  HashedHeader::HashedHeader(BlockHeader header,
+                             std::shared_ptr<crypto::Hasher> hasher)
+      : hasher_{std::move(hasher)},
+        header_{std::move(header)},
+        encoded_{scale::encode(header_).value()},
+        hash_{hasher_->blake2b_256(encoded_)} {
+    BOOST_ASSERT(hasher_ != nullptr);
+  }
+
+  const boost::optional<BlockHash> &HashedHeader::preSealHash() const {
+    if (not pre_seal_hash_ and not header_.digest.empty()) {
+      pre_seal_hash_ = hasher_->blake2b_256(encodePreSeal(header_));
+    }
+    return pre_seal_hash_;
+  }
+
+  std::vector<uint8_t> HashedHeader::encodePreSeal(const BlockHeader &header) {
+    BOOST_ASSERT(not header.digest.empty());
+    // the fields are streamed as the header encoder does, except for the last
+    // digest item, so that the header with all its digests is not copied
+    scale::ScaleEncoderStream s;
+    s << header.parent_hash << CompactInteger(header.number)
+      << header.state_root << header.extrinsics_root
+      << CompactInteger(header.digest.size() - 1);
+    for (auto it = header.digest.begin(); it + 1 < header.digest.end(); ++it) {
+      s << *it;
+    }
+    return s.data();
+  }
+
+}  // namespace kagome::primitives
@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_PRIMITIVES_HASHED_HEADER_HPP
+#define KAGOME_PRIMITIVES_HASHED_HEADER_HPP
+
+#include <memory>
+
+#include <boost/optional.hpp>
+#include "common/buffer.hpp"
+#include "crypto/hasher.hpp"
+#include "primitives/block_header.hpp"
+
+namespace kagome::primitives {
+  /**
+   * Block header together with its SCALE-encoded form and hashes, which are
+   * computed once, so that they are not recomputed on each step of the block
+   * import; the pre-seal hash is computed on its first use. Not thread-safe
+   */
+  class HashedHeader {
+   public:
+    /**
+     * Encode \param header and take its hash with \param hasher
+     */
+    HashedHeader(BlockHeader header, std::shared_ptr<crypto::Hasher> hasher);
+
+    const BlockHeader &header() const {
+      return header_;
+    }
+
+    /// SCALE-encoded header
+    const common::Buffer &encoded() const {
+      return encoded_;
+    }
+
+    /// Hash of the encoded header, which identifies the block
+    const BlockHash &hash() const {
+      return hash_;
+    }
+
+    /// Hash of the header without its last digest (seal), which is signed by
+    /// the producer of the block; none if the header has no digests
+    const boost::optional<BlockHash> &preSealHash() const;
+
+    /**
+     * SCALE-encode \param header without its last digest item, without copying
+     * the header
+     */
+    static std::vector<uint8_t> encodePreSeal(const BlockHeader &header);
+
+   private:
+    std::shared_ptr<crypto::Hasher> hasher_;
+    BlockHeader header_;
+    common::Buffer encoded_;
+    BlockHash hash_;
+    mutable boost::optional<BlockHash> pre_seal_hash_;
+  };
+}  // namespace kagome::primitives
+
+#endif  // KAGOME_PRIMITIVES_HASHED_HEADER_HPP
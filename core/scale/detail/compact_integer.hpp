@@ -0,0 +1,170 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_SCALE_DETAIL_COMPACT_INTEGER_HPP
+#define KAGOME_SCALE_DETAIL_COMPACT_INTEGER_HPP
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "common/outcome_throw.hpp"
+#include "macro/unreachable.hpp"
+#include "scale/scale_error.hpp"
+#include "scale/types.hpp"
+
+namespace kagome::scale::detail {
+  /**
+   * Unsigned integers up to 128 bits, which are compact-encoded and decoded
+   * without big integer arithmetic
+   */
+  template <class T>
+  constexpr bool kIsCompactUint = std::numeric_limits<T>::is_integer
+                                  and not std::numeric_limits<T>::is_signed
+                                  and std::numeric_limits<T>::digits <= 128;
+
+  /// @return number of significant bytes of \param value, at least 1
+  template <class T, typename = std::enable_if_t<kIsCompactUint<T>>>
+  constexpr size_t countBytes(T value) {
+    size_t count = 1;
+    while (value > 0xFFu) {
+      value >>= 8u;
+      ++count;
+    }
+    return count;
+  }
+
+  /// @return size of the compact encoding of \param value in bytes
+  template <class T, typename = std::enable_if_t<kIsCompactUint<T>>>
+  constexpr size_t compactSize(T value) {
+    using Limits = compact::EncodingCategoryLimits;
+    if (value < Limits::kMinUint16) {
+      return 1;
+    }
+    if (value < Limits::kMinUint32) {
+      return 2;
+    }
+    if (value < Limits::kMinBigInteger) {
+      return 4;
+    }
+    return 1 + countBytes(value);
+  }
+
+  /**
+   * encodeCompact compact-encodes unsigned integer
+   * @tparam T unsigned integer type of up to 128 bits
+   * @tparam S output stream type
+   * @param value integer value
+   */
+  template <class T,
+            class S,
+            typename = std::enable_if_t<kIsCompactUint<T>>>
+  void encodeCompact(T value, S &out) {
+    using Limits = compact::EncodingCategoryLimits;
+    if (value < Limits::kMinUint16) {
+      out << static_cast<uint8_t>(static_cast<uint8_t>(value) << 2u);
+      return;
+    }
+    if (value < Limits::kMinUint32) {
+      auto v = static_cast<uint16_t>((static_cast<uint16_t>(value) << 2u)
+                                     | 0b01u);
+      out << static_cast<uint8_t>(v) << static_cast<uint8_t>(v >> 8u);
+      return;
+    }
+    if (value < Limits::kMinBigInteger) {
+      auto v = (static_cast<uint32_t>(value) << 2u) | 0b10u;
+      out << static_cast<uint8_t>(v) << static_cast<uint8_t>(v >> 8u)
+          << static_cast<uint8_t>(v >> 16u) << static_cast<uint8_t>(v >> 24u);
+      return;
+    }
+    // 6 major bits of the header keep the number of bytes minus 4
+    auto bytes = countBytes(value);
+    out << static_cast<uint8_t>(((bytes - 4u) << 2u) | 0b11u);
+    for (size_t i = 0; i < bytes; ++i) {
+      out << static_cast<uint8_t>(value & 0xFFu);
+      value >>= 8u;
+    }
+  }
+
+  /**
+   * decodeCompact decodes compact integer, which header byte is already read
+   * from the stream
+   * @tparam T unsigned integer type of up to 128 bits
+   * @param header the first byte of the encoding
+   * @param stream source stream
+   * @return decoded value, raises COMPACT_INTEGER_TOO_BIG if it does not fit
+   * into T
+   */
+  template <class T,
+            class S,
+            typename = std::enable_if_t<kIsCompactUint<T>>>
+  T decodeCompact(uint8_t header, S &stream) {
+    uint32_t number = 0u;
+    switch (header & 0b11u) {
+      case 0b00u:
+        number = header >> 2u;
+        break;
+
+      case 0b01u:
+        number = (header | (static_cast<uint32_t>(stream.nextByte()) << 8u))
+                 >> 2u;
+        break;
+
+      case 0b10u: {
+        if (not stream.hasMore(3u)) {
+          common::raise(DecodeError::NOT_ENOUGH_DATA);
+        }
+        number = header;
+        for (auto shift = 8u; shift < 32u; shift += 8u) {
+          number |= static_cast<uint32_t>(stream.nextByte()) << shift;
+        }
+        number >>= 2u;
+        break;
+      }
+
+      case 0b11u: {
+        auto bytes_count = (header >> 2u) + 4u;
+        if (not stream.hasMore(bytes_count)) {
+          common::raise(DecodeError::NOT_ENOUGH_DATA);
+        }
+        constexpr auto kMaxBytes = std::numeric_limits<T>::digits / 8u;
+        T value = 0u;
+        for (auto i = 0u; i < bytes_count; ++i) {
+          auto byte = stream.nextByte();
+          if (i < kMaxBytes) {
+            value |= static_cast<T>(static_cast<T>(byte) << (i * 8u));
+          } else if (byte != 0u) {
+            common::raise(DecodeError::COMPACT_INTEGER_TOO_BIG);
+          }
+        }
+        return value;
+      }
+
+      default:
+        UNREACHABLE
+    }
+
+    if (number > std::numeric_limits<T>::max()) {
+      common::raise(DecodeError::COMPACT_INTEGER_TOO_BIG);
+    }
+    return static_cast<T>(number);
+  }
+
+  /**
+   * decodeCompact decodes compact integer from stream
+   * @tparam T unsigned integer type of up to 128 bits
+   * @param stream source stream
+   * @return decoded value, raises COMPACT_INTEGER_TOO_BIG if it does not fit
+   * into T
+   */
+  template <class T,
+            class S,
+            typename = std::enable_if_t<kIsCompactUint<T>>>
+  T decodeCompact(S &stream) {
+    return decodeCompact<T>(stream.nextByte(), stream);
+  }
+}  // namespace kagome::scale::detail
+
+#endif  // KAGOME_SCALE_DETAIL_COMPACT_INTEGER_HPP
@@ -13,69 +13,30 @@
 namespace kagome::scale {
   namespace {
     CompactInteger decodeCompactInteger(ScaleDecoderStream &stream) {
-      auto first_byte = stream.nextByte();
-
-      const uint8_t flag = (first_byte)&0b00000011u;
-
-      size_t number = 0u;
-
-      switch (flag) {
-        case 0b00u: {
-          number = static_cast<size_t>(first_byte >> 2u);
-          break;
-        }
-
-        case 0b01u: {
-          auto second_byte = stream.nextByte();
-
-          number = (static_cast<size_t>((first_byte)&0b11111100u)
-                    + static_cast<size_t>(second_byte) * 256u)
-                   >> 2u;
-          break;
-        }
-
-        case 0b10u: {
-          number = first_byte;
-          size_t multiplier = 256u;
-          if (!stream.hasMore(3u)) {
-            // not enough data to decode integer
-            common::raise(DecodeError::NOT_ENOUGH_DATA);
-          }
-
-          for (auto i = 0u; i < 3u; ++i) {
-            // we assured that there are 3 more bytes,
-            // no need to make checks in a loop
-            number += (stream.nextByte()) * multiplier;
-            multiplier = multiplier << 8u;
-          }
-          number = number >> 2u;
-          break;
-        }
-
-        case 0b11: {
-          auto bytes_count = ((first_byte) >> 2u) + 4u;
-          if (!stream.hasMore(bytes_count)) {
-            // not enough data to decode integer
-            common::raise(DecodeError::NOT_ENOUGH_DATA);
-          }
-
-          CompactInteger multiplier{1u};
-          CompactInteger value = 0;
-          // we assured that there are m more bytes,
-          // no need to make checks in a loop
-          for (auto i = 0u; i < bytes_count; ++i) {
-            value += (stream.nextByte()) * multiplier;
-            multiplier *= 256u;
-          }
-
-          return value;  // special case
-        }
+      using FastUint = boost::multiprecision::uint128_t;
+      constexpr auto kMaxFastBytes = std::numeric_limits<FastUint>::digits / 8u;
+
+      auto header = stream.nextByte();
+      auto bytes_count = (header >> 2u) + 4u;
+      if ((header & 0b11u) != 0b11u or bytes_count <= kMaxFastBytes) {
+        // values up to 2^128 are decoded without big integer arithmetic
+        return CompactInteger{detail::decodeCompact<FastUint>(header, stream)};
+      }
 
-        default:
-          UNREACHABLE
+      if (!stream.hasMore(bytes_count)) {
+        // not enough data to decode integer
+        common::raise(DecodeError::NOT_ENOUGH_DATA);
       }
 
-      return CompactInteger{number};
+      CompactInteger multiplier{1u};
+      CompactInteger value = 0;
+      // we assured that there are m more bytes,
+      // no need to make checks in a loop
+      for (auto i = 0u; i < bytes_count; ++i) {
+        value += (stream.nextByte()) * multiplier;
+        multiplier *= 256u;
+      }
+      return value;
     }
   }  // namespace
 
@@ -12,6 +12,7 @@
 #include <boost/optional.hpp>
 #include <gsl/span>
 #include "common/outcome_throw.hpp"
+#include "scale/detail/compact_integer.hpp"
 #include "scale/detail/fixed_witdh_integer.hpp"
 #include "scale/detail/variant.hpp"
 
@@ -117,15 +118,14 @@ namespace kagome::scale {
     template <class T>
     ScaleDecoderStream &operator>>(std::vector<T> &v) {
       v.clear();
-      CompactInteger size{0u};
-      *this >> size;
+      auto size = detail::decodeCompact<uint64_t>(*this);
 
       using size_type = typename std::vector<T>::size_type;
 
       if (size > std::numeric_limits<size_type>::max()) {
         common::raise(DecodeError::TOO_MANY_ITEMS);
       }
-      auto item_count = size.convert_to<size_type>();
+      auto item_count = static_cast<size_type>(size);
       v.reserve(item_count);
       for (size_type i = 0u; i < item_count; ++i) {
         T t{};
@@ -177,6 +177,13 @@ namespace kagome::scale {
      */
     bool hasMore(uint64_t n) const;
 
+    /**
+     * @return number of bytes, which are already decoded
+     */
+    size_t currentIndex() const {
+      return current_index_;
+    }
+
     /**
      * @brief takes one byte from stream and
      * advances current byte iterator by one
@@ -11,30 +11,6 @@
 
 namespace kagome::scale {
   namespace {
-    // must not use these functions outside encodeInteger
-    inline void encodeFirstCategory(uint8_t value, ScaleEncoderStream &out) {
-      // only values from [0, kMinUint16) can be put here
-      out << static_cast<uint8_t>(value << 2u);
-    }
-
-    inline void encodeSecondCategory(uint16_t value, ScaleEncoderStream &out) {
-      // only values from [kMinUint16, kMinUint32) can be put here
-      auto v = value;
-      v <<= 2u;  // v *= 4
-      v += 1u;   // set 0b01 flag
-      auto minor_byte = static_cast<uint8_t>(v & 0xFFu);
-      v >>= 8u;
-      auto major_byte = static_cast<uint8_t>(v & 0xFFu);
-
-      out << minor_byte << major_byte;
-    }
-
-    inline void encodeThirdCategory(uint32_t value, ScaleEncoderStream &out) {
-      // only values from [kMinUint32, kMinBigInteger) can be put here
-      uint32_t v = (value << 2u) + 2;
-      scale::detail::encodeInteger<uint32_t>(v, out);
-    }
-
     // calculate number of bytes required
     size_t countBytes(CompactInteger v) {
       if (0 == v) {
@@ -61,18 +37,10 @@ namespace kagome::scale {
         common::raise(EncodeError::NEGATIVE_COMPACT_INTEGER);
       }
 
-      if (value < compact::EncodingCategoryLimits::kMinUint16) {
-        encodeFirstCategory(value.convert_to<uint8_t>(), out);
-        return;
-      }
-
-      if (value < compact::EncodingCategoryLimits::kMinUint32) {
-        encodeSecondCategory(value.convert_to<uint16_t>(), out);
-        return;
-      }
-
-      if (value < compact::EncodingCategoryLimits::kMinBigInteger) {
-        encodeThirdCategory(value.convert_to<uint32_t>(), out);
+      using FastUint = boost::multiprecision::uint128_t;
+      if (value <= std::numeric_limits<FastUint>::max()) {
+        // values up to 2^128 are encoded without big integer arithmetic
+        detail::encodeCompact(value.convert_to<FastUint>(), out);
         return;
       }
 
@@ -10,6 +10,7 @@
 
 #include <boost/optional.hpp>
 #include <gsl/span>
+#include "scale/detail/compact_integer.hpp"
 #include "scale/detail/fixed_witdh_integer.hpp"
 #include "scale/detail/variant.hpp"
 
@@ -179,10 +180,8 @@ namespace kagome::scale {
      * @return reference to stream
      */
     template <class It>
-    ScaleEncoderStream &encodeCollection(const CompactInteger &size,
-                                         It &&begin,
-                                         It &&end) {
-      *this << size;
+    ScaleEncoderStream &encodeCollection(size_t size, It &&begin, It &&end) {
+      detail::encodeCompact(size, *this);
       // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
       for (auto &&it = begin; it != end; ++it) {
         *this << *it;
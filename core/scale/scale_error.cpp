@@ -35,6 +35,8 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::scale, DecodeError, e) {
       return "incorrect source data";
     case DecodeError::OUT_OF_BOUNDARIES:
       return "advance went out of boundaries";
+    case DecodeError::COMPACT_INTEGER_TOO_BIG:
+      return "compact integer does not fit into the type";
   }
   return "unknown DecodeError";
 }
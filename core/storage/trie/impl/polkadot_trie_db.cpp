@@ -107,6 +107,27 @@ namespace kagome::storage::trie {
     return trie.get(key);
   }
 
+  outcome::result<std::vector<boost::optional<common::Buffer>>>
+  PolkadotTrieDb::getMany(gsl::span<const common::Buffer> keys) const {
+    std::vector<boost::optional<common::Buffer>> values(keys.size());
+    if (empty() or keys.empty()) {
+      return values;
+    }
+    // a single in-memory trie is walked for all the keys: it replaces the
+    // dummy children with the retrieved nodes, so each node on the common
+    // paths is fetched from the storage and decoded only once
+    OUTCOME_TRY(trie, initTrie());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      auto value = trie.get(keys[i]);
+      if (value) {
+        values[i] = std::move(value.value());
+      } else if (value.error() != TrieError::NO_VALUE) {
+        return value.error();
+      }
+    }
+    return values;
+  }
+
   bool PolkadotTrieDb::contains(const common::Buffer &key) const {
     auto res = get(key);
     return res.has_value();
@@ -86,6 +86,9 @@ namespace kagome::storage::trie {
 
     bool contains(const common::Buffer &key) const override;
 
+    outcome::result<std::vector<boost::optional<common::Buffer>>> getMany(
+        gsl::span<const common::Buffer> keys) const override;
+
     /**
      * @return the root hash of empty Trie
      */
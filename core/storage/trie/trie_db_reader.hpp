@@ -6,6 +6,11 @@
 #ifndef KAGOME_TRIE_DB_READER_HPP
 #define KAGOME_TRIE_DB_READER_HPP
 
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <gsl/span>
+
 #include "common/buffer.hpp"
 #include "storage/buffer_map_types.hpp"
 
@@ -28,6 +33,15 @@ namespace kagome::storage::trie {
      * @returns true if the trie is empty, false otherwise
      */
     virtual bool empty() const = 0;
+
+    /**
+     * @brief Read values of several keys at once; nodes on the common paths
+     * to the keys are loaded from the storage once
+     * @param keys keys to read, may repeat
+     * @return values in the order of the keys, none for the absent ones
+     */
+    virtual outcome::result<std::vector<boost::optional<Buffer>>> getMany(
+        gsl::span<const Buffer> keys) const = 0;
   };
 
 }  // namespace kagome::storage::trie
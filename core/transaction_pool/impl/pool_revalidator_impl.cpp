@@ -0,0 +1,179 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "transaction_pool/impl/pool_revalidator_impl.hpp"
+
+#include <boost/asio/post.hpp>
+#include "common/visitor.hpp"
+
+namespace kagome::transaction_pool {
+
+  PoolRevalidatorImpl::PoolRevalidatorImpl(
+      std::shared_ptr<TransactionPool> pool,
+      std::shared_ptr<runtime::TaggedTransactionQueue> tx_queue,
+      std::shared_ptr<storage::trie::TrieDb> trie_db,
+      std::shared_ptr<crypto::Hasher> hasher,
+      std::shared_ptr<boost::asio::io_context> io_context,
+      Params params)
+      : pool_{std::move(pool)},
+        tx_queue_{std::move(tx_queue)},
+        trie_db_{std::move(trie_db)},
+        hasher_{std::move(hasher)},
+        io_context_{std::move(io_context)},
+        params_{params},
+        logger_{common::createLogger("PoolRevalidator")} {
+    BOOST_ASSERT(pool_ != nullptr);
+    BOOST_ASSERT(tx_queue_ != nullptr);
+    BOOST_ASSERT(trie_db_ != nullptr);
+    BOOST_ASSERT(hasher_ != nullptr);
+    BOOST_ASSERT(io_context_ != nullptr);
+    BOOST_ASSERT(params_.batch_size > 0);
+  }
+
+  void PoolRevalidatorImpl::onBlockImported(const primitives::Block &block) {
+    // transactions of the block are not needed anymore, while the ones, which
+    // depend on their tags, are the most likely to change their validity
+    std::vector<Transaction::Tag> touched_tags;
+    for (auto &ext : block.body) {
+      auto hash = hasher_->blake2b_256(ext.data);
+      auto tx = pool_->getTransaction(hash);
+      if (not tx) {
+        continue;
+      }
+      touched_tags.insert(
+          touched_tags.end(), tx->provides.begin(), tx->provides.end());
+      touched_tags.insert(
+          touched_tags.end(), tx->requires.begin(), tx->requires.end());
+      if (auto remove_res = pool_->removeOne(hash); not remove_res) {
+        logger_->warn("Could not remove included transaction {}: {}",
+                      hash.toHex(),
+                      remove_res.error().message());
+      }
+    }
+    for (auto &hash : pool_->getTransactionsByTags(touched_tags)) {
+      enqueue(hash, true);
+    }
+
+    // the rest of the pool is swept once per pass, a pass, which is not
+    // finished by the next block, is continued rather than restarted
+    if (regular_queue_.empty()) {
+      for (auto &hash : pool_->getTransactionHashes()) {
+        enqueue(hash, false);
+      }
+    }
+
+    scheduleBatch();
+  }
+
+  size_t PoolRevalidatorImpl::queueSize() const {
+    return queued_.size();
+  }
+
+  void PoolRevalidatorImpl::enqueue(const Transaction::Hash &tx_hash,
+                                    bool urgent) {
+    // the hash may get to both queues, it is re-validated once whichever of
+    // them it leaves first
+    auto inserted = queued_.insert(tx_hash).second;
+    if (urgent) {
+      urgent_queue_.push_back(tx_hash);
+    } else if (inserted) {
+      regular_queue_.push_back(tx_hash);
+    }
+  }
+
+  void PoolRevalidatorImpl::scheduleBatch() {
+    if (batch_scheduled_ or queued_.empty()) {
+      return;
+    }
+    batch_scheduled_ = true;
+    boost::asio::post(*io_context_, [self_wp{weak_from_this()}] {
+      if (auto self = self_wp.lock()) {
+        self->processBatch();
+      }
+    });
+  }
+
+  void PoolRevalidatorImpl::processBatch() {
+    batch_scheduled_ = false;
+
+    size_t processed = 0;
+    while (processed < params_.batch_size) {
+      auto &queue = urgent_queue_.empty() ? regular_queue_ : urgent_queue_;
+      if (queue.empty()) {
+        break;
+      }
+      auto hash = queue.front();
+      queue.pop_front();
+      if (queued_.erase(hash) == 0) {
+        continue;
+      }
+      // the transaction might have left the pool since it was queued
+      if (auto tx = pool_->getTransaction(hash)) {
+        revalidate(*tx);
+        ++processed;
+      }
+    }
+
+    logger_->debug("Re-validated {} transactions, {} are left",
+                   processed,
+                   queued_.size());
+    scheduleBatch();
+  }
+
+  void PoolRevalidatorImpl::revalidate(const Transaction &tx) {
+    auto state_before_validate = trie_db_->getRootHash();
+    auto validation_res = tx_queue_->validate_transaction(tx.ext);
+    if (auto reset_res = trie_db_->resetState(state_before_validate);
+        not reset_res) {
+      logger_->error("Could not reset state after validation: {}",
+                     reset_res.error().message());
+    }
+    if (not validation_res) {
+      logger_->warn("Could not re-validate transaction {}: {}",
+                    tx.hash.toHex(),
+                    validation_res.error().message());
+      return;
+    }
+
+    visit_in_place(
+        validation_res.value(),
+        [&](const primitives::TransactionValidityError &e) {
+          visit_in_place(
+              e,
+              [&](const primitives::InvalidTransaction &) {
+                logger_->debug("Transaction {} became invalid",
+                               tx.hash.toHex());
+                pool_->reportInvalid(tx.hash);
+              },
+              // validity might become known later, so keep the transaction
+              [](const primitives::UnknownTransaction &) {});
+        },
+        [&](const primitives::ValidTransaction &v) {
+          if (v.priority == tx.priority and v.requires == tx.requires
+              and v.provides == tx.provides and v.longevity == tx.valid_till
+              and v.propagate == tx.should_propagate) {
+            return;
+          }
+          // tags might have changed, so the transaction is imported anew to
+          // be indexed by them
+          auto updated = tx;
+          updated.priority = v.priority;
+          updated.requires = v.requires;
+          updated.provides = v.provides;
+          updated.valid_till = v.longevity;
+          updated.should_propagate = v.propagate;
+          if (auto remove_res = pool_->removeOne(tx.hash); not remove_res) {
+            return;
+          }
+          if (auto submit_res = pool_->submitOne(std::move(updated));
+              not submit_res) {
+            logger_->warn("Could not re-import transaction {}: {}",
+                          tx.hash.toHex(),
+                          submit_res.error().message());
+          }
+        });
+  }
+
+}  // namespace kagome::transaction_pool
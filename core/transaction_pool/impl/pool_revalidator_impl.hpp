@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_POOL_REVALIDATOR_IMPL_HPP
+#define KAGOME_POOL_REVALIDATOR_IMPL_HPP
+
+#include "transaction_pool/pool_revalidator.hpp"
+
+#include <deque>
+#include <unordered_set>
+
+#include <boost/asio/io_context.hpp>
+#include "common/logger.hpp"
+#include "crypto/hasher.hpp"
+#include "runtime/tagged_transaction_queue.hpp"
+#include "storage/trie/trie_db.hpp"
+#include "transaction_pool/transaction_pool.hpp"
+
+namespace kagome::transaction_pool {
+
+  /**
+   * Re-validates transactions of the pool in batches, which are posted to the
+   * io_context one after another, so submission of transactions is not
+   * blocked for longer than a batch takes
+   */
+  class PoolRevalidatorImpl
+      : public PoolRevalidator,
+        public std::enable_shared_from_this<PoolRevalidatorImpl> {
+   public:
+    /**
+     * Default number of transactions re-validated at once
+     */
+    static constexpr size_t kDefaultBatchSize = 16;
+
+    /**
+     * @param batch_size maximum number of transactions re-validated before
+     * other handlers of the io_context are given a chance to run
+     */
+    struct Params {
+      size_t batch_size = kDefaultBatchSize;
+    };
+
+    PoolRevalidatorImpl(
+        std::shared_ptr<TransactionPool> pool,
+        std::shared_ptr<runtime::TaggedTransactionQueue> tx_queue,
+        std::shared_ptr<storage::trie::TrieDb> trie_db,
+        std::shared_ptr<crypto::Hasher> hasher,
+        std::shared_ptr<boost::asio::io_context> io_context,
+        Params params);
+
+    ~PoolRevalidatorImpl() override = default;
+
+    void onBlockImported(const primitives::Block &block) override;
+
+    /// @return number of transactions waiting for re-validation
+    size_t queueSize() const;
+
+   private:
+    /// Put \param tx_hash to the queue of \param urgent or of the regular
+    /// transactions, unless it is queued already
+    void enqueue(const Transaction::Hash &tx_hash, bool urgent);
+
+    /// Post the next batch to the io_context, unless it is posted already
+    void scheduleBatch();
+
+    void processBatch();
+
+    /// Validate \param tx against the current state and update the pool
+    void revalidate(const Transaction &tx);
+
+    std::shared_ptr<TransactionPool> pool_;
+    std::shared_ptr<runtime::TaggedTransactionQueue> tx_queue_;
+    std::shared_ptr<storage::trie::TrieDb> trie_db_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+    std::shared_ptr<boost::asio::io_context> io_context_;
+    Params params_;
+
+    /// transactions affected by the tags of the included ones
+    std::deque<Transaction::Hash> urgent_queue_;
+    /// the rest of the transactions of the pool
+    std::deque<Transaction::Hash> regular_queue_;
+    /// transactions in either of the queues
+    std::unordered_set<Transaction::Hash> queued_;
+    bool batch_scheduled_{false};
+
+    common::Logger logger_;
+  };
+
+}  // namespace kagome::transaction_pool
+
+#endif  // KAGOME_POOL_REVALIDATOR_IMPL_HPP
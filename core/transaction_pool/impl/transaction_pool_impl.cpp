@@ -5,6 +5,10 @@
 
 #include "transaction_pool/impl/transaction_pool_impl.hpp"
 
+#include <algorithm>
+#include <unordered_set>
+
+#include <boost/optional.hpp>
 #include "primitives/block_id.hpp"
 #include "transaction_pool/transaction_pool_error.hpp"
 
@@ -13,6 +17,97 @@ using kagome::primitives::Transaction;
 
 namespace kagome::transaction_pool {
 
+  namespace {
+    /// Remove \param value from the unordered small vector \param values
+    template <typename Values, typename Value>
+    void eraseUnordered(Values &values, const Value &value) {
+      auto it = std::find(values.begin(), values.end(), value);
+      if (it != values.end()) {
+        *it = values.back();
+        values.pop_back();
+      }
+    }
+  }  // namespace
+
+  /**
+   * Walks ready transactions lazily: the next transaction is the best one of
+   * the ready roots and the transactions, which tags requirements are provided
+   * by the transactions returned before
+   */
+  class TransactionPoolImpl::BestReadyIterator : public ReadyIterator {
+   public:
+    explicit BestReadyIterator(const TransactionPoolImpl &pool)
+        : pool_{pool}, next_root_{pool_.ready_roots_.begin()} {}
+
+    std::shared_ptr<const Transaction> next() override {
+      // dependents are unlocked here, so they can be skipped before
+      if (last_) {
+        unlockDependents(*last_);
+        last_ = boost::none;
+      }
+      while (true) {
+        bool take_root =
+            next_root_ != pool_.ready_roots_.end()
+            and (unlocked_.empty() or *next_root_ < *unlocked_.begin());
+        if (not take_root and unlocked_.empty()) {
+          return nullptr;
+        }
+        TxHandle handle{};
+        if (take_root) {
+          handle = (next_root_++)->handle;
+        } else {
+          handle = unlocked_.begin()->handle;
+          unlocked_.erase(unlocked_.begin());
+        }
+        if (auto slot = pool_.getSlot(handle)) {
+          last_ = handle;
+          return slot->tx;
+        }
+      }
+    }
+
+    void skipDependents() override {
+      last_ = boost::none;
+    }
+
+   private:
+    /// Make transactions, which requirements are satisfied by the tags of
+    /// \param handle, available to be returned
+    void unlockDependents(const TxHandle &handle) {
+      auto slot = pool_.getSlot(handle);
+      if (not slot) {
+        return;
+      }
+      provided_.insert(slot->provides.begin(), slot->provides.end());
+      for (auto tag_id : slot->provides) {
+        for (auto &dependent_handle : pool_.tags_[tag_id].dependents) {
+          auto dependent = pool_.getSlot(dependent_handle);
+          if (not dependent or not dependent->ready
+              or unlocked_slots_.count(dependent_handle.index) != 0) {
+            continue;
+          }
+          if (std::all_of(dependent->requires.begin(),
+                          dependent->requires.end(),
+                          [this](TagId required) {
+                            return provided_.count(required) != 0;
+                          })) {
+            unlocked_slots_.insert(dependent_handle.index);
+            unlocked_.insert(ReadyOrder{dependent->tx->priority,
+                                        dependent->ready_seq,
+                                        dependent_handle});
+          }
+        }
+      }
+    }
+
+    const TransactionPoolImpl &pool_;
+    boost::optional<TxHandle> last_;
+    std::set<ReadyOrder>::const_iterator next_root_;
+    std::set<ReadyOrder> unlocked_;
+    std::unordered_set<uint32_t> unlocked_slots_;
+    std::unordered_set<TagId> provided_;
+  };
+
   TransactionPoolImpl::TransactionPoolImpl(
       std::unique_ptr<PoolModerator> moderator,
       std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
@@ -39,71 +134,143 @@ namespace kagome::transaction_pool {
 
   outcome::result<void> TransactionPoolImpl::submitOne(
       const std::shared_ptr<Transaction> &tx) {
-    if (auto [_, ok] = imported_txs_.emplace(tx->hash, tx); !ok) {
+    if (moderator_->isBanned(tx->hash)) {
+      return TransactionPoolError::TX_BANNED;
+    }
+    if (imported_txs_.count(tx->hash) != 0) {
       return TransactionPoolError::TX_ALREADY_IMPORTED;
     }
+    if (imported_txs_.size() >= limits_.capacity) {
+      return TransactionPoolError::POOL_IS_FULL;
+    }
 
-    auto processResult = processTransaction(tx);
-    if (processResult.has_error()
-        && processResult.error() == TransactionPoolError::POOL_IS_FULL) {
-      imported_txs_.erase(tx->hash);
+    auto handle = allocateSlot(tx);
+    imported_txs_.emplace(tx->hash, handle);
+    if (getSlot(handle)->missing_tags == 0) {
+      processTransactionAsReady(handle);
     }
+    return outcome::success();
+  }
 
-    return processResult;
+  TransactionPoolImpl::TxSlot *TransactionPoolImpl::getSlot(
+      const TxHandle &handle) {
+    return const_cast<TxSlot *>(
+        static_cast<const TransactionPoolImpl *>(this)->getSlot(handle));
   }
 
-  outcome::result<void> TransactionPoolImpl::processTransaction(
-      const std::shared_ptr<Transaction> &tx) {
-    OUTCOME_TRY(ensureSpace());
-    if (checkForReady(tx)) {
-      OUTCOME_TRY(processTransactionAsReady(tx));
-    } else {
-      OUTCOME_TRY(processTransactionAsWaiting(tx));
+  const TransactionPoolImpl::TxSlot *TransactionPoolImpl::getSlot(
+      const TxHandle &handle) const {
+    if (handle.index >= slots_.size()) {
+      return nullptr;
     }
-    return outcome::success();
+    auto &slot = slots_[handle.index];
+    if (slot.generation != handle.generation or not slot.tx) {
+      return nullptr;
+    }
+    return &slot;
   }
 
-  outcome::result<void> TransactionPoolImpl::processTransactionAsReady(
-      const std::shared_ptr<Transaction> &tx) {
-    if (hasSpaceInReady()) {
-      setReady(tx);
+  TransactionPoolImpl::TxHandle TransactionPoolImpl::allocateSlot(
+      std::shared_ptr<Transaction> tx) {
+    uint32_t index{};
+    if (free_slots_.empty()) {
+      index = slots_.size();
+      slots_.emplace_back();
     } else {
-      postponeTransaction(tx);
+      index = free_slots_.back();
+      free_slots_.pop_back();
     }
+    TxHandle handle{index, slots_[index].generation};
 
-    return outcome::success();
-  }
+    TagIds requires;
+    for (auto &tag : tx->requires) {
+      requires.push_back(internTag(tag));
+    }
+    TagIds provides;
+    for (auto &tag : tx->provides) {
+      provides.push_back(internTag(tag));
+    }
 
-  bool TransactionPoolImpl::hasSpaceInReady() const {
-    return ready_txs_.size() < limits_.max_ready_num;
+    auto &slot = slots_[index];
+    slot.tx = std::move(tx);
+    slot.requires = std::move(requires);
+    slot.provides = std::move(provides);
+    slot.missing_tags = 0;
+    slot.ready = false;
+    slot.postponed = false;
+    for (auto tag_id : slot.requires) {
+      auto &entry = tags_[tag_id];
+      entry.dependents.push_back(handle);
+      if (entry.ready_providers.empty()) {
+        ++slot.missing_tags;
+      }
+    }
+    return handle;
   }
 
-  void TransactionPoolImpl::postponeTransaction(
-      const std::shared_ptr<Transaction> &tx) {
-    postponed_txs_.push_back(tx);
+  void TransactionPoolImpl::freeSlot(const TxHandle &handle) {
+    auto &slot = slots_[handle.index];
+    for (auto tag_id : slot.requires) {
+      eraseUnordered(tags_[tag_id].dependents, handle);
+      releaseTag(tag_id);
+    }
+    for (auto tag_id : slot.provides) {
+      releaseTag(tag_id);
+    }
+    slot.tx.reset();
+    slot.requires.clear();
+    slot.provides.clear();
+    ++slot.generation;
+    free_slots_.push_back(handle.index);
   }
 
-  outcome::result<void> TransactionPoolImpl::processTransactionAsWaiting(
-      const std::shared_ptr<Transaction> &tx) {
-    OUTCOME_TRY(ensureSpace());
-
-    addTransactionAsWaiting(tx);
-
-    return outcome::success();
+  TransactionPoolImpl::TagId TransactionPoolImpl::internTag(
+      const Transaction::Tag &tag) {
+    auto it = tag_ids_.find(tag);
+    if (it == tag_ids_.end()) {
+      TagId tag_id{};
+      if (free_tag_ids_.empty()) {
+        tag_id = tags_.size();
+        tags_.emplace_back();
+      } else {
+        tag_id = free_tag_ids_.back();
+        free_tag_ids_.pop_back();
+      }
+      it = tag_ids_.emplace(tag, tag_id).first;
+      // keys of the unordered map are not moved on rehash
+      tags_[tag_id].tag = &it->first;
+    }
+    ++tags_[it->second].refs;
+    return it->second;
   }
 
-  outcome::result<void> TransactionPoolImpl::ensureSpace() const {
-    if (imported_txs_.size() > limits_.capacity) {
-      return TransactionPoolError::POOL_IS_FULL;
+  void TransactionPoolImpl::releaseTag(TagId tag_id) {
+    auto &entry = tags_[tag_id];
+    BOOST_ASSERT(entry.refs > 0);
+    if (--entry.refs != 0) {
+      return;
     }
+    BOOST_ASSERT(entry.ready_providers.empty());
+    BOOST_ASSERT(entry.dependents.empty());
+    tag_ids_.erase(tag_ids_.find(*entry.tag));
+    entry.tag = nullptr;
+    free_tag_ids_.push_back(tag_id);
+  }
 
-    return outcome::success();
+  bool TransactionPoolImpl::hasSpaceInReady() const {
+    return ready_num_ < limits_.max_ready_num;
   }
 
-  void TransactionPoolImpl::addTransactionAsWaiting(
-      const std::shared_ptr<Transaction> &tx) {
-    for (auto &tag : tx->requires) {
-      tx_waits_tag_.emplace(tag, tx);
+  void TransactionPoolImpl::processTransactionAsReady(const TxHandle &handle) {
+    auto slot = getSlot(handle);
+    if (slot->ready or slot->postponed) {
+      return;
+    }
+    if (hasSpaceInReady()) {
+      setReady(handle);
+    } else {
+      slot->postponed = true;
+      postponed_txs_.push_back(handle);
     }
   }
 
@@ -113,10 +280,10 @@ namespace kagome::transaction_pool {
     if (tx_node.empty()) {
       return TransactionPoolError::TX_NOT_FOUND;
     }
-    auto &tx = tx_node.mapped();
+    auto handle = tx_node.mapped();
 
-    unsetReady(tx);
-    delTransactionAsWaiting(tx);
+    unsetReady(handle);
+    freeSlot(handle);
 
     processPostponedTransactions();
 
@@ -132,33 +299,25 @@ namespace kagome::transaction_pool {
     return outcome::success();
   }
 
-  void TransactionPoolImpl::processPostponedTransactions() {
-    // Move to local for avoid endless cycle at possible coming back tx
-    auto postponed_txs = std::move(postponed_txs_);
-    while (!postponed_txs.empty()) {
-      auto tx = postponed_txs.front().lock();
-      postponed_txs.pop_front();
-
-      auto result = processTransaction(tx);
-      if (result.has_error()
-          && result.error() == TransactionPoolError::POOL_IS_FULL) {
-        postponed_txs_.insert(postponed_txs_.end(),
-                              std::make_move_iterator(postponed_txs.begin()),
-                              std::make_move_iterator(postponed_txs.end()));
-        return;
-      }
+  void TransactionPoolImpl::reportInvalid(const Transaction::Hash &tx_hash) {
+    if (removeOne(tx_hash)) {
+      moderator_->ban(tx_hash);
     }
   }
 
-  void TransactionPoolImpl::delTransactionAsWaiting(
-      const std::shared_ptr<Transaction> &tx) {
-    for (auto &tag : tx->requires) {
-      auto range = tx_waits_tag_.equal_range(tag);
-      for (auto i = range.first; i != range.second;) {
-        if (i->second.lock() == tx) {
-          tx_waits_tag_.erase(i);
-          break;
-        }
+  void TransactionPoolImpl::processPostponedTransactions() {
+    while (not postponed_txs_.empty() and hasSpaceInReady()) {
+      auto handle = postponed_txs_.front();
+      postponed_txs_.pop_front();
+
+      auto slot = getSlot(handle);
+      if (not slot) {
+        continue;
+      }
+      slot->postponed = false;
+      // requirements could be lost while the transaction was postponed
+      if (slot->missing_tags == 0) {
+        setReady(handle);
       }
     }
   }
@@ -166,22 +325,70 @@ namespace kagome::transaction_pool {
   std::map<Transaction::Hash, std::shared_ptr<Transaction>>
   TransactionPoolImpl::getReadyTransactions() const {
     std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready;
-    std::for_each(ready_txs_.begin(), ready_txs_.end(), [&ready](auto it) {
-      if (auto tx = it.second.lock()) {
-        ready.emplace(it.first, std::move(tx));
+    for (auto &slot : slots_) {
+      if (slot.tx and slot.ready) {
+        ready.emplace(slot.tx->hash, slot.tx);
       }
-    });
+    }
     return ready;
   }
 
+  std::unique_ptr<TransactionPool::ReadyIterator>
+  TransactionPoolImpl::getReadyIterator() const {
+    return std::make_unique<BestReadyIterator>(*this);
+  }
+
+  std::shared_ptr<const Transaction> TransactionPoolImpl::getTransaction(
+      const Transaction::Hash &tx_hash) const {
+    auto it = imported_txs_.find(tx_hash);
+    if (it == imported_txs_.end()) {
+      return nullptr;
+    }
+    return getSlot(it->second)->tx;
+  }
+
+  std::vector<Transaction::Hash> TransactionPoolImpl::getTransactionHashes()
+      const {
+    std::vector<Transaction::Hash> hashes;
+    hashes.reserve(imported_txs_.size());
+    for (auto &[hash, handle] : imported_txs_) {
+      hashes.push_back(hash);
+    }
+    return hashes;
+  }
+
+  std::vector<Transaction::Hash> TransactionPoolImpl::getTransactionsByTags(
+      const std::vector<Transaction::Tag> &tags) const {
+    std::vector<Transaction::Hash> hashes;
+    auto collect = [&](const TxHandles &handles) {
+      for (auto &handle : handles) {
+        if (auto slot = getSlot(handle)) {
+          hashes.push_back(slot->tx->hash);
+        }
+      }
+    };
+    for (auto &tag : tags) {
+      auto it = tag_ids_.find(tag);
+      if (it == tag_ids_.end()) {
+        continue;
+      }
+      auto &entry = tags_[it->second];
+      collect(entry.ready_providers);
+      collect(entry.dependents);
+    }
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+    return hashes;
+  }
+
   outcome::result<std::vector<Transaction>> TransactionPoolImpl::removeStale(
       const primitives::BlockId &at) {
     OUTCOME_TRY(number, header_repo_->getNumberById(at));
 
     std::vector<Transaction::Hash> remove_to;
 
-    for (auto &[txHash, tx] : imported_txs_) {
-      if (moderator_->banIfStale(number, *tx)) {
+    for (auto &[txHash, handle] : imported_txs_) {
+      if (moderator_->banIfStale(number, *getSlot(handle)->tx)) {
         remove_to.emplace_back(txHash);
       }
     }
@@ -195,110 +402,74 @@ namespace kagome::transaction_pool {
     return outcome::success();
   }
 
-  bool TransactionPoolImpl::isInReady(
-      const std::shared_ptr<const Transaction> &tx) const {
-    auto i = ready_txs_.find(tx->hash);
-    return i != ready_txs_.end() && !i->second.expired();
-  }
-
-  bool TransactionPoolImpl::checkForReady(
-      const std::shared_ptr<const Transaction> &tx) const {
-    return std::all_of(
-        tx->requires.begin(), tx->requires.end(), [this](auto &&tag) {
-          auto range = tx_provides_tag_.equal_range(tag);
-          return range.first != range.second;
-        });
-  }
-
-  void TransactionPoolImpl::setReady(const std::shared_ptr<Transaction> &tx) {
-    if (auto [_, ok] = ready_txs_.emplace(tx->hash, tx); ok) {
-      commitRequiredTags(tx);
-      commitProvidedTags(tx);
+  void TransactionPoolImpl::setReady(const TxHandle &handle) {
+    auto slot = getSlot(handle);
+    BOOST_ASSERT(slot->missing_tags == 0);
+    if (slot->ready) {
+      return;
     }
-  }
-
-  void TransactionPoolImpl::commitRequiredTags(
-      const std::shared_ptr<Transaction> &tx) {
-    for (auto &tag : tx->requires) {
-      auto range = tx_waits_tag_.equal_range(tag);
-      for (auto i = range.first; i != range.second;) {
-        auto ci = i++;
-        if (ci->second.lock() == tx) {
-          auto node = tx_waits_tag_.extract(ci);
-          tx_depends_on_tag_.emplace(std::move(node.key()),
-                                     std::move(node.mapped()));
-        }
-      }
+    slot->ready = true;
+    slot->ready_seq = next_ready_seq_++;
+    ++ready_num_;
+    if (slot->requires.empty()) {
+      ready_roots_.insert(
+          ReadyOrder{slot->tx->priority, slot->ready_seq, handle});
     }
-  }
 
-  void TransactionPoolImpl::commitProvidedTags(
-      const std::shared_ptr<Transaction> &tx) {
-    for (auto &tag : tx->provides) {
-      tx_provides_tag_.emplace(tag, tx);
-
-      provideTag(tag);
+    for (auto tag_id : slot->provides) {
+      auto &providers = tags_[tag_id].ready_providers;
+      providers.push_back(handle);
+      if (providers.size() == 1) {
+        provideTag(tag_id);
+      }
     }
   }
 
-  void TransactionPoolImpl::provideTag(const Transaction::Tag &tag) {
-    auto range = tx_waits_tag_.equal_range(tag);
-    for (auto it = range.first; it != range.second;) {
-      auto tx = (it++)->second.lock();
-      if (checkForReady(tx)) {
-        if (hasSpaceInReady()) {
-          setReady(tx);
-        } else {
-          postponeTransaction(tx);
-        }
+  void TransactionPoolImpl::provideTag(TagId tag_id) {
+    // dependents are not changed, while transactions become ready
+    auto &dependents = tags_[tag_id].dependents;
+    for (size_t i = 0; i < dependents.size(); ++i) {
+      auto handle = dependents[i];
+      auto slot = getSlot(handle);
+      BOOST_ASSERT(slot->missing_tags > 0);
+      if (--slot->missing_tags == 0) {
+        processTransactionAsReady(handle);
       }
     }
   }
 
-  void TransactionPoolImpl::unsetReady(const std::shared_ptr<Transaction> &tx) {
-    if (auto tx_node = ready_txs_.extract(tx->hash); !tx_node.empty()) {
-      rollbackRequiredTags(tx);
-      rollbackProvidedTags(tx);
+  void TransactionPoolImpl::unsetReady(const TxHandle &handle) {
+    auto slot = getSlot(handle);
+    if (not slot->ready) {
+      return;
     }
-  }
-
-  void TransactionPoolImpl::rollbackRequiredTags(
-      const std::shared_ptr<Transaction> &tx) {
-    for (auto &tag : tx->requires) {
-      tx_waits_tag_.emplace(tag, tx);
+    slot->ready = false;
+    --ready_num_;
+    if (slot->requires.empty()) {
+      ready_roots_.erase(
+          ReadyOrder{slot->tx->priority, slot->ready_seq, handle});
     }
-  }
 
-  void TransactionPoolImpl::rollbackProvidedTags(
-      const std::shared_ptr<Transaction> &tx) {
-    for (auto &tag : tx->provides) {
-      auto range = tx_provides_tag_.equal_range(tag);
-      for (auto i = range.first; i != range.second; ++i) {
-        if (i->second.lock() == tx) {
-          tx_provides_tag_.erase(i);
-          break;
-        }
+    for (auto tag_id : slot->provides) {
+      auto &providers = tags_[tag_id].ready_providers;
+      eraseUnordered(providers, handle);
+      if (providers.empty()) {
+        unprovideTag(tag_id);
       }
-
-      unprovideTag(tag);
     }
   }
 
-  void TransactionPoolImpl::unprovideTag(const Transaction::Tag &tag) {
-    if (tx_provides_tag_.find(tag) == tx_provides_tag_.end()) {
-      for (auto it = tx_depends_on_tag_.find(tag);
-           it != tx_depends_on_tag_.end();
-           it = tx_depends_on_tag_.find(tag)) {
-        if (auto tx = it->second.lock()) {
-          unsetReady(tx);
-        }
-        tx_depends_on_tag_.erase(it);
-      }
+  void TransactionPoolImpl::unprovideTag(TagId tag_id) {
+    auto &dependents = tags_[tag_id].dependents;
+    for (size_t i = 0; i < dependents.size(); ++i) {
+      auto handle = dependents[i];
+      ++getSlot(handle)->missing_tags;
+      unsetReady(handle);
     }
   }
 
   TransactionPoolImpl::Status TransactionPoolImpl::getStatus() const {
-    return Status{ready_txs_.size(), imported_txs_.size() - ready_txs_.size()};
+    return Status{ready_num_, imported_txs_.size() - ready_num_};
   }
 
 }  // namespace kagome::transaction_pool
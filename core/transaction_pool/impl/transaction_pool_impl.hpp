@@ -6,6 +6,12 @@
 #ifndef KAGOME_TRANSACTION_POOL_IMPL_HPP
 #define KAGOME_TRANSACTION_POOL_IMPL_HPP
 
+#include <deque>
+#include <set>
+#include <unordered_map>
+
+#include <boost/container/small_vector.hpp>
+#include <boost/functional/hash.hpp>
 #include <outcome/outcome.hpp>
 
 #include "blockchain/block_header_repository.hpp"
@@ -15,6 +21,12 @@
 
 namespace kagome::transaction_pool {
 
+  /**
+   * Transactions are kept in a slab and referenced by handles, tags are
+   * interned to dense ids. Each tag id indexes the ready transactions, which
+   * provide the tag, and the transactions, which require it, so import and
+   * removal of a transaction take time proportional to the number of its tags
+   */
   class TransactionPoolImpl : public TransactionPool {
     static constexpr auto kDefaultLoggerTag = "Transaction Pool";
 
@@ -39,59 +51,123 @@ namespace kagome::transaction_pool {
     outcome::result<void> remove(
         const std::vector<Transaction::Hash> &tx_hashes) override;
 
+    void reportInvalid(const Transaction::Hash &tx_hash) override;
+
     std::map<Transaction::Hash, std::shared_ptr<Transaction>>
     getReadyTransactions() const override;
 
+    std::unique_ptr<ReadyIterator> getReadyIterator() const override;
+
+    std::shared_ptr<const Transaction> getTransaction(
+        const Transaction::Hash &tx_hash) const override;
+
+    std::vector<Transaction::Hash> getTransactionHashes() const override;
+
+    std::vector<Transaction::Hash> getTransactionsByTags(
+        const std::vector<Transaction::Tag> &tags) const override;
+
     outcome::result<std::vector<Transaction>> removeStale(
         const primitives::BlockId &at) override;
 
     Status getStatus() const override;
 
    private:
+    /// Interned tag
+    using TagId = uint32_t;
+    using TagIds = boost::container::small_vector<TagId, 2>;
+
+    /// Reference to a slot of the slab; generation tells apart transactions,
+    /// which took the same slot one after another
+    struct TxHandle {
+      uint32_t index;
+      uint32_t generation;
+
+      bool operator==(const TxHandle &other) const {
+        return index == other.index and generation == other.generation;
+      }
+    };
+    using TxHandles = boost::container::small_vector<TxHandle, 2>;
+
+    /// Slot of the slab, which keeps an imported transaction
+    struct TxSlot {
+      std::shared_ptr<Transaction> tx;
+      uint32_t generation{0};
+      TagIds requires;
+      TagIds provides;
+      /// number of the required tags, which no ready transaction provides
+      size_t missing_tags{0};
+      bool ready{false};
+      /// ready transaction over the limit, which waits for the space
+      bool postponed{false};
+      /// order, in which the transaction became ready
+      uint64_t ready_seq{0};
+    };
+
+    /// Index of the transactions by an interned tag
+    struct TagEntry {
+      /// ready transactions, which provide the tag
+      TxHandles ready_providers;
+      /// transactions, which require the tag, both ready and waiting
+      TxHandles dependents;
+      /// number of imported transactions, which provide or require the tag
+      size_t refs{0};
+      /// key of the tag in the interning map
+      const Transaction::Tag *tag{nullptr};
+    };
+
+    /// Position of a ready transaction in the order of inclusion to a block
+    struct ReadyOrder {
+      Transaction::Priority priority;
+      uint64_t seq;
+      TxHandle handle;
+
+      /// transactions with higher priority go first, among transactions with
+      /// equal priority the ones, which became ready earlier, go first
+      bool operator<(const ReadyOrder &other) const {
+        return priority != other.priority ? priority > other.priority
+                                          : seq < other.seq;
+      }
+    };
+
+    class BestReadyIterator;
+
     outcome::result<void> submitOne(const std::shared_ptr<Transaction> &tx);
 
-    outcome::result<void> processTransaction(
-        const std::shared_ptr<Transaction> &tx);
+    /// @return slot of \param handle or nullptr, if the transaction of the
+    /// handle is removed already
+    TxSlot *getSlot(const TxHandle &handle);
+    const TxSlot *getSlot(const TxHandle &handle) const;
 
-    outcome::result<void> processTransactionAsReady(
-        const std::shared_ptr<Transaction> &tx);
+    /// Put \param tx to a free slot of the slab and index its tags
+    TxHandle allocateSlot(std::shared_ptr<Transaction> tx);
 
-    outcome::result<void> processTransactionAsWaiting(
-        const std::shared_ptr<Transaction> &tx);
+    /// Unindex tags of the transaction of \param handle and free its slot
+    void freeSlot(const TxHandle &handle);
 
-    outcome::result<void> ensureSpace() const;
+    /// @return id of \param tag, which is referenced once more
+    TagId internTag(const Transaction::Tag &tag);
 
-    bool hasSpaceInReady() const;
+    /// Drop the reference to \param tag_id, the id is freed with the last one
+    void releaseTag(TagId tag_id);
 
-    void addTransactionAsWaiting(const std::shared_ptr<Transaction> &tx);
-
-    void delTransactionAsWaiting(const std::shared_ptr<Transaction> &tx);
+    bool hasSpaceInReady() const;
 
-    /// Postpone ready transaction (in case ready limit was enreach before)
-    void postponeTransaction(const std::shared_ptr<Transaction> &tx);
+    /// Make ready transaction of \param handle, which requirements are
+    /// satisfied, or postpone it, if the ready limit is reached
+    void processTransactionAsReady(const TxHandle &handle);
 
     /// Process postponed transactions (in case appearing space for them)
     void processPostponedTransactions();
 
-    void provideTag(const Transaction::Tag &tag);
+    void setReady(const TxHandle &handle);
 
-    void unprovideTag(const Transaction::Tag &tag);
+    void unsetReady(const TxHandle &handle);
 
-    void commitRequiredTags(const std::shared_ptr<Transaction> &tx);
+    /// Tag \param tag_id got the first ready provider
+    void provideTag(TagId tag_id);
 
-    void commitProvidedTags(const std::shared_ptr<Transaction> &tx);
-
-    void rollbackRequiredTags(const std::shared_ptr<Transaction> &tx);
-
-    void rollbackProvidedTags(const std::shared_ptr<Transaction> &tx);
-
-    bool checkForReady(const std::shared_ptr<const Transaction> &tx) const;
-
-    void setReady(const std::shared_ptr<Transaction> &tx);
-
-    void unsetReady(const std::shared_ptr<Transaction> &tx);
-
-    bool isInReady(const std::shared_ptr<const Transaction> &tx) const;
+    /// Tag \param tag_id lost the last ready provider
+    void unprovideTag(TagId tag_id);
 
     std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
 
@@ -101,26 +177,31 @@ namespace kagome::transaction_pool {
     std::unique_ptr<PoolModerator> moderator_;
 
     /// All of imported transaction, contained in the pool
-    std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
-        imported_txs_;
+    std::unordered_map<Transaction::Hash, TxHandle> imported_txs_;
 
-    /// Collection transaction with full-satisfied dependensies
-    std::unordered_map<Transaction::Hash, std::weak_ptr<Transaction>>
-        ready_txs_;
+    /// Slots of the imported transactions
+    std::vector<TxSlot> slots_;
+    std::vector<uint32_t> free_slots_;
 
-    /// List of ready transaction over limit. It will be process first of all
-    std::list<std::weak_ptr<Transaction>> postponed_txs_;
+    /// Ids of the interned tags
+    std::unordered_map<Transaction::Tag, TagId, boost::hash<Transaction::Tag>>
+        tag_ids_;
+    /// Index of the transactions by the tag ids
+    std::vector<TagEntry> tags_;
+    std::vector<TagId> free_tag_ids_;
 
-    /// Transactions which provides specific tags
-    std::multimap<Transaction::Tag, std::weak_ptr<Transaction>>
-        tx_provides_tag_;
+    /// Number of transactions with full-satisfied dependencies
+    size_t ready_num_{0};
 
-    /// Transactions with resolved requirement of a specific tag
-    std::multimap<Transaction::Tag, std::weak_ptr<Transaction>>
-        tx_depends_on_tag_;
+    /// Ready transactions, which require no tags, in the order of inclusion.
+    /// Other ready transactions are reached through the tags they require
+    std::set<ReadyOrder> ready_roots_;
 
-    /// Transactions with unresolved require of specific tags
-    std::multimap<Transaction::Tag, std::weak_ptr<Transaction>> tx_waits_tag_;
+    /// Sequence number of the next transaction to become ready
+    uint64_t next_ready_seq_{0};
+
+    /// List of ready transaction over limit. It will be process first of all
+    std::deque<TxHandle> postponed_txs_;
 
     Limits limits_;
   };
@@ -0,0 +1,32 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_POOL_REVALIDATOR_HPP
+#define KAGOME_POOL_REVALIDATOR_HPP
+
+#include "primitives/block.hpp"
+
+namespace kagome::transaction_pool {
+
+  /**
+   * PoolRevalidator keeps the transaction pool consistent with the state of
+   * the imported blocks: transactions, which became invalid, are removed from
+   * the pool in the background rather than when a block is built
+   */
+  class PoolRevalidator {
+   public:
+    virtual ~PoolRevalidator() = default;
+
+    /**
+     * Remove transactions included to \param block from the pool and schedule
+     * re-validation of the pool against the new state. Transactions, which
+     * provide or require the tags of the included ones, are re-validated first
+     */
+    virtual void onBlockImported(const primitives::Block &block) = 0;
+  };
+
+}  // namespace kagome::transaction_pool
+
+#endif  // KAGOME_POOL_REVALIDATOR_HPP
@@ -19,6 +19,7 @@ namespace kagome::transaction_pool {
    public:
     struct Status;
     struct Limits;
+    class ReadyIterator;
 
     virtual ~TransactionPool() = default;
 
@@ -52,6 +53,13 @@ namespace kagome::transaction_pool {
     virtual outcome::result<void> remove(
         const std::vector<Transaction::Hash> &txHashes) = 0;
 
+    /**
+     * Remove transaction, which could not be applied to a block, from the pool
+     * and ban it for some time
+     * @param txHash - hash of the invalid transaction
+     */
+    virtual void reportInvalid(const Transaction::Hash &txHash) = 0;
+
     /**
      * @return transactions ready to included in the next block, sorted by their
      * priority
@@ -59,6 +67,34 @@ namespace kagome::transaction_pool {
     virtual std::map<Transaction::Hash, std::shared_ptr<Transaction>>
     getReadyTransactions() const = 0;
 
+    /**
+     * @return iterator over transactions ready to be included in the next
+     * block: transactions with higher priority go first, but a transaction
+     * never goes before the transactions it requires tags of. Ready
+     * transactions are not copied, so the pool must not be modified while the
+     * iterator is used
+     */
+    virtual std::unique_ptr<ReadyIterator> getReadyIterator() const = 0;
+
+    /**
+     * @return transaction of \param tx_hash or nullptr, if it is not in the
+     * pool
+     */
+    virtual std::shared_ptr<const Transaction> getTransaction(
+        const Transaction::Hash &tx_hash) const = 0;
+
+    /**
+     * @return hashes of all transactions in the pool, both ready and waiting
+     */
+    virtual std::vector<Transaction::Hash> getTransactionHashes() const = 0;
+
+    /**
+     * @return hashes of the transactions, which require any of \param tags,
+     * and of the ready transactions, which provide them
+     */
+    virtual std::vector<Transaction::Hash> getTransactionsByTags(
+        const std::vector<Transaction::Tag> &tags) const = 0;
+
     /**
      * Remove from the pool and temporarily ban transactions which longevity is
      * expired
@@ -78,6 +114,18 @@ namespace kagome::transaction_pool {
     size_t waiting_num;
   };
 
+  class TransactionPool::ReadyIterator {
+   public:
+    virtual ~ReadyIterator() = default;
+
+    /// @return next ready transaction or nullptr, if there are no more of them
+    virtual std::shared_ptr<const Transaction> next() = 0;
+
+    /// Do not return transactions, which depend on the tags provided by the
+    /// transaction returned last, as it is not included to the block
+    virtual void skipDependents() = 0;
+  };
+
   struct TransactionPool::Limits {
     static constexpr size_t kDefaultMaxReadyNum = 128;
     static constexpr size_t kDefaultCapacity = 512;
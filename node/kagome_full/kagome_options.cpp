@@ -5,6 +5,7 @@
 
 #include "kagome_options.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <string>
 
@@ -26,6 +27,11 @@ namespace kagome::options {
     uint16_t p2p_port;               // port for peer to peer interactions
     uint16_t rpc_http_port;          // port for rpcs over HTTP
     uint16_t rpc_ws_port;            // port for rpcs over Websockets
+    size_t max_threads;              // threads of the node in total
+    size_t rpc_threads;              // threads serving rpc transport
+    size_t rpc_workers;              // threads executing rpc requests
+    size_t import_workers;           // threads verifying imported headers
+    size_t vote_workers;             // threads verifying grandpa votes
     int verbosity;  // log level (0-trace, 5-only critical, 6-no logs)
     is_genesis_epoch_ = false;  // if we need to execute genesis epoch
 
@@ -46,6 +52,16 @@ namespace kagome::options {
        "port for RPCs over HTTP")
       ("rpc_ws_port", po::value<uint16_t>(&rpc_ws_port)->default_value(40364),
        "port for RPCs over Websockets")
+      ("max_threads", po::value<size_t>(&max_threads)->default_value(0),
+       "number of threads of the node in total, 0 - the number of cores")
+      ("rpc_threads", po::value<size_t>(&rpc_threads)->default_value(application::ExecutionConfig::kDefaultRpcThreads),
+       "number of threads serving RPC connections")
+      ("rpc_workers", po::value<size_t>(&rpc_workers)->default_value(application::ExecutionConfig::kDefaultRpcWorkers),
+       "number of threads executing RPC requests, which read the state")
+      ("import_workers", po::value<size_t>(&import_workers)->default_value(0),
+       "number of threads verifying headers of imported blocks, 0 - a share of the threads left by max_threads")
+      ("vote_workers", po::value<size_t>(&vote_workers)->default_value(0),
+       "number of threads verifying GRANDPA votes, 0 - a share of the threads left by max_threads")
       ("genesis_epoch,e", "if we need to execute genesis epoch")
       ("verbosity,v", po::value<int>(&verbosity)->default_value(2),
        "Log level. 0 - trace, 1 - debug, 2 - info, 3 - warn, 4 - error, 5 - critical, 6 - no logs. Default: info");
@@ -78,6 +94,11 @@ namespace kagome::options {
     p2p_port_ = p2p_port;
     rpc_http_port_ = rpc_http_port;
     rpc_ws_port_ = rpc_ws_port;
+    execution_config_.max_threads = max_threads;
+    execution_config_.rpc_threads = std::max<size_t>(1, rpc_threads);
+    execution_config_.rpc_workers = std::max<size_t>(1, rpc_workers);
+    execution_config_.import_workers = import_workers;
+    execution_config_.vote_workers = vote_workers;
     verbosity_ = verbosity;
 
     return outcome::success();
@@ -130,6 +151,11 @@ namespace kagome::options {
     return rpc_ws_port_;
   }
 
+  const application::ExecutionConfig &KagomeOptions::getExecutionConfig()
+      const {
+    return execution_config_;
+  }
+
   uint8_t KagomeOptions::getVerbosity() const {
     return verbosity_;
   }
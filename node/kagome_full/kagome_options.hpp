@@ -10,6 +10,7 @@
 #include <libp2p/crypto/key.hpp>
 #include <outcome/outcome.hpp>
 
+#include "application/execution_config.hpp"
 #include "application/impl/local_key_storage.hpp"
 #include "common/logger.hpp"
 
@@ -77,6 +78,11 @@ namespace kagome::options {
 
     uint16_t getRpcWsPort() const;
 
+    /**
+     * @return threads configuration
+     */
+    const application::ExecutionConfig &getExecutionConfig() const;
+
     /**
      * @return log level
      */
@@ -109,6 +115,7 @@ namespace kagome::options {
     uint16_t p2p_port_{};
     uint16_t rpc_http_port_{};
     uint16_t rpc_ws_port_{};
+    application::ExecutionConfig execution_config_{};
     uint8_t verbosity_{};
     bool is_genesis_epoch_{};
     common::Logger logger_ = common::createLogger("Kagome options parser: ");
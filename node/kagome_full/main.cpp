@@ -30,6 +30,7 @@ int main(int argc, char **argv) {
   auto p2p_port = options_parser.getP2PPort();
   auto rpc_http_port = options_parser.getRpcHttpPort();
   auto rpc_ws_port = options_parser.getRpcWsPort();
+  auto &&execution_config = options_parser.getExecutionConfig();
   auto verbosity = options_parser.getVerbosity();
   bool is_genesis_epoch = options_parser.isGenesisEpoch();
 
@@ -40,6 +41,7 @@ int main(int argc, char **argv) {
       p2p_port,
       rpc_http_port,
       rpc_ws_port,
+      execution_config,
       is_genesis_epoch,
       verbosity);
   app->run();
@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
 #include <iostream>
 
 #include <boost/program_options.hpp>
@@ -18,6 +19,10 @@ int main(int argc, char **argv) {
   uint16_t p2p_port;               // port for peer to peer interactions
   uint16_t rpc_http_port;          // port for rpcs over HTTP
   uint16_t rpc_ws_port;            // port for rpcs over Websockets
+  size_t max_threads;              // threads of the node in total
+  size_t rpc_threads;              // threads serving rpc transport
+  size_t rpc_workers;              // threads executing rpc requests
+  size_t import_workers;           // threads verifying imported headers
   int verbosity;  // log level (0-trace, 5-only critical, 6-no logs)
 
   namespace po = boost::program_options;
@@ -35,6 +40,14 @@ int main(int argc, char **argv) {
        "port for RPCs over HTTP")
       ("rpc_ws_port", po::value<uint16_t>(&rpc_ws_port)->default_value(40364),
        "port for RPCs over Websockets")
+      ("max_threads", po::value<size_t>(&max_threads)->default_value(0),
+       "number of threads of the node in total, 0 - the number of cores")
+      ("rpc_threads", po::value<size_t>(&rpc_threads)->default_value(kagome::application::ExecutionConfig::kDefaultRpcThreads),
+       "number of threads serving RPC connections")
+      ("rpc_workers", po::value<size_t>(&rpc_workers)->default_value(kagome::application::ExecutionConfig::kDefaultRpcWorkers),
+       "number of threads executing RPC requests, which read the state")
+      ("import_workers", po::value<size_t>(&import_workers)->default_value(0),
+       "number of threads verifying headers of imported blocks, 0 - a share of the threads left by max_threads")
       ("genesis_epoch,e", "if we need to execute genesis epoch")
       ("verbosity,v", po::value<int>(&verbosity)->default_value(2),
        "Log level. 0 - trace, 1 - debug, 2 - info, 3 - warn, 4 - error, 5 - critical, 6 - no logs. Default: info");
@@ -54,12 +67,19 @@ int main(int argc, char **argv) {
     return 0;
   }
 
+  kagome::application::ExecutionConfig execution_config;
+  execution_config.max_threads = max_threads;
+  execution_config.rpc_threads = std::max<size_t>(1, rpc_threads);
+  execution_config.rpc_workers = std::max<size_t>(1, rpc_workers);
+  execution_config.import_workers = import_workers;
+
   auto &&app = std::make_shared<kagome::application::SyncingNodeApplication>(
       configuration_path,
       leveldb_path,
       p2p_port,
       rpc_http_port,
       rpc_ws_port,
+      execution_config,
       verbosity);
   app->run();
 
@@ -65,8 +65,11 @@ class ESSIntegrationTest : public ::testing::Test {
 
   std::vector<std::shared_ptr<JRpcProcessor>> processors{
       std::make_shared<ExtrinsicJRpcProcessor>(server, api)};
-  sptr<ApiService> service =
-      std::make_shared<ApiService>(std::vector<std::shared_ptr<Listener>>({listener}), server, processors);
+  sptr<ApiService> service = std::make_shared<ApiService>(
+      std::make_shared<RpcExecutor>(main_context, RpcExecutor::Params{}),
+      std::vector<std::shared_ptr<Listener>>({listener}),
+      server,
+      processors);
 
   Extrinsic extrinsic{};
   const std::string request =
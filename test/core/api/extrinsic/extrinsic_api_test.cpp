@@ -10,6 +10,7 @@
 #include "common/blob.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
 #include "mock/core/crypto/hasher_mock.hpp"
+#include "mock/core/network/extrinsic_gossiper_mock.hpp"
 #include "mock/core/runtime/tagged_transaction_queue_mock.hpp"
 #include "mock/core/storage/trie/trie_db_mock.hpp"
 #include "mock/core/transaction_pool/transaction_pool_mock.hpp"
@@ -29,6 +30,7 @@ using kagome::blockchain::BlockTree;
 using kagome::blockchain::BlockTreeMock;
 using kagome::common::Buffer;
 using kagome::common::Hash256;
+using kagome::network::ExtrinsicGossiperMock;
 using kagome::primitives::BlockId;
 using kagome::primitives::BlockInfo;
 using kagome::primitives::Extrinsic;
@@ -56,6 +58,7 @@ struct ExtrinsicSubmissionApiTest : public ::testing::Test {
   sptr<TransactionPoolMock> transaction_pool;  ///< transaction pool mock
   sptr<BlockTreeMock> block_tree;              ///< block tree mock instance
   sptr<TrieDbMock> trie_db_;                   ///> trie db mock
+  sptr<ExtrinsicGossiperMock> gossiper;        ///< gossiper mock
   sptr<ExtrinsicApiImpl> api;                  ///< api instance
   sptr<Extrinsic> extrinsic;                   ///< extrinsic instance
   sptr<ValidTransaction> valid_transaction;    ///< valid transaction instance
@@ -68,8 +71,9 @@ struct ExtrinsicSubmissionApiTest : public ::testing::Test {
     transaction_pool = std::make_shared<TransactionPoolMock>();
     block_tree = std::make_shared<BlockTreeMock>();
     trie_db_ = std::make_shared<TrieDbMock>();
+    gossiper = std::make_shared<ExtrinsicGossiperMock>();
     api = std::make_shared<ExtrinsicApiImpl>(
-        ttq, transaction_pool, hasher, block_tree, trie_db_);
+        ttq, transaction_pool, hasher, block_tree, trie_db_, gossiper);
     extrinsic.reset(new Extrinsic{"12"_hex2buf});
     valid_transaction.reset(new ValidTransaction{1, {{2}}, {{3}}, 4, true});
     deepest_hash = createHash256({1u, 2u, 3u});
@@ -100,6 +104,7 @@ TEST_F(ExtrinsicSubmissionApiTest, SubmitExtrinsicSuccess) {
                  true};
   EXPECT_CALL(*transaction_pool, submitOne(tr))
       .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*gossiper, propagateTransactions(std::vector<Transaction>{tr}));
 
   EXPECT_OUTCOME_TRUE(hash, api->submitExtrinsic(*extrinsic))
   ASSERT_EQ(hash, Hash256{});
@@ -165,6 +170,7 @@ TEST_F(ExtrinsicSubmissionApiTest, SubmitExtrinsicSubmitFail) {
   EXPECT_CALL(*transaction_pool, submitOne(tr))
       .WillOnce(
           Return(outcome::failure(TransactionPoolError::TX_ALREADY_IMPORTED)));
+  EXPECT_CALL(*gossiper, propagateTransactions(_)).Times(0);
 
   EXPECT_OUTCOME_FALSE_2(err, api->submitExtrinsic(*extrinsic))
   ASSERT_EQ(err.value(),
@@ -65,8 +65,13 @@ class ExtrinsicSubmissionServiceTest : public ::testing::Test {
 
   std::vector<std::shared_ptr<JRpcProcessor>> processors{
       std::make_shared<ExtrinsicJRpcProcessor>(server, api)};
-  sptr<ApiService> service =
-      std::make_shared<ApiService>(listeners, server, processors);
+  std::shared_ptr<boost::asio::io_context> context =
+      std::make_shared<boost::asio::io_context>();
+  sptr<ApiService> service = std::make_shared<ApiService>(
+      std::make_shared<RpcExecutor>(context, RpcExecutor::Params{}),
+      listeners,
+      server,
+      processors);
 
   sptr<SessionMock> session = std::make_shared<SessionMock>();
 
@@ -101,6 +106,7 @@ TEST_F(ExtrinsicSubmissionServiceTest, RequestSuccess) {
 
   // imitate request received
   session->processRequest(request, session);
+  context->run();
 }
 
 /**
@@ -118,4 +124,5 @@ TEST_F(ExtrinsicSubmissionServiceTest, RequestFail) {
   EXPECT_CALL(*session, respond(response)).Times(1);
   ASSERT_NO_THROW(service->start());
   ASSERT_NO_THROW(session->processRequest(request, session));
+  context->run();
 }
@@ -0,0 +1,105 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/response_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+
+using kagome::api::ResponseCache;
+using kagome::common::Buffer;
+
+class ResponseCacheTest : public testing::Test {
+ public:
+  static constexpr auto kMethod = "state_getStorage";
+
+  /// @return size of the entry of \param params and \param result
+  static size_t entrySize(const Buffer &params, const Buffer &result) {
+    return std::string_view(kMethod).size() + 1 + 32 + params.size()
+           + result.size();
+  }
+};
+
+/**
+ * @given cache
+ * @when results of the same method and params at different blocks are put
+ * @then each of them is returned for its block only
+ */
+TEST_F(ResponseCacheTest, ResultsArePinnedToBlock) {
+  ResponseCache cache{{}};
+  ASSERT_FALSE(cache.get(kMethod, "block1"_hash256, "key"_buf));
+
+  cache.put(kMethod, "block1"_hash256, "key"_buf, "value1"_buf);
+  cache.put(kMethod, "block2"_hash256, "key"_buf, "value2"_buf);
+
+  ASSERT_EQ(cache.get(kMethod, "block1"_hash256, "key"_buf), "value1"_buf);
+  ASSERT_EQ(cache.get(kMethod, "block2"_hash256, "key"_buf), "value2"_buf);
+  ASSERT_FALSE(cache.get(kMethod, "block1"_hash256, "key2"_buf));
+  ASSERT_FALSE(cache.get("other_method", "block1"_hash256, "key"_buf));
+}
+
+/**
+ * @given cache, which fits two results
+ * @when the first one is used and the third one is put
+ * @then the least recently used second one is evicted
+ */
+TEST_F(ResponseCacheTest, LeastRecentlyUsedIsEvicted) {
+  ResponseCache cache{{.max_size = 2 * entrySize("key1"_buf, "value1"_buf)}};
+  cache.put(kMethod, "block"_hash256, "key1"_buf, "value1"_buf);
+  cache.put(kMethod, "block"_hash256, "key2"_buf, "value2"_buf);
+  ASSERT_TRUE(cache.get(kMethod, "block"_hash256, "key1"_buf));
+
+  cache.put(kMethod, "block"_hash256, "key3"_buf, "value3"_buf);
+
+  ASSERT_TRUE(cache.get(kMethod, "block"_hash256, "key1"_buf));
+  ASSERT_FALSE(cache.get(kMethod, "block"_hash256, "key2"_buf));
+  ASSERT_TRUE(cache.get(kMethod, "block"_hash256, "key3"_buf));
+  ASSERT_EQ(cache.size(), 2 * entrySize("key1"_buf, "value1"_buf));
+
+  // a result larger than the cache does not evict the others
+  cache.put(kMethod, "block"_hash256, "key4"_buf, Buffer(cache.size(), 0));
+  ASSERT_FALSE(cache.get(kMethod, "block"_hash256, "key4"_buf));
+  ASSERT_TRUE(cache.get(kMethod, "block"_hash256, "key1"_buf));
+}
+
+/**
+ * @given cache with results at two blocks
+ * @when one of the blocks is pruned
+ * @then only its results are dropped
+ */
+TEST_F(ResponseCacheTest, PrunedBlockIsDropped) {
+  ResponseCache cache{{}};
+  cache.put(kMethod, "block1"_hash256, "key"_buf, "value1"_buf);
+  cache.put(kMethod, "block1"_hash256, "key2"_buf, "value1"_buf);
+  cache.put(kMethod, "block2"_hash256, "key"_buf, "value2"_buf);
+
+  cache.onBlockPruned({1, "block1"_hash256});
+  cache.onBlockPruned({1, "block3"_hash256});
+
+  ASSERT_FALSE(cache.get(kMethod, "block1"_hash256, "key"_buf));
+  ASSERT_FALSE(cache.get(kMethod, "block1"_hash256, "key2"_buf));
+  ASSERT_EQ(cache.get(kMethod, "block2"_hash256, "key"_buf), "value2"_buf);
+  ASSERT_EQ(cache.size(), entrySize("key"_buf, "value2"_buf));
+}
+
+/**
+ * @given cache, which fits two results, with results at a block
+ * @when one of them is evicted, and then the block is pruned
+ * @then the rest of its results are dropped
+ */
+TEST_F(ResponseCacheTest, PrunedBlockIsDroppedAfterEviction) {
+  ResponseCache cache{{.max_size = 2 * entrySize("key1"_buf, "value1"_buf)}};
+  cache.put(kMethod, "block1"_hash256, "key1"_buf, "value1"_buf);
+  cache.put(kMethod, "block1"_hash256, "key2"_buf, "value2"_buf);
+  cache.put(kMethod, "block2"_hash256, "key3"_buf, "value3"_buf);
+  ASSERT_FALSE(cache.get(kMethod, "block1"_hash256, "key1"_buf));
+
+  cache.onBlockPruned({1, "block1"_hash256});
+
+  ASSERT_FALSE(cache.get(kMethod, "block1"_hash256, "key2"_buf));
+  ASSERT_TRUE(cache.get(kMethod, "block2"_hash256, "key3"_buf));
+  ASSERT_EQ(cache.size(), entrySize("key3"_buf, "value3"_buf));
+}
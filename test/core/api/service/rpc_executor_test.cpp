@@ -0,0 +1,106 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/service/rpc_executor.hpp"
+
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using kagome::api::RpcExecutor;
+
+class RpcExecutorTest : public testing::Test {
+ public:
+  static constexpr auto kRead = "state_getStorage";
+  static constexpr auto kWrite = "author_submitExtrinsic";
+
+  std::shared_ptr<RpcExecutor> makeExecutor(RpcExecutor::Params params) {
+    return std::make_shared<RpcExecutor>(context_, std::move(params));
+  }
+
+  std::shared_ptr<boost::asio::io_context> context_ =
+      std::make_shared<boost::asio::io_context>();
+};
+
+/**
+ * @given executor, which allows a single request on the main thread
+ * @when two requests of a method, which is not a snapshot read, are executed
+ * @then they are run on the main io_context one after another
+ */
+TEST_F(RpcExecutorTest, MainThreadRequestsAreSerialized) {
+  auto executor = makeExecutor(RpcExecutor::Params{});
+  std::vector<std::thread::id> threads;
+  for (auto i = 0; i < 2; ++i) {
+    ASSERT_TRUE(executor->execute(
+        kWrite, [&] { threads.push_back(std::this_thread::get_id()); }));
+  }
+
+  auto metrics = executor->getMetrics();
+  ASSERT_EQ(metrics.running_on_main_thread, 1);
+  ASSERT_EQ(metrics.queue_size, 1);
+  ASSERT_EQ(metrics.queued_by_method[kWrite], 1);
+
+  context_->run();
+  ASSERT_EQ(threads,
+            std::vector<std::thread::id>(2, std::this_thread::get_id()));
+  metrics = executor->getMetrics();
+  ASSERT_EQ(metrics.queue_size, 0);
+  ASSERT_EQ(metrics.max_queue_size, 1);
+  ASSERT_EQ(metrics.completed, 2);
+}
+
+/**
+ * @given executor with a queue of a single request
+ * @when the main thread is busy and two more requests arrive
+ * @then the last one is rejected
+ */
+TEST_F(RpcExecutorTest, RequestsOverQueueSizeAreRejected) {
+  RpcExecutor::Params params;
+  params.max_queue_size = 1;
+  auto executor = makeExecutor(params);
+
+  ASSERT_TRUE(executor->execute(kWrite, [] {}));
+  ASSERT_TRUE(executor->execute(kWrite, [] {}));
+  ASSERT_FALSE(executor->execute(kWrite, [] {}));
+  ASSERT_EQ(executor->getMetrics().rejected, 1);
+
+  context_->run();
+  ASSERT_EQ(executor->getMetrics().completed, 2);
+}
+
+/**
+ * @given executor, which allows a single snapshot read at once
+ * @when the read is running and a read and a request of another method arrive
+ * @then the read waits, while the other request is executed on the main
+ * thread at once
+ */
+TEST_F(RpcExecutorTest, MethodLimitIsRespected) {
+  RpcExecutor::Params params;
+  params.method_limits[kRead] = 1;
+  auto executor = makeExecutor(params);
+
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::promise<std::thread::id> first_read;
+  std::promise<void> second_read;
+  ASSERT_TRUE(executor->execute(kRead, [&, released] {
+    first_read.set_value(std::this_thread::get_id());
+    released.wait();
+  }));
+  ASSERT_NE(first_read.get_future().get(), std::this_thread::get_id());
+
+  ASSERT_TRUE(executor->execute(kRead, [&] { second_read.set_value(); }));
+  ASSERT_TRUE(executor->execute(kWrite, [] {}));
+  context_->run();
+
+  auto metrics = executor->getMetrics();
+  ASSERT_EQ(metrics.queue_size, 1);
+  ASSERT_EQ(metrics.running_on_workers, 1);
+  ASSERT_EQ(metrics.completed, 1);
+
+  release.set_value();
+  second_read.get_future().wait();
+}
@@ -22,6 +22,7 @@ using kagome::primitives::BlockHeader;
 using kagome::primitives::BlockInfo;
 using kagome::storage::trie::TrieDbMock;
 using kagome::storage::trie::TrieDbReader;
+using testing::_;
 using testing::Return;
 
 /**
@@ -77,3 +78,40 @@ TEST(StateApiTest, GetStorage) {
   EXPECT_OUTCOME_TRUE(r1, api.getStorage("a"_buf, "B"_hash256));
   ASSERT_EQ(r1, "1"_buf);
 }
+
+/**
+ * @given state api
+ * @when get storage values of several keys (and optionally at a block)
+ * @then they are read at once from the trie at the state root of the block
+ */
+TEST(StateApiTest, QueryStorageAt) {
+  auto builder = std::make_shared<TrieMockBuilder>();
+  auto block_header_repo = std::make_shared<HeaderRepositoryMock>();
+  auto block_tree = std::make_shared<BlockTreeMock>();
+
+  kagome::api::StateApiImpl api{block_header_repo, builder, block_tree};
+  std::vector<Buffer> keys{"a"_buf, "b"_buf};
+  std::vector<boost::optional<Buffer>> values{"1"_buf, boost::none};
+
+  EXPECT_CALL(*block_tree, getLastFinalized())
+      .WillOnce(testing::Return(BlockInfo(42, "D"_hash256)));
+  kagome::primitives::BlockId did = "D"_hash256;
+  EXPECT_CALL(*block_header_repo, getBlockHeader(did))
+      .WillOnce(testing::Return(BlockHeader{.state_root = "CDE"_hash256}));
+  EXPECT_CALL(*builder->next_trie, getMany(_))
+      .WillOnce(testing::Return(values));
+
+  EXPECT_OUTCOME_TRUE(r, api.queryStorageAt(keys, boost::none));
+  ASSERT_EQ(r.block, "D"_hash256);
+  ASSERT_EQ(r.values, values);
+
+  kagome::primitives::BlockId bid = "B"_hash256;
+  EXPECT_CALL(*block_header_repo, getBlockHeader(bid))
+      .WillOnce(testing::Return(BlockHeader{.state_root = "ABC"_hash256}));
+  EXPECT_CALL(*builder->next_trie, getMany(_))
+      .WillOnce(testing::Return(values));
+
+  EXPECT_OUTCOME_TRUE(r1, api.queryStorageAt(keys, "B"_hash256));
+  ASSERT_EQ(r1.block, "B"_hash256);
+  ASSERT_EQ(r1.values, values);
+}
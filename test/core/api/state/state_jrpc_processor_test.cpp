@@ -13,8 +13,10 @@
 
 using kagome::api::JRpcServer;
 using kagome::api::JRpcServerMock;
+using kagome::api::ResponseCache;
 using kagome::api::StateApiMock;
 using kagome::api::StateJrpcProcessor;
+using kagome::api::StateApi;
 using kagome::common::Buffer;
 using testing::_;
 
@@ -22,18 +24,24 @@ class StateJrpcProcessorTest : public testing::Test {
  public:
   void SetUp() override {}
 
-  auto registerHandlers() {
+  /// @return handler of \param method
+  auto registerHandlers(const std::string &method = "state_getStorage") {
     JRpcServer::Method action;
-    EXPECT_CALL(*server, registerHandler("state_getStorage", _))
-        .WillOnce(
-            testing::Invoke([&action](auto &name, auto &&f) { action = f; }));
+    EXPECT_CALL(*server, registerHandler(_, _))
+        .WillRepeatedly(testing::Invoke([&](auto &name, auto &&f) {
+          if (name == method) {
+            action = f;
+          }
+        }));
     processor.registerHandlers();
     return action;
   }
 
   std::shared_ptr<StateApiMock> state_api = std::make_shared<StateApiMock>();
   std::shared_ptr<JRpcServerMock> server = std::make_shared<JRpcServerMock>();
-  StateJrpcProcessor processor{server, state_api};
+  std::shared_ptr<ResponseCache> cache =
+      std::make_shared<ResponseCache>(ResponseCache::Configuration{});
+  StateJrpcProcessor processor{server, state_api, cache};
 };
 
 /**
@@ -48,13 +56,8 @@ TEST_F(StateJrpcProcessorTest, ProcessRequest) {
   auto action = registerHandlers();
 
   jsonrpc::Request::Parameters params{"0x01234567"};
-  auto result = action(params).AsArray();
-  std::vector<uint8_t> vec_result(result.size());
-  std::transform(result.begin(), result.end(), vec_result.begin(), [](jsonrpc::Value& v) {
-    return v.AsInteger32();
-  });
-  std::vector<uint8_t> expected_result {171,205,239};
-  ASSERT_THAT(expected_result, testing::ContainerEq(vec_result));
+  auto result = action(params).AsString();
+  ASSERT_EQ(result, "0xabcdef");
 }
 
 /**
@@ -71,13 +74,26 @@ TEST_F(StateJrpcProcessorTest, ProcessAnotherRequest) {
 
   jsonrpc::Request::Parameters params{"0x01234567",
                                       "0x" + ("010203"_hash256).toHex()};
-  auto result = action(params).AsArray();
-  std::vector<uint8_t> vec_result(result.size());
-  std::transform(result.begin(), result.end(), vec_result.begin(), [](jsonrpc::Value& v) {
-    return v.AsInteger32();
-  });
-  std::vector<uint8_t> expected_result {171,205,239};
-  ASSERT_THAT(expected_result, testing::ContainerEq(vec_result));
+  auto result = action(params).AsString();
+  ASSERT_EQ(result, "0xabcdef");
+}
+
+/**
+ * @given a request of state_getStorage at a block
+ * @when processing it twice
+ * @then the storage is read once, the second response is cached
+ */
+TEST_F(StateJrpcProcessorTest, RequestAtBlockIsCached) {
+  EXPECT_CALL(*state_api,
+              getStorage(Buffer::fromHex("01234567").value(), "010203"_hash256))
+      .WillOnce(testing::Return(Buffer::fromHex("ABCDEF").value()));
+
+  auto action = registerHandlers();
+
+  jsonrpc::Request::Parameters params{"0x01234567",
+                                      "0x" + ("010203"_hash256).toHex()};
+  ASSERT_EQ(action(params).AsString(), "0xabcdef");
+  ASSERT_EQ(action(params).AsString(), "0xabcdef");
 }
 
 /**
@@ -92,5 +108,36 @@ TEST_F(StateJrpcProcessorTest, InvalidParams) {
   jsonrpc::Request::Parameters params;
   params.push_back(jsonrpc::Value{0});
   params.push_back(0);
-  ASSERT_THROW(action(params).AsArray(), jsonrpc::InvalidParametersFault);
+  ASSERT_THROW(action(params).AsString(), jsonrpc::InvalidParametersFault);
+}
+
+/**
+ * @given a request of state_queryStorageAt with several keys at a block
+ * @when processing it
+ * @then values of the keys at the block are returned in their order, absent
+ * ones are nulls
+ */
+TEST_F(StateJrpcProcessorTest, QueryStorageAt) {
+  std::vector<Buffer> keys{"0102"_hex2buf, "0304"_hex2buf};
+  EXPECT_CALL(*state_api,
+              queryStorageAt(keys, boost::make_optional("010203"_hash256)))
+      .WillOnce(testing::Return(StateApi::StorageValues{
+          "010203"_hash256, {"ABCDEF"_hex2buf, boost::none}}));
+
+  auto action = registerHandlers("state_queryStorageAt");
+
+  jsonrpc::Request::Parameters params{
+      jsonrpc::Value::Array{"0x0102", "0x0304"},
+      "0x" + ("010203"_hash256).toHex()};
+  auto result = action(params).AsArray();
+  ASSERT_EQ(result.size(), 1);
+  auto &change_set = result[0].AsStruct();
+  ASSERT_EQ(change_set.at("block").AsString(),
+            "0x" + ("010203"_hash256).toHex());
+  auto &changes = change_set.at("changes").AsArray();
+  ASSERT_EQ(changes.size(), 2);
+  ASSERT_EQ(changes[0].AsArray()[0].AsString(), "0x0102");
+  ASSERT_EQ(changes[0].AsArray()[1].AsString(), "0xabcdef");
+  ASSERT_EQ(changes[1].AsArray()[0].AsString(), "0x0304");
+  ASSERT_TRUE(changes[1].AsArray()[1].IsNil());
 }
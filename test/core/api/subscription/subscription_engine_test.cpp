@@ -0,0 +1,290 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/subscription/subscription_engine.hpp"
+
+#include <condition_variable>
+#include <future>
+#include <map>
+
+#include <gtest/gtest.h>
+
+#include "common/hexutil.hpp"
+#include "mock/core/api/transport/session_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/blockchain/header_repository_mock.hpp"
+#include "mock/core/storage/trie/trie_db_mock.hpp"
+#include "testutil/literals.hpp"
+
+using kagome::api::ReadonlyTrieBuilder;
+using kagome::api::SessionMock;
+using kagome::api::SubscriptionEngine;
+using kagome::blockchain::BlockTreeMock;
+using kagome::blockchain::HeaderRepositoryMock;
+using kagome::common::Buffer;
+using kagome::common::Hash256;
+using kagome::common::hex_lower_0x;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockId;
+using kagome::primitives::BlockInfo;
+using kagome::storage::trie::TrieDbMock;
+using kagome::storage::trie::TrieDbReader;
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+/**
+ * Builds tries over the given states and counts the reads of them
+ */
+class TrieBuilderFake : public ReadonlyTrieBuilder {
+ public:
+  std::unique_ptr<TrieDbReader> buildAt(BlockHash state_root) const override {
+    auto trie = std::make_unique<TrieDbMock>();
+    EXPECT_CALL(*trie, get(_))
+        .WillRepeatedly(Invoke([this, state_root](const Buffer &key)
+                                   -> outcome::result<Buffer> {
+          ++reads;
+          auto &state = states.at(state_root);
+          if (auto value = state.find(key); value != state.end()) {
+            return value->second;
+          }
+          return std::make_error_code(std::errc::invalid_argument);
+        }));
+    return trie;
+  }
+
+  std::map<Hash256, std::unordered_map<Buffer, Buffer>> states;
+  mutable std::atomic<size_t> reads{0};
+};
+
+/**
+ * Session, which collects the pushed messages
+ */
+class PushedSession : public SessionMock {
+ public:
+  PushedSession() {
+    ON_CALL(*this, isPushSupported()).WillByDefault(Return(true));
+    EXPECT_CALL(*this, push(_))
+        .WillRepeatedly(Invoke([this](std::string_view message) {
+          std::lock_guard lock{mutex_};
+          messages_.emplace_back(message);
+          pushed_.notify_all();
+        }));
+  }
+
+  /// @return the first \param count pushed messages
+  std::vector<std::string> waitFor(size_t count) {
+    std::unique_lock lock{mutex_};
+    pushed_.wait(lock, [&] { return messages_.size() >= count; });
+    return messages_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable pushed_;
+  std::vector<std::string> messages_;
+};
+
+class SubscriptionEngineTest : public testing::Test {
+ public:
+  void SetUp() override {
+    EXPECT_CALL(*block_tree_, getLastFinalized())
+        .WillRepeatedly(Return(BlockInfo{0, "genesis"_hash256}));
+    addBlock(0, "genesis"_hash256, "root0"_hash256);
+  }
+
+  /// Add header of \param hash, which has \param number, \param
+  /// state_root and \param parent, to the repository
+  void addBlock(size_t number,
+                const BlockHash &hash,
+                const Hash256 &root,
+                const BlockHash &parent = {}) {
+    EXPECT_CALL(*header_repo_, getBlockHeader(BlockId{hash}))
+        .WillRepeatedly(Return(BlockHeader{
+            .parent_hash = parent, .number = number, .state_root = root}));
+  }
+
+  /// Notify the engine of \param block, which is the best one, if \param
+  /// is_best
+  void notifyAdded(const BlockInfo &block, bool is_best = true) {
+    EXPECT_CALL(*block_tree_, deepestLeaf())
+        .WillRepeatedly(
+            Return(is_best ? block : BlockInfo{0, "other"_hash256}));
+    engine_->onBlockAdded(block);
+  }
+
+  std::shared_ptr<HeaderRepositoryMock> header_repo_ =
+      std::make_shared<HeaderRepositoryMock>();
+  std::shared_ptr<BlockTreeMock> block_tree_ =
+      std::make_shared<BlockTreeMock>();
+  std::shared_ptr<TrieBuilderFake> trie_builder_ =
+      std::make_shared<TrieBuilderFake>();
+  std::shared_ptr<SubscriptionEngine> engine_ =
+      std::make_shared<SubscriptionEngine>(
+          header_repo_, block_tree_, trie_builder_);
+};
+
+/**
+ * @given session subscribed to new and finalized heads
+ * @when a block is added and finalized
+ * @then its header is pushed for both subscriptions
+ */
+TEST_F(SubscriptionEngineTest, HeadsArePushed) {
+  auto session = std::make_shared<PushedSession>();
+  auto new_heads = engine_->generateId();
+  auto finalized_heads = engine_->generateId();
+  engine_->subscribeHeads(
+      new_heads, SubscriptionEngine::Kind::NEW_HEADS, session);
+  engine_->subscribeHeads(
+      finalized_heads, SubscriptionEngine::Kind::FINALIZED_HEADS, session);
+
+  addBlock(26, "block1"_hash256, "root0"_hash256);
+  notifyAdded({26, "block1"_hash256});
+  engine_->onBlockFinalized({26, "block1"_hash256});
+
+  auto messages = session->waitFor(2);
+  auto new_head = R"({"jsonrpc":"2.0","method":"chain_newHead",)"
+                  R"("params":{"subscription":)"
+                  + std::to_string(new_heads) + R"(,"result":{"parentHash":)";
+  auto finalized_head = R"({"jsonrpc":"2.0","method":"chain_finalizedHead",)"
+                        R"("params":{"subscription":)"
+                        + std::to_string(finalized_heads)
+                        + R"(,"result":{"parentHash":)";
+  ASSERT_EQ(messages[0].rfind(new_head, 0), 0);
+  ASSERT_NE(messages[0].find(R"("number":"0x1a")"), std::string::npos);
+  ASSERT_EQ(messages[1].rfind(finalized_head, 0), 0);
+}
+
+/**
+ * @given two sessions, which watch the same key
+ * @when blocks change the value of the key, keep and remove it
+ * @then the current value and then the changes are pushed to both sessions,
+ * the key is read once per block
+ */
+TEST_F(SubscriptionEngineTest, StorageChangesAreReadOncePerBlock) {
+  trie_builder_->states["root0"_hash256] = {{"a"_buf, "1"_buf}};
+  trie_builder_->states["root1"_hash256] = {{"a"_buf, "2"_buf}};
+  trie_builder_->states["root2"_hash256] = {{"a"_buf, "2"_buf}};
+  trie_builder_->states["root3"_hash256] = {};
+  addBlock(1, "block1"_hash256, "root1"_hash256, "genesis"_hash256);
+  addBlock(2, "block2"_hash256, "root2"_hash256, "block1"_hash256);
+  addBlock(3, "block3"_hash256, "root3"_hash256, "block2"_hash256);
+
+  std::vector<std::shared_ptr<PushedSession>> sessions{
+      std::make_shared<PushedSession>(), std::make_shared<PushedSession>()};
+  for (auto &session : sessions) {
+    engine_->subscribeStorage(engine_->generateId(), session, {"a"_buf});
+    session->waitFor(1);
+  }
+
+  notifyAdded({1, "block1"_hash256});
+  notifyAdded({2, "block2"_hash256});
+  notifyAdded({3, "block3"_hash256});
+
+  for (auto &session : sessions) {
+    auto messages = session->waitFor(3);
+    ASSERT_EQ(messages.size(), 3);
+    ASSERT_NE(messages[0].find(R"(["0x61","0x31"])"), std::string::npos);
+    ASSERT_NE(messages[1].find(R"(["0x61","0x32"])"), std::string::npos);
+    ASSERT_NE(messages[2].find(R"(["0x61",null])"), std::string::npos);
+  }
+  // one read per subscription for the current value, one per block then
+  ASSERT_EQ(trie_builder_->reads, 5);
+}
+
+/**
+ * @given session, which watches a key
+ * @when a block of a fork, which is not the best one, changes the key, then
+ * the fork becomes the best one
+ * @then changes of the best blocks are pushed, each compared with the
+ * parent of the block
+ */
+TEST_F(SubscriptionEngineTest, StorageChangesArePushedForBestChain) {
+  trie_builder_->states["root0"_hash256] = {{"a"_buf, "1"_buf}};
+  trie_builder_->states["root1"_hash256] = {{"a"_buf, "2"_buf}};
+  trie_builder_->states["root1b"_hash256] = {{"a"_buf, "5"_buf}};
+  trie_builder_->states["root3b"_hash256] = {{"a"_buf, "6"_buf}};
+  addBlock(1, "block1"_hash256, "root1"_hash256, "genesis"_hash256);
+  addBlock(1, "block1b"_hash256, "root1b"_hash256, "genesis"_hash256);
+  addBlock(2, "block2b"_hash256, "root1b"_hash256, "block1b"_hash256);
+  addBlock(3, "block3b"_hash256, "root3b"_hash256, "block2b"_hash256);
+
+  auto session = std::make_shared<PushedSession>();
+  engine_->subscribeStorage(engine_->generateId(), session, {"a"_buf});
+  session->waitFor(1);
+
+  notifyAdded({1, "block1"_hash256});
+  notifyAdded({1, "block1b"_hash256}, false);
+  notifyAdded({2, "block2b"_hash256});
+  notifyAdded({3, "block3b"_hash256});
+
+  auto messages = session->waitFor(3);
+  ASSERT_EQ(messages.size(), 3);
+  ASSERT_NE(messages[0].find(R"(["0x61","0x31"])"), std::string::npos);
+  ASSERT_NE(messages[1].find(R"(["0x61","0x32"])"), std::string::npos);
+  ASSERT_NE(messages[2].find(R"(["0x61","0x36"])"), std::string::npos);
+  ASSERT_NE(messages[2].find(hex_lower_0x("block3b"_hash256)),
+            std::string::npos);
+}
+
+/**
+ * @given block, which is being processed
+ * @when a session subscribes to a key meanwhile
+ * @then the value of the key at the block is pushed first, then its changes
+ * in the next blocks
+ */
+TEST_F(SubscriptionEngineTest, CurrentValueIsPushedBeforeChanges) {
+  trie_builder_->states["root0"_hash256] = {};
+  trie_builder_->states["root1"_hash256] = {{"a"_buf, "1"_buf}};
+  trie_builder_->states["root2"_hash256] = {{"a"_buf, "3"_buf}};
+  addBlock(2, "block2"_hash256, "root2"_hash256, "block1"_hash256);
+
+  // processing of the first block waits for the subscription
+  std::promise<void> subscribed;
+  auto subscribed_future = subscribed.get_future().share();
+  EXPECT_CALL(*header_repo_, getBlockHeader(BlockId{"block1"_hash256}))
+      .WillRepeatedly(Invoke([subscribed_future](const BlockId &) {
+        subscribed_future.wait();
+        return BlockHeader{.parent_hash = "genesis"_hash256,
+                           .number = 1,
+                           .state_root = "root1"_hash256};
+      }));
+
+  auto session = std::make_shared<PushedSession>();
+  notifyAdded({1, "block1"_hash256});
+  engine_->subscribeStorage(engine_->generateId(), session, {"a"_buf});
+  subscribed.set_value();
+  notifyAdded({2, "block2"_hash256});
+
+  auto messages = session->waitFor(2);
+  ASSERT_EQ(messages.size(), 2);
+  ASSERT_NE(messages[0].find(hex_lower_0x("block1"_hash256)),
+            std::string::npos);
+  ASSERT_NE(messages[0].find(R"(["0x61","0x31"])"), std::string::npos);
+  ASSERT_NE(messages[1].find(R"(["0x61","0x33"])"), std::string::npos);
+}
+
+/**
+ * @given subscription of a session
+ * @when it is cancelled by another session, with another kind and by the
+ * session itself
+ * @then only the last attempt succeeds
+ */
+TEST_F(SubscriptionEngineTest, UnsubscribeBySubscriber) {
+  auto session = std::make_shared<PushedSession>();
+  auto other = std::make_shared<PushedSession>();
+  auto id = engine_->generateId();
+  engine_->subscribeHeads(id, SubscriptionEngine::Kind::NEW_HEADS, session);
+
+  ASSERT_FALSE(
+      engine_->unsubscribe(id, SubscriptionEngine::Kind::NEW_HEADS, other));
+  ASSERT_FALSE(engine_->unsubscribe(
+      id, SubscriptionEngine::Kind::FINALIZED_HEADS, session));
+  ASSERT_TRUE(
+      engine_->unsubscribe(id, SubscriptionEngine::Kind::NEW_HEADS, session));
+  ASSERT_FALSE(
+      engine_->unsubscribe(id, SubscriptionEngine::Kind::NEW_HEADS, session));
+}
@@ -0,0 +1,45 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/transport/impl/connection_limiter.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock/core/api/transport/session_mock.hpp"
+
+using boost::asio::ip::address;
+using kagome::api::ConnectionLimiter;
+using kagome::api::SessionMock;
+
+/**
+ * @given limiter of 3 connections, 2 of them from one address
+ * @when connections are added from two addresses
+ * @then connections over the limits are not accepted until sessions of the
+ * previous ones are destroyed
+ */
+TEST(ConnectionLimiterTest, LimitsConnections) {
+  ConnectionLimiter limiter{{.max_connections = 3,
+                             .max_connections_per_address = 2}};
+  auto first = address::from_string("10.0.0.1");
+  auto second = address::from_string("10.0.0.2");
+  std::vector<std::shared_ptr<SessionMock>> sessions;
+  auto add = [&](const address &from) {
+    sessions.push_back(std::make_shared<SessionMock>());
+    limiter.add(from, sessions.back());
+  };
+
+  ASSERT_TRUE(limiter.canAccept(first));
+  add(first);
+  add(first);
+  ASSERT_FALSE(limiter.canAccept(first));
+  ASSERT_TRUE(limiter.canAccept(second));
+  add(second);
+  ASSERT_FALSE(limiter.canAccept(second));
+
+  // the first connection is closed
+  sessions.erase(sessions.begin());
+  ASSERT_TRUE(limiter.canAccept(first));
+  ASSERT_TRUE(limiter.canAccept(second));
+}
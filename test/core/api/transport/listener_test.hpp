@@ -24,6 +24,7 @@ using kagome::api::JrpcProcessorStub;
 using kagome::api::JRpcServer;
 using kagome::api::JRpcServerImpl;
 using kagome::api::Listener;
+using kagome::api::RpcExecutor;
 
 template <typename ListenerImpl,
           typename =
@@ -81,7 +82,10 @@ struct ListenerTest : public ::testing::Test {
           config)};
 
   sptr<ApiService> service = std::make_shared<ApiService>(
-      std::vector<std::shared_ptr<Listener>>(listeners), server, processors);
+      std::make_shared<RpcExecutor>(main_context, RpcExecutor::Params{}),
+      std::vector<std::shared_ptr<Listener>>(listeners),
+      server,
+      processors);
 };
 
 #endif  // KAGOME_TEST_CORE_API_TRANSPORT_LISTENER_TEST_HPP
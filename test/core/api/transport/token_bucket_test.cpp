@@ -0,0 +1,48 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/transport/impl/token_bucket.hpp"
+
+#include <gtest/gtest.h>
+
+using kagome::api::TokenBucket;
+using std::chrono_literals::operator""ms;
+
+/**
+ * @given bucket of 10 tokens per second with burst of 3
+ * @when tokens are taken at once and then over time
+ * @then the burst passes at once, then a token per 100 ms is added
+ */
+TEST(TokenBucketTest, BurstThenRate) {
+  auto now = TokenBucket::Clock::now();
+  TokenBucket bucket{10, 3, now};
+
+  for (auto i = 0; i < 3; ++i) {
+    ASSERT_TRUE(bucket.tryTake(now));
+  }
+  ASSERT_FALSE(bucket.tryTake(now));
+  ASSERT_FALSE(bucket.tryTake(now + 50ms));
+  ASSERT_TRUE(bucket.tryTake(now + 100ms));
+  ASSERT_FALSE(bucket.tryTake(now + 100ms));
+
+  // the bucket is not filled over the burst
+  now += 10000ms;
+  for (auto i = 0; i < 3; ++i) {
+    ASSERT_TRUE(bucket.tryTake(now));
+  }
+  ASSERT_FALSE(bucket.tryTake(now));
+}
+
+/**
+ * @given bucket with zero rate
+ * @when many tokens are taken at once
+ * @then all of them are taken
+ */
+TEST(TokenBucketTest, ZeroRateIsUnlimited) {
+  TokenBucket bucket{0, 0};
+  for (auto i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(bucket.tryTake());
+  }
+}
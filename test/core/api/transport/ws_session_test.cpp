@@ -0,0 +1,243 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "api/transport/impl/ws/ws_session.hpp"
+
+#include <future>
+#include <thread>
+
+#include <boost/beast/core/buffers_to_string.hpp>
+#include <gtest/gtest.h>
+
+using kagome::api::Session;
+using kagome::api::WsSession;
+
+namespace beast = boost::beast;
+using Endpoint = boost::asio::ip::tcp::endpoint;
+
+class WsSessionTest : public testing::Test {
+ public:
+  void SetUp() override {
+    endpoint_ = acceptor_.local_endpoint();
+  }
+
+  void TearDown() override {
+    if (client_.joinable()) {
+      client_.join();
+    }
+  }
+
+  /// Connect client, which writes \param requests at once and then reads
+  /// the same number of responses
+  std::future<std::vector<std::string>> startClient(
+      std::vector<std::string> requests) {
+    std::promise<std::vector<std::string>> promise;
+    auto responses = promise.get_future();
+    client_ = std::thread([this,
+                           requests = std::move(requests),
+                           promise = std::move(promise)]() mutable {
+      boost::asio::io_context context;
+      beast::websocket::stream<boost::asio::ip::tcp::socket> ws{context};
+      ws.next_layer().connect(endpoint_);
+      ws.handshake("127.0.0.1", "/");
+      for (auto &request : requests) {
+        ws.write(boost::asio::buffer(request));
+      }
+      std::vector<std::string> received;
+      for (size_t i = 0; i < requests.size(); ++i) {
+        beast::flat_buffer buffer;
+        ws.read(buffer);
+        received.push_back(beast::buffers_to_string(buffer.data()));
+      }
+      ws.close(beast::websocket::close_code::normal);
+      promise.set_value(std::move(received));
+    });
+    return responses;
+  }
+
+  /// Accept the client by a session, which collects its requests
+  std::shared_ptr<WsSession> acceptSession(WsSession::Configuration config) {
+    auto session =
+        std::make_shared<WsSession>(acceptor_.accept(), std::move(config));
+    session->connectOnRequest(
+        [this](std::string_view request, std::shared_ptr<Session> session) {
+          requests_.emplace_back(request);
+          sessions_.push_back(std::move(session));
+        });
+    session->start();
+    return session;
+  }
+
+  /// Run the context until \param condition holds or \param timeout passes
+  bool runUntil(const std::function<bool()> &condition,
+                std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (not condition() and std::chrono::steady_clock::now() < deadline) {
+      context_.restart();
+      context_.run_for(std::chrono::milliseconds(10));
+    }
+    return condition();
+  }
+
+  boost::asio::io_context context_;
+  boost::asio::ip::tcp::acceptor acceptor_{
+      context_, {boost::asio::ip::address::from_string("127.0.0.1"), 0}};
+  Endpoint endpoint_;
+  std::thread client_;
+
+  std::vector<std::string> requests_;
+  std::vector<std::shared_ptr<Session>> sessions_;
+};
+
+/**
+ * @given session, which processes two requests at once
+ * @when client sends three requests without waiting for responses
+ * @then two of them are read at once, the third one is read when one of
+ * them is responded, responses are written in the order of completion
+ */
+TEST_F(WsSessionTest, RequestsArePipelinedUpToLimit) {
+  auto responses = startClient({"1", "2", "3"});
+  WsSession::Configuration config;
+  config.max_in_flight = 2;
+  auto session = acceptSession(config);
+
+  ASSERT_TRUE(runUntil([&] { return requests_.size() == 2; }));
+  ASSERT_FALSE(runUntil([&] { return requests_.size() > 2; },
+                        std::chrono::milliseconds(100)));
+
+  sessions_[1]->respond("second");
+  ASSERT_TRUE(runUntil([&] { return requests_.size() == 3; }));
+  ASSERT_EQ(requests_, (std::vector<std::string>{"1", "2", "3"}));
+
+  sessions_[2]->respond("third");
+  sessions_[0]->respond("first");
+  ASSERT_TRUE(runUntil([&] {
+    return responses.wait_for(std::chrono::seconds(0))
+           == std::future_status::ready;
+  }));
+  ASSERT_EQ(responses.get(),
+            (std::vector<std::string>{"second", "third", "first"}));
+}
+
+/**
+ * @given session, which allows two requests at once and then a request per
+ * many seconds
+ * @when client sends three requests at once
+ * @then two of them are processed, then the session is closed with the
+ * reason to try again later
+ */
+TEST_F(WsSessionTest, SessionIsClosedOverRequestRate) {
+  std::promise<beast::websocket::close_reason> promise;
+  auto closed = promise.get_future();
+  client_ = std::thread([this, promise = std::move(promise)]() mutable {
+    boost::asio::io_context context;
+    beast::websocket::stream<boost::asio::ip::tcp::socket> ws{context};
+    ws.next_layer().connect(endpoint_);
+    ws.handshake("127.0.0.1", "/");
+    for (std::string request : {"1", "2", "3"}) {
+      ws.write(boost::asio::buffer(request));
+    }
+    // requests are not responded, so the read is completed by the close
+    beast::flat_buffer buffer;
+    boost::system::error_code ec;
+    ws.read(buffer, ec);
+    promise.set_value(ws.reason());
+  });
+  WsSession::Configuration config;
+  config.max_request_rate = 0.001;
+  config.max_request_burst = 2;
+  auto session = acceptSession(config);
+
+  ASSERT_TRUE(runUntil([&] {
+    return closed.wait_for(std::chrono::seconds(0))
+           == std::future_status::ready;
+  }));
+  ASSERT_EQ(requests_, (std::vector<std::string>{"1", "2"}));
+  ASSERT_EQ(closed.get().code, beast::websocket::close_code::try_again_later);
+}
+
+/**
+ * @given session, which queues up to a few megabytes for the client
+ * @when client sends a request and stops reading, while many messages are
+ * pushed to it
+ * @then the session is closed when the queue is over the limit without
+ * blocking the thread of the server and then it is destroyed
+ */
+TEST_F(WsSessionTest, SessionIsClosedWhenClientDoesNotRead) {
+  std::promise<void> done;
+  client_ = std::thread([this, done = done.get_future()] {
+    boost::asio::io_context context;
+    beast::websocket::stream<boost::asio::ip::tcp::socket> ws{context};
+    ws.next_layer().connect(endpoint_);
+    ws.handshake("127.0.0.1", "/");
+    ws.write(boost::asio::buffer(std::string("1")));
+    done.wait();
+  });
+  WsSession::Configuration config;
+  config.max_outgoing_size = 4u << 20u;
+  auto session = acceptSession(config);
+  ASSERT_TRUE(runUntil([&] { return requests_.size() == 1; }));
+  sessions_.clear();
+
+  std::weak_ptr<WsSession> weak = session;
+  for (auto i = 0; i < 64; ++i) {
+    session->push(std::string(1u << 20u, 'x'));
+  }
+  session.reset();
+
+  // the context is run by slices, so a blocked handler would hang here
+  auto expired = runUntil([&] { return weak.expired(); });
+  done.set_value();
+  ASSERT_TRUE(expired);
+}
+
+/**
+ * @given session, which allows two requests at once
+ * @when client sends three requests at once and then only reads the raw
+ * socket, never answering the close frame
+ * @then the close frame with the reason to try again later is sent and the
+ * connection is dropped after the operation timeout, the thread of the
+ * server is not blocked meanwhile
+ */
+TEST_F(WsSessionTest, ClientNotAnsweringCloseIsDisconnected) {
+  std::promise<std::string> promise;
+  auto received = promise.get_future();
+  client_ = std::thread([this, promise = std::move(promise)]() mutable {
+    boost::asio::io_context context;
+    beast::websocket::stream<boost::asio::ip::tcp::socket> ws{context};
+    ws.next_layer().connect(endpoint_);
+    ws.handshake("127.0.0.1", "/");
+    for (std::string request : {"1", "2", "3"}) {
+      ws.write(boost::asio::buffer(request));
+    }
+    // read until the server drops the connection
+    std::string bytes;
+    boost::system::error_code ec;
+    while (not ec) {
+      char buffer[256];
+      auto size = ws.next_layer().read_some(boost::asio::buffer(buffer), ec);
+      bytes.append(buffer, size);
+    }
+    promise.set_value(std::move(bytes));
+  });
+  WsSession::Configuration config;
+  config.max_request_rate = 0.001;
+  config.max_request_burst = 2;
+  config.operation_timeout = std::chrono::milliseconds(200);
+  auto session = acceptSession(config);
+  std::weak_ptr<WsSession> weak = session;
+  session.reset();
+
+  ASSERT_TRUE(runUntil([&] { return requests_.size() == 2; }));
+  sessions_.clear();
+  // the context is run by slices, so a blocked handler would hang here
+  ASSERT_TRUE(runUntil([&] {
+    return weak.expired()
+           and received.wait_for(std::chrono::seconds(0))
+                   == std::future_status::ready;
+  }));
+  // unmasked close frame with code 1013
+  ASSERT_EQ(received.get(), std::string("\x88\x02\x03\xF5"));
+}
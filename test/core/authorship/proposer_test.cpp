@@ -8,12 +8,14 @@
 #include <gtest/gtest.h>
 #include "mock/core/authorship/block_builder_factory_mock.hpp"
 #include "mock/core/authorship/block_builder_mock.hpp"
+#include "mock/core/clock/clock_mock.hpp"
 #include "mock/core/runtime/block_builder_api_mock.hpp"
 #include "mock/core/transaction_pool/transaction_pool_mock.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 
 using ::testing::_;
+using ::testing::ByMove;
 using ::testing::Return;
 using ::testing::Test;
 
@@ -21,6 +23,8 @@ using kagome::authorship::BlockBuilder;
 using kagome::authorship::BlockBuilderFactoryMock;
 using kagome::authorship::BlockBuilderMock;
 using kagome::authorship::ProposerImpl;
+using kagome::clock::SystemClock;
+using kagome::clock::SystemClockMock;
 using kagome::common::Buffer;
 using kagome::primitives::Block;
 using kagome::primitives::BlockId;
@@ -32,6 +36,8 @@ using kagome::primitives::InherentIdentifier;
 using kagome::primitives::PreRuntime;
 using kagome::primitives::Transaction;
 using kagome::runtime::BlockBuilderApiMock;
+using kagome::transaction_pool::ReadyIteratorMock;
+using kagome::transaction_pool::TransactionPool;
 using kagome::transaction_pool::TransactionPoolMock;
 
 // TODO (kamilsa): workaround unless we bump gtest version to 1.8.1+
@@ -51,6 +57,7 @@ class ProposerTest : public ::testing::Test {
    */
   void SetUp() override {
     ASSERT_TRUE(inherent_data_.putData(InherentIdentifier{}, Buffer{1, 2, 3}));
+    ON_CALL(*clock_, now()).WillByDefault(Return(now_));
 
     block_builder_ = new BlockBuilderMock();
     EXPECT_CALL(*block_builder_factory_,
@@ -61,6 +68,31 @@ class ProposerTest : public ::testing::Test {
         .WillOnce(Return(inherent_xts));
   }
 
+  /// @return transaction with extrinsic of \param size bytes
+  static std::shared_ptr<const Transaction> makeTx(
+      const Transaction::Hash &hash, size_t size = 3) {
+    auto tx = std::make_shared<Transaction>();
+    tx->hash = hash;
+    tx->ext = Extrinsic{Buffer(size, hash[31])};
+    return tx;
+  }
+
+  /// Make transaction pool return \param txs as the ready ones
+  void expectReadyTransactions(
+      const std::vector<std::shared_ptr<const Transaction>> &txs) {
+    auto iterator = std::make_unique<ReadyIteratorMock>();
+    auto &next = EXPECT_CALL(*iterator, next());
+    for (auto &tx : txs) {
+      next.WillOnce(Return(tx));
+    }
+    next.WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*iterator, skipDependents()).Times(testing::AnyNumber());
+    std::unique_ptr<TransactionPool::ReadyIterator> ready_iterator =
+        std::move(iterator);
+    EXPECT_CALL(*transaction_pool_, getReadyIterator())
+        .WillOnce(Return(ByMove(std::move(ready_iterator))));
+  }
+
  protected:
   std::shared_ptr<BlockBuilderFactoryMock> block_builder_factory_ =
       std::make_shared<BlockBuilderFactoryMock>();
@@ -71,8 +103,17 @@ class ProposerTest : public ::testing::Test {
 
   BlockBuilderMock *block_builder_;
 
-  ProposerImpl proposer_{
-      block_builder_factory_, transaction_pool_, block_builder_api_mock_};
+  std::shared_ptr<SystemClockMock> clock_ =
+      std::make_shared<testing::NiceMock<SystemClockMock>>();
+  SystemClock::TimePoint now_{};
+  SystemClock::TimePoint deadline_ = now_ + std::chrono::seconds(1);
+
+  ProposerImpl proposer_{block_builder_factory_,
+                         transaction_pool_,
+                         block_builder_api_mock_,
+                         clock_,
+                         ProposerImpl::Limits{.max_block_bytes = 100,
+                                              .max_skipped_transactions = 2}};
 
   BlockNumber expected_number_{42};
   BlockId expected_block_id_{expected_number_};
@@ -98,12 +139,10 @@ TEST_F(ProposerTest, CreateBlockSuccess) {
       .WillOnce(Return(outcome::success()))
       .WillOnce(Return(outcome::success()));
 
-  // getReadyTransaction will return vector with single transaction
-  std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready_transactions{
-      std::make_pair("fakeHash"_hash256, std::make_shared<Transaction>())};
-
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
+  // transaction pool will return single ready transaction
+  auto tx = std::make_shared<Transaction>();
+  tx->hash = "fakeHash"_hash256;
+  expectReadyTransactions({tx});
 
   EXPECT_CALL(*transaction_pool_, removeOne("fakeHash"_hash256))
       .WillOnce(Return(outcome::success()));
@@ -111,8 +150,8 @@ TEST_F(ProposerTest, CreateBlockSuccess) {
   EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
 
   // when
-  auto block_res =
-      proposer_.propose(expected_block_id_, inherent_data_, inherent_digests_);
+  auto block_res = proposer_.propose(
+      expected_block_id_, inherent_data_, inherent_digests_, deadline_);
 
   // then
   ASSERT_TRUE(block_res);
@@ -132,8 +171,8 @@ TEST_F(ProposerTest, CreateBlockFailsWhenXtNotPushed) {
       .WillOnce(Return(outcome::failure(boost::system::error_code{})));
 
   // when
-  auto block_res =
-      proposer_.propose(expected_block_id_, inherent_data_, inherent_digests_);
+  auto block_res = proposer_.propose(
+      expected_block_id_, inherent_data_, inherent_digests_, deadline_);
 
   // then
   ASSERT_FALSE(block_res);
@@ -143,28 +182,89 @@ TEST_F(ProposerTest, CreateBlockFailsWhenXtNotPushed) {
  * @given BlockBuilderApi creating inherent extrinsics @and TransactionPool
  * returning extrinsics
  * @when Proposer created from these BlockBuilderApi and TransactionPool is
- * trying to create block @but push extrinsics to block builder failed
- * @then Block is not created
+ * trying to create block @but push of one of the extrinsics fails
+ * @then the extrinsic and its dependents are skipped, it is reported to the
+ * pool as invalid, and the block is created from the rest of the extrinsics
  */
-TEST_F(ProposerTest, PushFailed) {
-  // given
-  // we push 1 xt from inherent_xts and 1 Xt from transaction pool. Second push
-  // fails
+TEST_F(ProposerTest, FailedExtrinsicIsSkipped) {
+  auto invalid_tx = makeTx("invalid"_hash256);
+  auto valid_tx = makeTx("valid"_hash256);
   EXPECT_CALL(*block_builder_, pushExtrinsic(_))
       .WillOnce(Return(outcome::success()))  // for inherent xt
-      .WillOnce(Return(outcome::failure(
-          boost::system::error_code{})));  // for xt from tx pool
+      .WillOnce(Return(outcome::failure(boost::system::error_code{})))
+      .WillOnce(Return(outcome::success()));
 
-  std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready_transactions{
-      std::make_pair("fakeHash"_hash256, std::make_shared<Transaction>())};
+  auto iterator = std::make_unique<ReadyIteratorMock>();
+  {
+    testing::InSequence s;
+    EXPECT_CALL(*iterator, next()).WillOnce(Return(invalid_tx));
+    EXPECT_CALL(*iterator, skipDependents());
+    EXPECT_CALL(*iterator, next())
+        .WillOnce(Return(valid_tx))
+        .WillOnce(Return(nullptr));
+  }
+  std::unique_ptr<TransactionPool::ReadyIterator> ready_iterator =
+      std::move(iterator);
+  EXPECT_CALL(*transaction_pool_, getReadyIterator())
+      .WillOnce(Return(ByMove(std::move(ready_iterator))));
 
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
+  EXPECT_CALL(*transaction_pool_, reportInvalid(invalid_tx->hash));
+  EXPECT_CALL(*transaction_pool_, removeOne(valid_tx->hash))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
 
-  // when
-  auto block_res =
-      proposer_.propose(expected_block_id_, inherent_data_, inherent_digests_);
+  auto block_res = proposer_.propose(
+      expected_block_id_, inherent_data_, inherent_digests_, deadline_);
 
-  // then
-  ASSERT_FALSE(block_res);
+  ASSERT_TRUE(block_res);
+  ASSERT_EQ(expected_block, block_res.value());
+}
+
+/**
+ * @given transaction pool with ready transactions, which total size is bigger
+ * than the limit of the block
+ * @when block is proposed
+ * @then transactions are added until they fit the block
+ */
+TEST_F(ProposerTest, BlockIsLimitedBySize) {
+  EXPECT_CALL(*block_builder_, pushExtrinsic(_))
+      .Times(3)
+      .WillRepeatedly(Return(outcome::success()));
+  // the inherent takes 3 bytes of the 100 allowed
+  expectReadyTransactions({makeTx("01"_hash256, 60),
+                           makeTx("02"_hash256, 40),
+                           makeTx("03"_hash256, 37),
+                           makeTx("04"_hash256, 30),
+                           makeTx("05"_hash256, 1)});
+
+  EXPECT_CALL(*transaction_pool_, removeOne("01"_hash256))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*transaction_pool_, removeOne("03"_hash256))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
+
+  ASSERT_TRUE(proposer_.propose(
+      expected_block_id_, inherent_data_, inherent_digests_, deadline_));
+}
+
+/**
+ * @given transaction pool with ready transactions
+ * @when block is proposed @and the deadline is reached
+ * @then no more transactions are added and the block is created
+ */
+TEST_F(ProposerTest, BlockIsLimitedByDeadline) {
+  EXPECT_CALL(*block_builder_, pushExtrinsic(_))
+      .Times(2)
+      .WillRepeatedly(Return(outcome::success()));
+  expectReadyTransactions({makeTx("01"_hash256), makeTx("02"_hash256)});
+  EXPECT_CALL(*clock_, now())
+      .WillOnce(Return(now_))
+      .WillOnce(Return(deadline_));
+
+  EXPECT_CALL(*transaction_pool_, removeOne("01"_hash256))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
+
+  ASSERT_TRUE(proposer_.propose(
+      expected_block_id_, inherent_data_, inherent_digests_, deadline_));
 }
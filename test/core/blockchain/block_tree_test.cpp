@@ -12,6 +12,7 @@
 #include "common/buffer.hpp"
 #include "crypto/hasher/hasher_impl.hpp"
 #include "mock/core/blockchain/block_storage_mock.hpp"
+#include "mock/core/blockchain/block_tree_observer_mock.hpp"
 #include "mock/core/blockchain/header_repository_mock.hpp"
 #include "mock/core/storage/persistent_map_mock.hpp"
 #include "primitives/block_id.hpp"
@@ -192,6 +193,66 @@ TEST_F(BlockTreeTest, Finalize) {
   ASSERT_EQ(block_tree_->getLastFinalized().block_hash, hash);
 }
 
+/**
+ * @given block tree with a subscribed observer
+ * @when a block is added and then finalized
+ * @then the observer is notified of both events
+ */
+TEST_F(BlockTreeTest, ObserverIsNotified) {
+  // GIVEN
+  auto observer = std::make_shared<BlockTreeObserverMock>();
+  block_tree_->addObserver(observer);
+
+  BlockHeader header{.parent_hash = kFinalizedBlockHash,
+                     .number = 1,
+                     .digest = {PreRuntime{}}};
+  Block new_block{header, {}};
+  auto hash = hasher_->blake2b_256(scale::encode(new_block).value());
+  Justification justification{{0x45, 0xF4}};
+  EXPECT_CALL(*storage_, putJustification(justification, hash, header.number))
+      .WillOnce(Return(outcome::success()));
+
+  // THEN
+  EXPECT_CALL(*observer, onBlockAdded(BlockInfo{header.number, hash}));
+  EXPECT_CALL(*observer, onBlockFinalized(BlockInfo{header.number, hash}));
+
+  // WHEN
+  addBlock(new_block);
+  ASSERT_TRUE(block_tree_->finalize(hash, justification));
+}
+
+/**
+ * @given block tree with two forks and a subscribed observer
+ * @when the block of one fork is finalized
+ * @then the observer is notified of the removal of the other fork
+ */
+TEST_F(BlockTreeTest, ObserverIsNotifiedOfPrunedBlocks) {
+  // GIVEN
+  auto observer = std::make_shared<BlockTreeObserverMock>();
+  EXPECT_CALL(*observer, onBlockAdded(_)).Times(3);
+  block_tree_->addObserver(observer);
+
+  auto parent = addHeaderToRepository(kFinalizedBlockHash, 1);
+  BlockHeader header{
+      .parent_hash = parent, .number = 2, .digest = {PreRuntime{}}};
+  auto finalized = addBlock(Block{header, {}});
+  header.digest = {};
+  auto pruned = addBlock(Block{header, {}});
+  Justification justification{{0x45, 0xF4}};
+  EXPECT_CALL(*storage_,
+              putJustification(justification, finalized, header.number))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*storage_, removeBlock(pruned, header.number))
+      .WillOnce(Return(outcome::success()));
+
+  // THEN
+  EXPECT_CALL(*observer, onBlockFinalized(BlockInfo{header.number, finalized}));
+  EXPECT_CALL(*observer, onBlockPruned(BlockInfo{header.number, pruned}));
+
+  // WHEN
+  ASSERT_TRUE(block_tree_->finalize(finalized, justification));
+}
+
 /**
  * @given block tree with at least three blocks inside
  * @when asking for chain from the lowest block to the closest finalized one
@@ -366,3 +427,30 @@ TEST_F(BlockTreeTest, GetBestChain_TargetPastMax) {
   EXPECT_OUTCOME_FALSE(err, block_tree_->getBestContaining(target_hash, 42));
   ASSERT_EQ(err, BlockTreeImpl::Error::TARGET_IS_PAST_MAX);
 }
+
+/**
+ * @given a block tree with a long chain and a fork near its bottom
+ * @when checking if one block is an ancestor of another one
+ * @then true is returned only for the blocks on the same branch in the
+ * ancestor-descendant order
+ */
+TEST_F(BlockTreeTest, HasDirectChain) {
+  std::vector<BlockHash> chain{kFinalizedBlockHash};
+  for (BlockNumber number = 1; number <= 10; ++number) {
+    chain.push_back(addHeaderToRepository(chain.back(), number));
+  }
+  BlockHeader fork_header{
+      .parent_hash = chain[1], .number = 2, .digest = {Consensus{}}};
+  auto fork_hash = addBlock(Block{fork_header, {}});
+
+  for (size_t i = 0; i < chain.size(); ++i) {
+    for (size_t j = 0; j < chain.size(); ++j) {
+      ASSERT_EQ(block_tree_->hasDirectChain(chain[i], chain[j]), i <= j)
+          << "ancestor: " << i << ", descendant: " << j;
+    }
+  }
+
+  ASSERT_TRUE(block_tree_->hasDirectChain(chain[1], fork_hash));
+  ASSERT_FALSE(block_tree_->hasDirectChain(chain[2], fork_hash));
+  ASSERT_FALSE(block_tree_->hasDirectChain(fork_hash, chain.back()));
+}
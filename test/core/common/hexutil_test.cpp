@@ -22,6 +22,24 @@ TEST(Common, Hexutil_Hex) {
   ASSERT_EQ(hexed, "00010204081020FF"s);
 }
 
+/**
+ * @given Array of all byte values
+ * @when hex it in lowercase with and without prefix
+ * @then hex matches the one made digit by digit
+ */
+TEST(Common, Hexutil_HexLower) {
+  std::vector<uint8_t> bin;
+  std::string expected;
+  for (size_t byte = 0; byte < 256; ++byte) {
+    bin.push_back(byte);
+    expected += "0123456789abcdef"[byte / 16];
+    expected += "0123456789abcdef"[byte % 16];
+  }
+  ASSERT_EQ(hex_lower(bin), expected);
+  ASSERT_EQ(hex_lower_0x(bin), "0x" + expected);
+  ASSERT_EQ(hex_lower_0x({}), "0x"s);
+}
+
 /**
  * @given Hexencoded string of even length
  * @when unhex
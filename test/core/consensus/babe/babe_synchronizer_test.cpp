@@ -0,0 +1,171 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/babe/impl/babe_synchronizer_impl.hpp"
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include <set>
+
+#include <boost/asio/io_context.hpp>
+
+#include "clock/impl/clock_impl.hpp"
+#include "mock/core/network/sync_protocol_client_mock.hpp"
+
+using namespace kagome;
+using namespace consensus;
+using namespace primitives;
+using namespace network;
+
+using testing::_;
+using testing::Invoke;
+
+class BabeSynchronizerTest : public testing::Test {
+ public:
+  using Callback = std::function<void(outcome::result<BlocksResponse>)>;
+
+  /// Request, which was made to one of the clients
+  struct Pending {
+    std::shared_ptr<SyncProtocolClientMock> client;
+    BlocksRequest request;
+    Callback cb;
+  };
+
+  void SetUp() override {
+    for (auto i = 0; i < 3; ++i) {
+      auto client = std::make_shared<SyncProtocolClientMock>();
+      ON_CALL(*client, requestBlocks(_, _))
+          .WillByDefault(Invoke([this, client_wp = std::weak_ptr(client)](
+                                    const BlocksRequest &request, Callback cb) {
+            pending_.push_back({client_wp.lock(), request, std::move(cb)});
+          }));
+      clients_.push_back(client);
+      sync_clients_->clients.insert(client);
+    }
+    synchronizer_ = std::make_shared<BabeSynchronizerImpl>(
+        sync_clients_, std::make_shared<clock::SteadyClockImpl>(), io_context_);
+  }
+
+  static BlockHash hashOf(BlockNumber number) {
+    BlockHash hash{};
+    std::copy_n(reinterpret_cast<const uint8_t *>(&number),
+                sizeof(number),
+                hash.begin());
+    return hash;
+  }
+
+  /// @return response with the chain of blocks from \param first to \param last
+  static BlocksResponse makeResponse(BlockNumber first, BlockNumber last) {
+    BlocksResponse response{};
+    for (auto number = first; number <= last; ++number) {
+      BlockHeader header{};
+      header.number = number;
+      header.parent_hash = number == 0 ? BlockHash{} : hashOf(number - 1);
+      response.blocks.push_back(BlockData{hashOf(number), header});
+    }
+    return response;
+  }
+
+  /// @return pending request, which starts from block \param first
+  Pending takePending(BlockNumber first) {
+    auto it = std::find_if(
+        pending_.begin(), pending_.end(), [this, first](const Pending &p) {
+          return p.request.from == BlockId{first}
+                 or (first == 0 and p.request.from == BlockId{hashOf(0)});
+        });
+    EXPECT_NE(it, pending_.end());
+    auto pending = *it;
+    pending_.erase(it);
+    return pending;
+  }
+
+  void request(BlockNumber to) {
+    synchronizer_->request(
+        BlockInfo{0, hashOf(0)},
+        BlockInfo{to, hashOf(to)},
+        [this](const std::vector<Block> &blocks) {
+          for (const auto &block : blocks) {
+            received_.push_back(block.header.number);
+          }
+        },
+        [this] { finished_ = true; });
+  }
+
+  std::shared_ptr<boost::asio::io_context> io_context_ =
+      std::make_shared<boost::asio::io_context>();
+  std::shared_ptr<SyncClientsSet> sync_clients_ =
+      std::make_shared<SyncClientsSet>();
+  std::vector<std::shared_ptr<SyncProtocolClientMock>> clients_;
+  std::shared_ptr<BabeSynchronizerImpl> synchronizer_;
+
+  std::vector<Pending> pending_;
+  std::vector<BlockNumber> received_;
+  bool finished_ = false;
+};
+
+/**
+ * @given synchronizer with three clients
+ * @when range of three windows is requested and windows arrive in reverse order
+ * @then windows are requested from different clients concurrently and blocks
+ * are handled in the ascending order once they are contiguous
+ */
+TEST_F(BabeSynchronizerTest, DownloadsWindowsConcurrently) {
+  const BlockNumber to = 2 * BabeSynchronizerImpl::kWindowSize + 43;
+  request(to);
+
+  ASSERT_EQ(pending_.size(), 3);
+  std::set<std::shared_ptr<SyncProtocolClientMock>> used_clients;
+  for (const auto &pending : pending_) {
+    used_clients.insert(pending.client);
+  }
+  ASSERT_EQ(used_clients.size(), 3);
+
+  auto last_window = takePending(2 * BabeSynchronizerImpl::kWindowSize);
+  ASSERT_EQ(last_window.request.to, hashOf(to));
+  last_window.cb(makeResponse(2 * BabeSynchronizerImpl::kWindowSize, to));
+  auto second_window = takePending(BabeSynchronizerImpl::kWindowSize);
+  second_window.cb(makeResponse(BabeSynchronizerImpl::kWindowSize,
+                                2 * BabeSynchronizerImpl::kWindowSize));
+  ASSERT_TRUE(received_.empty());
+  ASSERT_FALSE(finished_);
+
+  auto first_window = takePending(0);
+  first_window.cb(makeResponse(0, BabeSynchronizerImpl::kWindowSize - 1));
+
+  std::vector<BlockNumber> expected(to + 1);
+  std::iota(expected.begin(), expected.end(), 0);
+  ASSERT_EQ(received_, expected);
+  ASSERT_TRUE(finished_);
+}
+
+/**
+ * @given synchronizer with three clients downloading three windows
+ * @when one of the clients fails to return its window
+ * @then the window is requested from the client, which becomes idle first
+ */
+TEST_F(BabeSynchronizerTest, FailedWindowIsRequestedFromAnotherClient) {
+  const BlockNumber to = 2 * BabeSynchronizerImpl::kWindowSize + 43;
+  request(to);
+  ASSERT_EQ(pending_.size(), 3);
+
+  auto first_window = takePending(0);
+  first_window.cb(outcome::failure(std::make_error_code(std::errc::timed_out)));
+  // all other clients are busy
+  ASSERT_EQ(pending_.size(), 2);
+
+  auto second_window = takePending(BabeSynchronizerImpl::kWindowSize);
+  second_window.cb(makeResponse(BabeSynchronizerImpl::kWindowSize,
+                                2 * BabeSynchronizerImpl::kWindowSize - 1));
+
+  auto retried_window = takePending(0);
+  ASSERT_EQ(retried_window.client, second_window.client);
+  retried_window.cb(makeResponse(0, BabeSynchronizerImpl::kWindowSize - 1));
+  ASSERT_EQ(received_.size(), 2 * BabeSynchronizerImpl::kWindowSize);
+
+  auto last_window = takePending(2 * BabeSynchronizerImpl::kWindowSize);
+  last_window.cb(makeResponse(2 * BabeSynchronizerImpl::kWindowSize, to));
+  ASSERT_EQ(received_.size(), to + 1);
+  ASSERT_TRUE(finished_);
+}
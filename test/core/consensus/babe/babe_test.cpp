@@ -27,6 +27,7 @@
 #include "mock/core/runtime/babe_api_mock.hpp"
 #include "mock/core/runtime/core_mock.hpp"
 #include "mock/core/storage/trie/trie_db_mock.hpp"
+#include "mock/core/transaction_pool/pool_revalidator_mock.hpp"
 #include "primitives/block.hpp"
 #include "testutil/sr25519_utils.hpp"
 
@@ -72,6 +73,8 @@ class BabeTest : public testing::Test {
     babe_api_ = std::make_shared<runtime::BabeApiMock>();
     core_ = std::make_shared<runtime::CoreMock>();
     proposer_ = std::make_shared<ProposerMock>();
+    pool_revalidator_ = std::make_shared<
+        testing::NiceMock<transaction_pool::PoolRevalidatorMock>>();
     block_tree_ = std::make_shared<BlockTreeMock>();
     gossiper_ = std::make_shared<BabeGossiperMock>();
     clock_ = std::make_shared<SystemClockMock>();
@@ -98,13 +101,16 @@ class BabeTest : public testing::Test {
     EXPECT_CALL(*epoch_storage_, getEpochDescriptor(1))
         .WillOnce(Return(expected_epoch_digest));
 
-    auto block_executor = std::make_shared<BlockExecutor>(block_tree_,
-                                                          core_,
-                                                          expected_config,
-                                                          babe_synchronizer_,
-                                                          babe_block_validator_,
-                                                          epoch_storage_,
-                                                          hasher_);
+    auto block_executor =
+        std::make_shared<BlockExecutor>(block_tree_,
+                                        core_,
+                                        expected_config,
+                                        babe_synchronizer_,
+                                        babe_block_validator_,
+                                        epoch_storage_,
+                                        hasher_,
+                                        pool_revalidator_,
+                                        BlockExecutor::Params{});
 
     babe_ = std::make_shared<BabeImpl>(lottery_,
                                        block_executor,
@@ -112,6 +118,7 @@ class BabeTest : public testing::Test {
                                        epoch_storage_,
                                        expected_config,
                                        proposer_,
+                                       pool_revalidator_,
                                        block_tree_,
                                        gossiper_,
                                        keypair_,
@@ -134,6 +141,7 @@ class BabeTest : public testing::Test {
   std::shared_ptr<runtime::BabeApiMock> babe_api_;
   std::shared_ptr<runtime::CoreMock> core_;
   std::shared_ptr<ProposerMock> proposer_;
+  std::shared_ptr<transaction_pool::PoolRevalidatorMock> pool_revalidator_;
   std::shared_ptr<BlockTreeMock> block_tree_;
   std::shared_ptr<BabeGossiperMock> gossiper_;
   SR25519Keypair keypair_{generateSR25519Keypair()};
@@ -225,10 +233,11 @@ TEST_F(BabeTest, Success) {
   // processSlotLeadership
   // we are not leader of the first slot, but leader of the second
   EXPECT_CALL(*block_tree_, deepestLeaf()).WillOnce(Return(best_leaf));
-  EXPECT_CALL(*proposer_, propose(BlockId{best_block_hash_}, _, _))
+  EXPECT_CALL(*proposer_, propose(BlockId{best_block_hash_}, _, _, _))
       .WillOnce(Return(created_block_));
   EXPECT_CALL(*hasher_, blake2b_256(_)).WillOnce(Return(created_block_hash_));
   EXPECT_CALL(*block_tree_, addBlock(_)).WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*pool_revalidator_, onBlockImported(_));
 
   EXPECT_CALL(*gossiper_, blockAnnounce(_))
       .WillOnce(CheckBlockHeader(created_block_.header));
@@ -0,0 +1,164 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/babe/impl/sync_request_scheduler.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/optional/optional_io.hpp>
+
+#include "blockchain/block_tree_error.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/consensus/babe/babe_synchronizer_mock.hpp"
+
+using namespace kagome;
+using namespace consensus;
+using namespace primitives;
+
+using blockchain::BlockTreeMock;
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+class SyncRequestSchedulerTest : public testing::Test {
+ public:
+  /// Request, which was passed to the synchronizer
+  struct Pending {
+    BlockInfo from;
+    BlockInfo to;
+    BabeSynchronizer::FinishedHandler finished_handler;
+  };
+
+  void SetUp() override {
+    ON_CALL(*block_tree_, getLastFinalized())
+        .WillByDefault(Return(BlockInfo{0, hashOf(0)}));
+    ON_CALL(*block_tree_, getBlockBody(_))
+        .WillByDefault(Invoke([this](const BlockId &id)
+                                  -> outcome::result<BlockBody> {
+          if (imported_.count(boost::get<BlockHash>(id)) == 0) {
+            return blockchain::BlockTreeError::NO_SUCH_BLOCK;
+          }
+          return BlockBody{};
+        }));
+    ON_CALL(*block_tree_, getBlockHeader(_))
+        .WillByDefault(Invoke([this](const BlockId &id)
+                                  -> outcome::result<BlockHeader> {
+          auto it = headers_.find(boost::get<BlockHash>(id));
+          if (it == headers_.end()) {
+            return blockchain::BlockTreeError::NO_SUCH_BLOCK;
+          }
+          return it->second;
+        }));
+    ON_CALL(*synchronizer_, request(_, _, _, _))
+        .WillByDefault(Invoke([this](const BlockInfo &from,
+                                     const BlockInfo &to,
+                                     const auto &,
+                                     const auto &finished_handler) {
+          pending_.push_back({from, to, finished_handler});
+        }));
+    imported_.insert(hashOf(0));
+  }
+
+  static BlockHash hashOf(BlockNumber number) {
+    BlockHash hash{};
+    std::copy_n(reinterpret_cast<const uint8_t *>(&number),
+                sizeof(number),
+                hash.begin());
+    return hash;
+  }
+
+  /// Store header of block \param number, as it is done for announced blocks
+  void storeHeader(BlockNumber number) {
+    BlockHeader header{};
+    header.number = number;
+    header.parent_hash = hashOf(number - 1);
+    headers_.emplace(hashOf(number), header);
+  }
+
+  void announce(BlockNumber number) {
+    scheduler_->schedule(
+        BlockInfo{number, hashOf(number)},
+        hashOf(number - 1),
+        [](const auto &) {},
+        [this, number] { finished_.push_back(number); });
+  }
+
+  std::shared_ptr<BlockTreeMock> block_tree_ =
+      std::make_shared<testing::NiceMock<BlockTreeMock>>();
+  std::shared_ptr<BabeSynchronizerMock> synchronizer_ =
+      std::make_shared<testing::NiceMock<BabeSynchronizerMock>>();
+  std::shared_ptr<SyncRequestScheduler> scheduler_ =
+      std::make_shared<SyncRequestScheduler>(block_tree_, synchronizer_);
+
+  std::set<BlockHash> imported_;
+  std::map<BlockHash, BlockHeader> headers_;
+  std::vector<Pending> pending_;
+  std::vector<BlockNumber> finished_;
+};
+
+/**
+ * @given blocks from the last finalized one up to 10 are being downloaded
+ * @when the same block and then its descendants are announced
+ * @then no new requests are made until the download is finished, after that
+ * a single request of the announced suffix is made
+ */
+TEST_F(SyncRequestSchedulerTest, AnnouncesDuringDownloadAreCoalesced) {
+  announce(10);
+  ASSERT_EQ(pending_.size(), 1);
+  ASSERT_EQ(pending_[0].from, (BlockInfo{0, hashOf(0)}));
+  ASSERT_EQ(pending_[0].to, (BlockInfo{10, hashOf(10)}));
+
+  announce(10);
+  for (BlockNumber number = 11; number <= 13; ++number) {
+    announce(number);
+  }
+  ASSERT_EQ(pending_.size(), 1);
+  ASSERT_EQ(scheduler_->size(), 2);
+
+  auto first = pending_[0];
+  pending_.clear();
+  first.finished_handler();
+  ASSERT_EQ(finished_, (std::vector<BlockNumber>{10, 10}));
+  ASSERT_EQ(pending_.size(), 1);
+  ASSERT_EQ(pending_[0].from, (BlockInfo{10, hashOf(10)}));
+  ASSERT_EQ(pending_[0].to, (BlockInfo{13, hashOf(13)}));
+
+  pending_[0].finished_handler();
+  ASSERT_EQ(finished_, (std::vector<BlockNumber>{10, 10, 11, 12, 13}));
+  ASSERT_EQ(scheduler_->size(), 0);
+}
+
+/**
+ * @given blocks up to 5 are imported and headers of blocks 6 and 7 are known
+ * @when block 8 is announced
+ * @then only blocks starting from the last imported one are requested
+ */
+TEST_F(SyncRequestSchedulerTest, OnlyMissingSuffixIsRequested) {
+  for (BlockNumber number = 1; number <= 7; ++number) {
+    storeHeader(number);
+    if (number <= 5) {
+      imported_.insert(hashOf(number));
+    }
+  }
+
+  announce(8);
+  ASSERT_EQ(pending_.size(), 1);
+  ASSERT_EQ(pending_[0].from, (BlockInfo{5, hashOf(5)}));
+  ASSERT_EQ(pending_[0].to, (BlockInfo{8, hashOf(8)}));
+}
+
+/**
+ * @given imported block
+ * @when the block is announced
+ * @then nothing is requested and the request is finished at once
+ */
+TEST_F(SyncRequestSchedulerTest, ImportedBlockIsNotRequested) {
+  storeHeader(1);
+  imported_.insert(hashOf(1));
+  EXPECT_CALL(*synchronizer_, request(_, _, _, _)).Times(0);
+
+  announce(1);
+  ASSERT_EQ(finished_, std::vector<BlockNumber>{1});
+  ASSERT_EQ(scheduler_->size(), 0);
+}
@@ -0,0 +1,63 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "core/consensus/grandpa/vote_graph/fixture.hpp"
+
+#include <boost/optional/optional_io.hpp>
+
+struct AncestryIndexTest : public VoteGraphFixture {
+  void SetUp() override {
+    BlockInfo base{1, GENESIS_HASH};
+    graph = std::make_shared<VoteGraphImpl>(base, chain);
+
+    expect_getAncestry(GENESIS_HASH, "C"_H, vec("B"_H, "A"_H));
+    EXPECT_OUTCOME_TRUE_1(graph->insert(BlockInfo{4, "C"_H}, "100"_W));
+
+    expect_getAncestry(
+        GENESIS_HASH, "E1"_H, vec("D1"_H, "C"_H, "B"_H, "A"_H));
+    EXPECT_OUTCOME_TRUE_1(graph->insert(BlockInfo{6, "E1"_H}, "100"_W));
+
+    expect_getAncestry(
+        GENESIS_HASH, "F2"_H, vec("E2"_H, "D2"_H, "C"_H, "B"_H, "A"_H));
+    EXPECT_OUTCOME_TRUE_1(graph->insert(BlockInfo{7, "F2"_H}, "100"_W));
+  }
+};
+
+/**
+ * @given vote graph with a fork at node
+ * @when looking for ancestors of vote-nodes by number
+ * @then blocks of the corresponding branch are returned
+ */
+TEST_F(AncestryIndexTest, FindAncestorBlockBy) {
+  ASSERT_EQ(graph->findAncestorBlockBy("F2"_H, 7), "F2"_H);
+  ASSERT_EQ(graph->findAncestorBlockBy("F2"_H, 6), "E2"_H);
+  ASSERT_EQ(graph->findAncestorBlockBy("F2"_H, 5), "D2"_H);
+  ASSERT_EQ(graph->findAncestorBlockBy("E1"_H, 5), "D1"_H);
+  ASSERT_EQ(graph->findAncestorBlockBy("E1"_H, 4), "C"_H);
+  ASSERT_EQ(graph->findAncestorBlockBy("F2"_H, 3), "B"_H);
+  ASSERT_EQ(graph->findAncestorBlockBy("E1"_H, 2), "A"_H);
+  ASSERT_EQ(graph->findAncestorBlockBy("F2"_H, 1), GENESIS_HASH);
+
+  ASSERT_EQ(graph->findAncestorBlockBy("F2"_H, 0), boost::none);
+  ASSERT_EQ(graph->findAncestorBlockBy("F2"_H, 8), boost::none);
+  ASSERT_EQ(graph->findAncestorBlockBy("D1"_H, 5), boost::none);
+}
+
+/**
+ * @given vote graph with a fork at node
+ * @when new vote-node is introduced in the middle of existing ancestry
+ * @then ancestry is still resolved correctly through the new node
+ */
+TEST_F(AncestryIndexTest, AncestryAfterIntroduceBranch) {
+  EXPECT_OUTCOME_TRUE_1(graph->insert(BlockInfo{3, "B"_H}, "100"_W));
+  ASSERT_EQ(graph->getEntries().at("C"_H).ancestors, vec("B"_H));
+
+  auto containing = graph->findContainingNodes(BlockInfo{2, "A"_H});
+  ASSERT_TRUE(containing);
+  ASSERT_EQ(*containing, vec("B"_H));
+
+  ASSERT_EQ(graph->findAncestorBlockBy("E1"_H, 3), "B"_H);
+  ASSERT_EQ(graph->findAncestorBlockBy("E1"_H, 2), "A"_H);
+  ASSERT_EQ(graph->findAncestorBlockBy("F2"_H, 1), GENESIS_HASH);
+}
@@ -0,0 +1,97 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/grandpa/impl/vote_verifier.hpp"
+
+#include <gtest/gtest.h>
+#include "core/consensus/grandpa/literals.hpp"
+#include "mock/core/consensus/grandpa/vote_crypto_provider_mock.hpp"
+#include "mock/core/crypto/hasher_mock.hpp"
+
+using namespace kagome::consensus::grandpa;
+using kagome::common::Hash256;
+using kagome::crypto::HasherMock;
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+class VoteVerifierTest : public testing::Test {
+ public:
+  void SetUp() override {
+    // hash is not cryptographic here, but is unique for the votes of the tests
+    ON_CALL(*hasher_, blake2b_256(_))
+        .WillByDefault(Invoke([](gsl::span<const uint8_t> buffer) {
+          Hash256 hash{};
+          auto value = boost::hash_range(buffer.begin(), buffer.end());
+          std::copy_n(reinterpret_cast<const uint8_t *>(&value),
+                      sizeof(value),
+                      hash.begin());
+          return hash;
+        }));
+  }
+
+  VoteMessage makePrevote(const std::string &voter, const std::string &block) {
+    SignedPrevote prevote;
+    prevote.id = makeId(voter);
+    prevote.signature = makeSig(voter + block);
+    prevote.message = Prevote{1, makeBlockHash(block)};
+    return VoteMessage{.round_number = 1, .counter = 0, .vote = prevote};
+  }
+
+  std::shared_ptr<HasherMock> hasher_ = std::make_shared<HasherMock>();
+  std::shared_ptr<VoteCryptoProviderMock> crypto_provider_ =
+      std::make_shared<VoteCryptoProviderMock>();
+  std::shared_ptr<boost::asio::io_context> io_context_ =
+      std::make_shared<boost::asio::io_context>();
+  std::shared_ptr<VoteVerifier> verifier_ =
+      std::make_shared<VoteVerifier>(hasher_, io_context_, 4);
+
+  std::vector<Id> delivered_;
+  VoteVerifier::OnVerified on_verified_ = [this](const VoteMessage &msg) {
+    delivered_.push_back(msg.id());
+  };
+};
+
+/**
+ * @given vote verifier
+ * @when the same vote is received several times
+ * @then its signature is verified and the vote is delivered only once
+ */
+TEST_F(VoteVerifierTest, DuplicateIsVerifiedOnce) {
+  EXPECT_CALL(*crypto_provider_, verifyPrevote(_)).WillOnce(Return(true));
+
+  auto msg = makePrevote("Alice", "B");
+  for (int i = 0; i < 3; ++i) {
+    verifier_->verify(msg, crypto_provider_, on_verified_);
+  }
+  io_context_->run();
+
+  ASSERT_EQ(delivered_, std::vector<Id>{makeId("Alice")});
+}
+
+/**
+ * @given vote verifier
+ * @when several votes are received and signature of one of them is invalid
+ * @then valid votes are delivered in the order they were received, invalid one
+ * is dropped
+ */
+TEST_F(VoteVerifierTest, DeliversValidVotesInOrder) {
+  std::vector<std::string> voters{"Alice", "Bob", "Carol", "Dave", "Eve"};
+  EXPECT_CALL(*crypto_provider_, verifyPrevote(_))
+      .Times(voters.size())
+      .WillRepeatedly(Invoke([](const SignedPrevote &prevote) {
+        return prevote.id != makeId("Carol");
+      }));
+
+  for (const auto &voter : voters) {
+    verifier_->verify(makePrevote(voter, "B"), crypto_provider_, on_verified_);
+  }
+  io_context_->run();
+
+  ASSERT_EQ(delivered_,
+            (std::vector<Id>{
+                makeId("Alice"), makeId("Bob"), makeId("Dave"), makeId("Eve")}));
+}
@@ -519,3 +519,122 @@ TEST_F(VotingRoundTest, SunnyDayScenario) {
 
   io_context_->run_for(duration_ * 6);
 }
+
+/**
+ * @given Network of:
+ * Alice with weight 4,
+ * Bob with weight 7 and
+ * Eve with weight 3
+ * @and vote graph with base in Block with number 4 and hash "C"_h
+ * @when
+ * 1. Alice and Bob prevote and precommit Prevote{10, "FC"_H}
+ * 2. Eve prevotes and precommits for the same block afterwards
+ * @then
+ * 1. After Bob precommits block BlockInfo{10, "FC"_H} is committed
+ * 2. Eve's votes do not change round state, so nothing is committed again
+ */
+TEST_F(VotingRoundTest, VotesNotChangingStateDoNotFinalize) {
+  EXPECT_CALL(*env_, getAncestry("C"_H, "FC"_H))
+      .WillRepeatedly(Return(std::vector<kagome::primitives::BlockHash>{
+          "FB"_H, "FA"_H, "F"_H, "E"_H, "D"_H}));
+
+  RoundState last_round_state;
+  last_round_state.prevote_ghost.emplace(4, "C"_H);
+  last_round_state.estimate.emplace(4, "C"_H);
+  last_round_state.finalized.emplace(4, "C"_H);
+  // last round estimate is not better than finalized, so nothing is proposed
+  voting_round_->primaryPropose(last_round_state);
+
+  EXPECT_CALL(*env_, onCommitted(round_number_, BlockInfo{10, "FC"_H}, _))
+      .WillOnce(Return(outcome::success()));
+
+  // when 1.
+  voting_round_->onPrevote(
+      preparePrevote(kAlice, kAliceSignature, {10, "FC"_H}));
+  voting_round_->onPrevote(preparePrevote(kBob, kBobSignature, {10, "FC"_H}));
+  voting_round_->onPrecommit(
+      preparePrecommit(kAlice, kAliceSignature, {10, "FC"_H}));
+  voting_round_->onPrecommit(
+      preparePrecommit(kBob, kBobSignature, {10, "FC"_H}));
+
+  // then 1.
+  ASSERT_TRUE(voting_round_->completable());
+  ASSERT_EQ(voting_round_->getCurrentState().finalized, BlockInfo(10, "FC"_H));
+
+  // when 2.
+  voting_round_->onPrevote(preparePrevote(kEve, kEveSignature, {10, "FC"_H}));
+  voting_round_->onPrecommit(
+      preparePrecommit(kEve, kEveSignature, {10, "FC"_H}));
+
+  // then 2.
+  ASSERT_EQ(voting_round_->getCurrentState().finalized, BlockInfo(10, "FC"_H));
+}
+
+/**
+ * @given Network of:
+ * Alice with weight 4,
+ * Bob with weight 7 and
+ * Eve with weight 3
+ * @and vote graph with base in Block with number 4 and hash "C"_h, which is
+ * finalized in the last round
+ * @when
+ * 1. Alice and Bob prevote Prevote{10, "FC"_H}
+ * 2. Eve precommits Precommit{10, "FC"_H}, Bob precommits Precommit{6,
+ * "CB"_H} of another fork
+ * 3. Alice precommits Precommit{10, "FC"_H}
+ * 4. Bob equivocates with Precommit{10, "FC"_H}
+ * @then
+ * 1. After Bob precommits round is completable, but only the base has
+ * supermajority of precommits, so nothing is committed and the round goes on
+ * 2. Alice's precommit does not change round state, nothing is committed yet
+ * 3. After Bob's equivocation BlockInfo{10, "FC"_H} is committed
+ */
+TEST_F(VotingRoundTest, CompletableRoundIsFinalizedOnLaterVote) {
+  EXPECT_CALL(*env_, getAncestry("C"_H, "FC"_H))
+      .WillRepeatedly(Return(std::vector<kagome::primitives::BlockHash>{
+          "FB"_H, "FA"_H, "F"_H, "E"_H, "D"_H}));
+  EXPECT_CALL(*env_, getAncestry("C"_H, "CB"_H))
+      .WillRepeatedly(
+          Return(std::vector<kagome::primitives::BlockHash>{"CA"_H}));
+  EXPECT_CALL(*env_, onCommitted(_, _, _)).Times(0);
+  EXPECT_CALL(*env_, onCompleted(_)).Times(0);
+
+  RoundState last_round_state;
+  last_round_state.prevote_ghost.emplace(4, "C"_H);
+  last_round_state.estimate.emplace(4, "C"_H);
+  last_round_state.finalized.emplace(4, "C"_H);
+  // last round estimate is not better than finalized, so nothing is proposed
+  voting_round_->primaryPropose(last_round_state);
+
+  // when 1.
+  voting_round_->onPrevote(
+      preparePrevote(kAlice, kAliceSignature, {10, "FC"_H}));
+  voting_round_->onPrevote(preparePrevote(kBob, kBobSignature, {10, "FC"_H}));
+
+  // when 2.
+  voting_round_->onPrecommit(
+      preparePrecommit(kEve, kEveSignature, {10, "FC"_H}));
+  voting_round_->onPrecommit(
+      preparePrecommit(kBob, kBobSignature, {6, "CB"_H}));
+
+  // then 1.
+  ASSERT_TRUE(voting_round_->completable());
+  ASSERT_EQ(voting_round_->getCurrentState().finalized, BlockInfo(4, "C"_H));
+
+  // when 3.
+  const auto state = voting_round_->getCurrentState();
+  voting_round_->onPrecommit(
+      preparePrecommit(kAlice, kAliceSignature, {10, "FC"_H}));
+
+  // then 2.
+  ASSERT_EQ(voting_round_->getCurrentState(), state);
+
+  // when 4.
+  EXPECT_CALL(*env_, onCommitted(round_number_, BlockInfo{10, "FC"_H}, _))
+      .WillOnce(Return(outcome::success()));
+  voting_round_->onPrecommit(
+      preparePrecommit(kBob, kBobSignature, {10, "FC"_H}));
+
+  // then 3.
+  ASSERT_EQ(voting_round_->getCurrentState().finalized, BlockInfo(10, "FC"_H));
+}
@@ -0,0 +1,58 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/synchronizer/impl/block_data_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+
+using kagome::consensus::BlockDataCache;
+
+/// @return encoded block data of \param size bytes
+static BlockDataCache::EncodedBlockData blockData(size_t size) {
+  return std::make_shared<const std::vector<uint8_t>>(size, 0);
+}
+
+/**
+ * @given cache, which fits 10 bytes, with two entries of 4 bytes
+ * @when the first one is used and an entry of 5 bytes is put
+ * @then the least recently used second entry is evicted, so that the new one
+ * fits
+ */
+TEST(BlockDataCacheTest, LeastRecentlyUsedIsEvictedBySize) {
+  BlockDataCache cache{10};
+  cache.put("block1"_hash256, 1, blockData(4));
+  cache.put("block2"_hash256, 1, blockData(4));
+  ASSERT_EQ(cache.size(), 8);
+  ASSERT_TRUE(cache.get("block1"_hash256, 1));
+
+  cache.put("block3"_hash256, 1, blockData(5));
+
+  ASSERT_TRUE(cache.get("block1"_hash256, 1));
+  ASSERT_FALSE(cache.get("block2"_hash256, 1));
+  ASSERT_TRUE(cache.get("block3"_hash256, 1));
+  ASSERT_EQ(cache.size(), 9);
+}
+
+/**
+ * @given cache, which fits 10 bytes, with an entry
+ * @when the entry is replaced, and then data larger than the cache is put
+ * @then size accounts for the replaced entry, and the larger data is not
+ * cached and does not evict the others
+ */
+TEST(BlockDataCacheTest, SizeIsTrackedOnReplaceAndLargeDataIsNotCached) {
+  BlockDataCache cache{10};
+  cache.put("block1"_hash256, 1, blockData(4));
+  cache.put("block1"_hash256, 1, blockData(6));
+  ASSERT_EQ(cache.size(), 6);
+  ASSERT_EQ(cache.get("block1"_hash256, 1)->size(), 6);
+
+  cache.put("block2"_hash256, 1, blockData(11));
+
+  ASSERT_FALSE(cache.get("block2"_hash256, 1));
+  ASSERT_TRUE(cache.get("block1"_hash256, 1));
+  ASSERT_EQ(cache.size(), 6);
+}
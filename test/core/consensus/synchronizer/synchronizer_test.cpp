@@ -9,10 +9,14 @@
 
 #include <gtest/gtest.h>
 #include <boost/optional.hpp>
+#include "libp2p/multi/uvarint.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
 #include "mock/core/blockchain/header_repository_mock.hpp"
+#include "mock/libp2p/connection/stream_mock.hpp"
 #include "mock/libp2p/host/host_mock.hpp"
+#include "network/common.hpp"
 #include "primitives/block.hpp"
+#include "scale/scale.hpp"
 #include "testutil/gmock_actions.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
@@ -25,9 +29,11 @@ using namespace primitives;
 using namespace common;
 
 using namespace libp2p;
+using namespace connection;
 using namespace peer;
 
 using testing::_;
+using testing::Invoke;
 using testing::Ref;
 using testing::Return;
 using testing::ReturnRef;
@@ -40,8 +46,20 @@ class SynchronizerTest : public testing::Test {
     block2_.header.parent_hash = block1_hash_;
     block2_hash_.fill(4);
 
-    synchronizer_ = std::make_shared<SynchronizerImpl>(
-        *host_, peer_info_, tree_, headers_, SynchronizerConfig{});
+    synchronizer_ = std::make_shared<SynchronizerImpl>(*host_,
+                                                       peer_info_,
+                                                       tree_,
+                                                       headers_,
+                                                       io_context_,
+                                                       SynchronizerConfig{});
+  }
+
+  /// Process \param request and decode the response, which is to be sent
+  outcome::result<BlocksResponse> onBlocksRequest(
+      const BlocksRequest &request) const {
+    OUTCOME_TRY(encoded_response,
+                synchronizer_->onBlocksRequestEncoded(request));
+    return scale::decode<BlocksResponse>(*encoded_response);
   }
 
   std::shared_ptr<HostMock> host_ = std::make_shared<HostMock>();
@@ -51,6 +69,9 @@ class SynchronizerTest : public testing::Test {
   std::shared_ptr<HeaderRepositoryMock> headers_ =
       std::make_shared<HeaderRepositoryMock>();
 
+  std::shared_ptr<boost::asio::io_context> io_context_ =
+      std::make_shared<boost::asio::io_context>();
+
   std::shared_ptr<Synchronizer> synchronizer_;
 
   Block block1_{{{}, 2}, {{{0x11, 0x22}}, {{0x55, 0x66}}}},
@@ -91,8 +112,7 @@ TEST_F(SynchronizerTest, ProcessRequest) {
       .WillOnce(Return(::outcome::failure(boost::system::error_code{})));
 
   // WHEN
-  EXPECT_OUTCOME_TRUE(response,
-                      synchronizer_->onBlocksRequest(received_request));
+  EXPECT_OUTCOME_TRUE(response, onBlocksRequest(received_request));
 
   // THEN
   ASSERT_EQ(response.id, received_request.id);
@@ -110,3 +130,303 @@ TEST_F(SynchronizerTest, ProcessRequest) {
   ASSERT_EQ(received_blocks[1].body, block2_.body);
   ASSERT_FALSE(received_blocks[1].justification);
 }
+
+/**
+ * @given synchronizer
+ * @when the same blocks are requested twice without justifications
+ * @then data of the blocks is read from the storage only once, and both
+ * responses contain the same blocks
+ */
+TEST_F(SynchronizerTest, ProcessRepeatedRequestFromCache) {
+  // GIVEN
+  BlocksRequest received_request{1,
+                                 {BlockAttributesBits::HEADER
+                                  | BlockAttributesBits::BODY},
+                                 block1_hash_,
+                                 boost::none,
+                                 Direction::DESCENDING,
+                                 boost::none};
+
+  EXPECT_CALL(*tree_, getChainByBlock(block1_hash_, false, 128))
+      .Times(2)
+      .WillRepeatedly(
+          Return(std::vector<BlockHash>{block1_hash_, block2_hash_}));
+
+  EXPECT_CALL(*headers_, getBlockHeader(BlockId{block1_hash_}))
+      .WillOnce(Return(block1_.header));
+  EXPECT_CALL(*headers_, getBlockHeader(BlockId{block2_hash_}))
+      .WillOnce(Return(block2_.header));
+
+  EXPECT_CALL(*tree_, getBlockBody(BlockId{block1_hash_}))
+      .WillOnce(Return(block1_.body));
+  EXPECT_CALL(*tree_, getBlockBody(BlockId{block2_hash_}))
+      .WillOnce(Return(block2_.body));
+
+  // WHEN
+  EXPECT_OUTCOME_TRUE(first_response, onBlocksRequest(received_request));
+  received_request.id = 2;
+  EXPECT_OUTCOME_TRUE(second_response, onBlocksRequest(received_request));
+
+  // THEN
+  ASSERT_EQ(second_response.id, received_request.id);
+  ASSERT_EQ(first_response.blocks, second_response.blocks);
+  ASSERT_EQ(second_response.blocks.size(), 2);
+  ASSERT_EQ(second_response.blocks[1].hash, block2_hash_);
+  ASSERT_EQ(second_response.blocks[1].header, block2_.header);
+  ASSERT_EQ(second_response.blocks[1].body, block2_.body);
+}
+
+/**
+ * @given synchronizer, which cache of block data fits only one of the blocks
+ * @when the same blocks are requested twice
+ * @then data of the first block is evicted by the second one, so it is read
+ * from the storage again
+ */
+TEST_F(SynchronizerTest, ProcessRepeatedRequestOverCacheSize) {
+  // GIVEN
+  BlocksRequest received_request{1,
+                                 {BlockAttributesBits::HEADER
+                                  | BlockAttributesBits::BODY},
+                                 block1_hash_,
+                                 boost::none,
+                                 Direction::DESCENDING,
+                                 boost::none};
+  BlockData block2_data{.hash = block2_hash_,
+                        .header = block2_.header,
+                        .body = block2_.body};
+  SynchronizerConfig config{};
+  config.block_data_cache_bytes = scale::encode(block2_data).value().size();
+  synchronizer_ = std::make_shared<SynchronizerImpl>(
+      *host_, peer_info_, tree_, headers_, io_context_, config);
+
+  EXPECT_CALL(*tree_, getChainByBlock(block1_hash_, false, 128))
+      .Times(2)
+      .WillRepeatedly(
+          Return(std::vector<BlockHash>{block1_hash_, block2_hash_}));
+
+  EXPECT_CALL(*headers_, getBlockHeader(BlockId{block1_hash_}))
+      .Times(2)
+      .WillRepeatedly(Return(block1_.header));
+  EXPECT_CALL(*headers_, getBlockHeader(BlockId{block2_hash_}))
+      .Times(2)
+      .WillRepeatedly(Return(block2_.header));
+
+  EXPECT_CALL(*tree_, getBlockBody(BlockId{block1_hash_}))
+      .Times(2)
+      .WillRepeatedly(Return(block1_.body));
+  EXPECT_CALL(*tree_, getBlockBody(BlockId{block2_hash_}))
+      .Times(2)
+      .WillRepeatedly(Return(block2_.body));
+
+  // WHEN
+  EXPECT_OUTCOME_TRUE(first_response, onBlocksRequest(received_request));
+  received_request.id = 2;
+  EXPECT_OUTCOME_TRUE(second_response, onBlocksRequest(received_request));
+
+  // THEN
+  ASSERT_EQ(first_response.blocks, second_response.blocks);
+  ASSERT_EQ(second_response.blocks.size(), 2);
+}
+
+/**
+ * @given synchronizer, which limits size of the responses
+ * @when a request for blocks, which do not fit into the limit, arrives
+ * @then only the first block is sent
+ */
+TEST_F(SynchronizerTest, ProcessRequestLimitedBySize) {
+  // GIVEN
+  SynchronizerConfig config{};
+  config.max_response_bytes = 1;
+  synchronizer_ = std::make_shared<SynchronizerImpl>(
+      *host_, peer_info_, tree_, headers_, io_context_, config);
+
+  BlocksRequest received_request{1,
+                                 {BlockAttributesBits::HEADER
+                                  | BlockAttributesBits::BODY},
+                                 block1_hash_,
+                                 boost::none,
+                                 Direction::DESCENDING,
+                                 boost::none};
+
+  EXPECT_CALL(*tree_, getChainByBlock(block1_hash_, false, 128))
+      .WillOnce(Return(std::vector<BlockHash>{block1_hash_, block2_hash_}));
+
+  EXPECT_CALL(*headers_, getBlockHeader(BlockId{block1_hash_}))
+      .WillOnce(Return(block1_.header));
+  EXPECT_CALL(*headers_, getBlockHeader(BlockId{block2_hash_}))
+      .WillOnce(Return(block2_.header));
+
+  EXPECT_CALL(*tree_, getBlockBody(BlockId{block1_hash_}))
+      .WillOnce(Return(block1_.body));
+  EXPECT_CALL(*tree_, getBlockBody(BlockId{block2_hash_}))
+      .WillOnce(Return(block2_.body));
+
+  // WHEN
+  EXPECT_OUTCOME_TRUE(response, onBlocksRequest(received_request));
+
+  // THEN
+  ASSERT_EQ(response.blocks.size(), 1);
+  ASSERT_EQ(response.blocks[0].hash, block1_hash_);
+  ASSERT_EQ(response.blocks[0].header, block1_.header);
+  ASSERT_EQ(response.blocks[0].body, block1_.body);
+}
+
+class SynchronizerSessionTest : public SynchronizerTest {
+ public:
+  void SetUp() override {
+    SynchronizerTest::SetUp();
+
+    ON_CALL(*stream_, write(_, _, _))
+        .WillByDefault(Invoke([](gsl::span<const uint8_t>,
+                                 size_t size,
+                                 const basic::Writer::WriteCallbackFunc &cb) {
+          cb(size);
+        }));
+    ON_CALL(*stream_, read(_, _, _))
+        .WillByDefault(Invoke([this](gsl::span<uint8_t> out,
+                                     size_t size,
+                                     basic::Reader::ReadCallbackFunc cb) {
+          pending_read_ = {out, size, std::move(cb)};
+          readIncoming();
+        }));
+  }
+
+  /// Make the peer send \param response over the stream
+  void respond(const BlocksResponse &response) {
+    auto encoded = scale::encode(response).value();
+    auto varint = multi::UVarint{encoded.size()}.toVector();
+    incoming_.insert(incoming_.end(), varint.begin(), varint.end());
+    incoming_.insert(incoming_.end(), encoded.begin(), encoded.end());
+    readIncoming();
+  }
+
+  /// Complete the pending read of the stream with the sent bytes, if there are
+  /// enough of them
+  void readIncoming() {
+    while (pending_read_ and incoming_.size() >= pending_read_->size) {
+      auto [out, size, cb] = std::move(*pending_read_);
+      pending_read_.reset();
+      std::copy_n(incoming_.begin(), size, out.begin());
+      incoming_.erase(incoming_.begin(), incoming_.begin() + size);
+      cb(size);
+    }
+  }
+
+  BlocksRequest makeRequest(BlocksRequestId id) {
+    return {id,
+            BlocksRequest::kBasicAttributes,
+            block1_hash_,
+            boost::none,
+            Direction::ASCENDING,
+            boost::none};
+  }
+
+  struct PendingRead {
+    gsl::span<uint8_t> out;
+    size_t size;
+    basic::Reader::ReadCallbackFunc cb;
+  };
+
+  std::shared_ptr<StreamMock> stream_ = std::make_shared<StreamMock>();
+  std::vector<uint8_t> incoming_;
+  boost::optional<PendingRead> pending_read_;
+};
+
+/**
+ * @given synchronizer
+ * @when several requests are sent and the peer responds to them in another
+ * order
+ * @then requests are written to the same stream without waiting for the
+ * responses, and each response is matched with its request by id
+ */
+TEST_F(SynchronizerSessionTest, RequestsShareStream) {
+  EXPECT_CALL(*host_, newStream(peer_info_, kSyncPipelinedProtocol, _))
+      .WillOnce(testing::InvokeArgument<2>(stream_));
+  EXPECT_CALL(*stream_, write(_, _, _)).Times(2);
+
+  std::vector<BlocksRequestId> responded;
+  for (BlocksRequestId id : {1, 2}) {
+    synchronizer_->requestBlocks(
+        makeRequest(id), [&responded, id](auto &&response_res) {
+          ASSERT_TRUE(response_res);
+          ASSERT_EQ(response_res.value().id, id);
+          responded.push_back(id);
+        });
+  }
+
+  respond(BlocksResponse{2});
+  respond(BlocksResponse{1});
+
+  ASSERT_EQ(responded, (std::vector<BlocksRequestId>{2, 1}));
+}
+
+/**
+ * @given synchronizer
+ * @when the peer does not respond to a request in time
+ * @then the request is failed
+ */
+TEST_F(SynchronizerSessionTest, RequestTimesOut) {
+  SynchronizerConfig config{};
+  config.request_timeout = std::chrono::seconds{0};
+  synchronizer_ = std::make_shared<SynchronizerImpl>(
+      *host_, peer_info_, tree_, headers_, io_context_, config);
+
+  EXPECT_CALL(*host_, newStream(peer_info_, kSyncPipelinedProtocol, _))
+      .WillOnce(testing::InvokeArgument<2>(stream_));
+  EXPECT_CALL(*stream_, write(_, _, _));
+
+  boost::optional<outcome::result<BlocksResponse>> result;
+  synchronizer_->requestBlocks(makeRequest(1), [&result](auto &&response_res) {
+    result = response_res;
+  });
+  io_context_->run();
+
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result->error(), SynchronizerError::REQUEST_TIMEOUT);
+}
+
+/**
+ * @given synchronizer with a peer, which does not support the pipelined sync
+ * protocol
+ * @when two requests are sent
+ * @then the legacy protocol is used, and each request is sent over its own
+ * stream, which is closed after the response
+ */
+TEST_F(SynchronizerSessionTest, LegacyPeerIsSentRequestPerStream) {
+  outcome::result<std::shared_ptr<Stream>> not_supported =
+      std::make_error_code(std::errc::protocol_not_supported);
+  EXPECT_CALL(*host_, newStream(peer_info_, kSyncPipelinedProtocol, _))
+      .WillOnce(testing::InvokeArgument<2>(not_supported));
+  EXPECT_CALL(*host_, newStream(peer_info_, kSyncProtocol, _))
+      .Times(2)
+      .WillRepeatedly(testing::InvokeArgument<2>(stream_));
+  EXPECT_CALL(*stream_, close(_)).Times(2);
+  size_t writes = 0;
+  EXPECT_CALL(*stream_, write(_, _, _))
+      .Times(2)
+      .WillRepeatedly(Invoke([&writes](gsl::span<const uint8_t>,
+                                       size_t size,
+                                       const basic::Writer::WriteCallbackFunc
+                                           &cb) {
+        ++writes;
+        cb(size);
+      }));
+
+  std::vector<BlocksRequestId> responded;
+  for (BlocksRequestId id : {1, 2}) {
+    synchronizer_->requestBlocks(
+        makeRequest(id), [&responded, id](auto &&response_res) {
+          ASSERT_TRUE(response_res);
+          ASSERT_EQ(response_res.value().id, id);
+          responded.push_back(id);
+        });
+  }
+
+  // the second request waits for the response to the first one
+  ASSERT_EQ(writes, 1);
+  respond(BlocksResponse{1});
+  ASSERT_EQ(writes, 2);
+  respond(BlocksResponse{2});
+
+  ASSERT_EQ(responded, (std::vector<BlocksRequestId>{1, 2}));
+}
@@ -35,6 +35,7 @@ using kagome::primitives::BlockHeader;
 using kagome::primitives::ConsensusEngineId;
 using kagome::primitives::Digest;
 using kagome::primitives::Extrinsic;
+using kagome::primitives::HashedHeader;
 using kagome::primitives::InvalidTransaction;
 using kagome::primitives::PreRuntime;
 using kagome::primitives::TransactionValidity;
@@ -383,9 +384,11 @@ TEST_F(BlockValidatorTest, TwoBlocksByOnePeer) {
 
   auto [seal, pubkey] = sealBlock(valid_block_, encoded_block_copy_hash);
 
+  // full hash and pre-seal hash
   EXPECT_CALL(*hasher_, blake2b_256(_))
       .Times(2)
       .WillRepeatedly(Return(encoded_block_copy_hash));
+  HashedHeader hashed_header{valid_block_.header, hasher_};
 
   EXPECT_CALL(*sr25519_provider_, verify(_, _, pubkey))
       .Times(2)
@@ -461,3 +464,56 @@ TEST_F(BlockValidatorTest, InvalidExtrinsic) {
           valid_block_, authority.id, threshold_, randomness_));
   ASSERT_EQ(err, BabeBlockValidator::ValidationError::INVALID_TRANSACTIONS);
 }
+
+/**
+ * @given block validator
+ * @when validating signatures of the same header twice and then its producer
+ * @then signatures are valid both times, as this check does not remember the
+ * producer, while the second check of the producer fails; the header is hashed
+ * only once
+ */
+TEST_F(BlockValidatorTest, SignaturesDoNotRememberProducer) {
+  // GIVEN
+  auto block_copy = valid_block_;
+  block_copy.header.digest.pop_back();
+  auto encoded_block_copy = scale::encode(block_copy.header).value();
+  Hash256 encoded_block_copy_hash{};
+  std::copy(encoded_block_copy.begin(),
+            encoded_block_copy.begin() + Hash256::size(),
+            encoded_block_copy_hash.begin());
+
+  auto [seal, pubkey] = sealBlock(valid_block_, encoded_block_copy_hash);
+
+  // full hash and pre-seal hash
+  EXPECT_CALL(*hasher_, blake2b_256(_))
+      .Times(2)
+      .WillRepeatedly(Return(encoded_block_copy_hash));
+  HashedHeader hashed_header{valid_block_.header, hasher_};
+
+  EXPECT_CALL(*sr25519_provider_, verify(_, _, pubkey))
+      .Times(2)
+      .WillRepeatedly(Return(outcome::result<bool>(true)));
+
+  babe_epoch_.authorities.emplace_back();
+  auto authority = Authority{{pubkey}, 42};
+  babe_epoch_.authorities.emplace_back(authority);
+
+  auto randomness_with_slot =
+      Buffer{}.put(babe_epoch_.randomness).put(uint64_t_to_bytes(slot_number_));
+  EXPECT_CALL(*vrf_provider_, verify(randomness_with_slot, _, pubkey, _))
+      .Times(2)
+      .WillRepeatedly(
+          Return(VRFVerifyOutput{.is_valid = true, .is_less = true}));
+
+  // WHEN
+  for (auto i = 0; i < 2; ++i) {
+    EXPECT_OUTCOME_TRUE_1(validator_.validateHeaderSignatures(
+        hashed_header, authority.id, threshold_, randomness_));
+  }
+
+  // THEN
+  EXPECT_OUTCOME_TRUE_1(validator_.validateHeaderProducer(valid_block_.header));
+  EXPECT_OUTCOME_FALSE(
+      err, validator_.validateHeaderProducer(valid_block_.header));
+  ASSERT_EQ(err, BabeBlockValidator::ValidationError::TWO_BLOCKS_IN_SLOT);
+}
@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/batched_extrinsic_gossiper.hpp"
+
+#include <gtest/gtest.h>
+#include "mock/core/network/extrinsic_gossiper_mock.hpp"
+
+using kagome::network::BatchedExtrinsicGossiper;
+using kagome::network::ExtrinsicGossiperMock;
+using kagome::primitives::Transaction;
+
+using testing::_;
+using testing::SizeIs;
+
+class BatchedExtrinsicGossiperTest : public testing::Test {
+ public:
+  void makeGossiper(size_t max_batch_bytes) {
+    batched_gossiper_ = std::make_shared<BatchedExtrinsicGossiper>(
+        gossiper_,
+        io_context_,
+        BatchedExtrinsicGossiper::Params{max_batch_bytes,
+                                         std::chrono::milliseconds{1}});
+  }
+
+  /// Transaction of \param bytes size
+  static Transaction makeTx(size_t bytes) {
+    Transaction tx;
+    tx.bytes = bytes;
+    return tx;
+  }
+
+  void propagate(size_t bytes) {
+    auto tx = makeTx(bytes);
+    batched_gossiper_->propagateTransactions(gsl::make_span(&tx, 1));
+  }
+
+ protected:
+  std::shared_ptr<ExtrinsicGossiperMock> gossiper_ =
+      std::make_shared<ExtrinsicGossiperMock>();
+  std::shared_ptr<boost::asio::io_context> io_context_ =
+      std::make_shared<boost::asio::io_context>();
+  std::shared_ptr<BatchedExtrinsicGossiper> batched_gossiper_;
+};
+
+/**
+ * @given batched gossiper
+ * @when several small transactions are propagated
+ * @then they are sent as a single batch after the flush interval
+ */
+TEST_F(BatchedExtrinsicGossiperTest, SmallTransactionsAreSentOnTimer) {
+  makeGossiper(1000);
+  EXPECT_CALL(*gossiper_, propagateTransactions(_)).Times(0);
+  propagate(10);
+  propagate(10);
+  propagate(10);
+  testing::Mock::VerifyAndClearExpectations(gossiper_.get());
+
+  EXPECT_CALL(*gossiper_, propagateTransactions(SizeIs(3)));
+  io_context_->run();
+}
+
+/**
+ * @given batched gossiper
+ * @when transactions reach the size threshold of a batch
+ * @then the batch is sent at once, and the rest is sent after the flush
+ * interval
+ */
+TEST_F(BatchedExtrinsicGossiperTest, BatchIsSentWhenFull) {
+  makeGossiper(100);
+  EXPECT_CALL(*gossiper_, propagateTransactions(SizeIs(2)));
+  propagate(60);
+  propagate(60);
+  testing::Mock::VerifyAndClearExpectations(gossiper_.get());
+
+  EXPECT_CALL(*gossiper_, propagateTransactions(SizeIs(1)));
+  propagate(10);
+  io_context_->run();
+}
@@ -0,0 +1,240 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/gossiper_broadcast.hpp"
+
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+
+#include <gtest/gtest.h>
+#include "libp2p/multi/uvarint.hpp"
+#include "mock/core/crypto/hasher_mock.hpp"
+#include "mock/libp2p/connection/stream_mock.hpp"
+#include "mock/libp2p/host/host_mock.hpp"
+#include "network/common.hpp"
+#include "scale/scale.hpp"
+#include "testutil/literals.hpp"
+
+using kagome::common::Hash256;
+using kagome::consensus::grandpa::VoteMessage;
+using kagome::crypto::HasherMock;
+using kagome::network::BlockAnnounce;
+using kagome::network::GossiperBroadcast;
+using kagome::network::GossipMessage;
+using kagome::network::kGossipProtocol;
+using kagome::network::PeerList;
+using kagome::network::TransactionAnnounce;
+using kagome::primitives::Transaction;
+using libp2p::HostMock;
+using libp2p::basic::Writer;
+using libp2p::connection::Stream;
+using libp2p::connection::StreamMock;
+using libp2p::peer::PeerInfo;
+
+using testing::_;
+using testing::Invoke;
+using testing::InvokeArgument;
+using testing::Return;
+
+class GossiperBroadcastTest : public testing::Test {
+ public:
+  using Bytes = std::vector<uint8_t>;
+
+  void SetUp() override {
+    // distinct messages are given distinct hashes
+    ON_CALL(*hasher_, blake2b_256(_))
+        .WillByDefault(Invoke([](gsl::span<const uint8_t> data) {
+          auto h = std::hash<std::string_view>{}(
+              {reinterpret_cast<const char *>(data.data()), data.size()});
+          Hash256 hash{};
+          std::memcpy(hash.data(), &h, sizeof(h));
+          return hash;
+        }));
+    gossiper_ = std::make_shared<GossiperBroadcast>(
+        host_, PeerList{{peer_info_}}, hasher_);
+  }
+
+  /// Make open stream of the peer, written messages of which are recorded;
+  /// writes are completed at once, unless \param hold_writes is set
+  std::shared_ptr<StreamMock> makeStream(bool hold_writes = false) {
+    auto stream = std::make_shared<StreamMock>();
+    ON_CALL(*stream, isClosed()).WillByDefault(Return(false));
+    ON_CALL(*stream, remotePeerId()).WillByDefault(Return(peer_info_.id));
+    ON_CALL(*stream, write(_, _, _))
+        .WillByDefault(Invoke([this, hold_writes, stream = stream.get()](
+                                  gsl::span<const uint8_t> in,
+                                  size_t size,
+                                  Writer::WriteCallbackFunc cb) {
+          written_[stream].emplace_back(in.begin(), in.end());
+          if (hold_writes) {
+            held_writes_.emplace_back([cb = std::move(cb), size] { cb(size); });
+            return;
+          }
+          cb(size);
+        }));
+    return stream;
+  }
+
+  /// Complete the first of the held writes
+  void completeWrite() {
+    ASSERT_FALSE(held_writes_.empty());
+    auto complete = std::move(held_writes_.front());
+    held_writes_.pop_front();
+    complete();
+  }
+
+  void announce(kagome::primitives::BlockNumber number) {
+    gossiper_->blockAnnounce(makeAnnounce(number));
+  }
+
+  static BlockAnnounce makeAnnounce(kagome::primitives::BlockNumber number) {
+    BlockAnnounce announce;
+    announce.header.number = number;
+    return announce;
+  }
+
+  static GossipMessage announceMessage(
+      kagome::primitives::BlockNumber number) {
+    GossipMessage message;
+    message.type = GossipMessage::Type::BLOCK_ANNOUNCE;
+    message.data.put(kagome::scale::encode(makeAnnounce(number)).value());
+    return message;
+  }
+
+  /// @return bytes of \param message written to a stream
+  static Bytes written(const GossipMessage &message) {
+    auto encoded = kagome::scale::encode(message).value();
+    auto bytes = libp2p::multi::UVarint{encoded.size()}.toVector();
+    bytes.insert(bytes.end(), encoded.begin(), encoded.end());
+    return bytes;
+  }
+
+  HostMock host_;
+  PeerInfo peer_info_{"peer"_peerid, {}};
+  std::shared_ptr<HasherMock> hasher_ = std::make_shared<HasherMock>();
+  std::shared_ptr<GossiperBroadcast> gossiper_;
+
+  std::map<StreamMock *, std::vector<Bytes>> written_;
+  std::deque<std::function<void()>> held_writes_;
+};
+
+/**
+ * @given stream, which does not complete the writes
+ * @when more messages than the queue fits are gossiped, the last one is a
+ * consensus message
+ * @then the oldest queued announce is dropped, and the consensus message is
+ * written before the other queued announces
+ */
+TEST_F(GossiperBroadcastTest, QueueIsBoundedAndDropsAnnouncesFirst) {
+  auto stream = makeStream(true);
+  EXPECT_CALL(host_, newStream(peer_info_, kGossipProtocol, _))
+      .WillOnce(InvokeArgument<2>(std::shared_ptr<Stream>(stream)));
+
+  // the first announce is written at once, the others are queued
+  const auto kAnnounces = GossiperBroadcast::kMaxQueueSize + 1;
+  for (size_t i = 0; i < kAnnounces; ++i) {
+    announce(i);
+  }
+  VoteMessage vote;
+  vote.round_number = 42;
+  gossiper_->vote(vote);
+
+  while (not held_writes_.empty()) {
+    completeWrite();
+  }
+
+  GossipMessage consensus;
+  consensus.type = GossipMessage::Type::CONSENSUS;
+  consensus.data.put(kagome::scale::encode(vote).value());
+  std::vector<Bytes> expected{written(announceMessage(0)),
+                              written(consensus)};
+  for (size_t i = 2; i < kAnnounces; ++i) {
+    expected.push_back(written(announceMessage(i)));
+  }
+  ASSERT_EQ(written_[stream.get()], expected);
+}
+
+/**
+ * @given stream of the peer
+ * @when messages, which the peer has sent or has already got, are gossiped
+ * @then they are not sent to the peer again
+ */
+TEST_F(GossiperBroadcastTest, KnownMessagesAreNotSent) {
+  auto stream = makeStream();
+  EXPECT_CALL(host_, newStream(peer_info_, kGossipProtocol, _))
+      .WillOnce(InvokeArgument<2>(std::shared_ptr<Stream>(stream)));
+
+  gossiper_->markKnown(peer_info_.id, announceMessage(1));
+  announce(1);
+  announce(2);
+  announce(2);
+
+  ASSERT_EQ(written_[stream.get()],
+            (std::vector<Bytes>{written(announceMessage(2))}));
+}
+
+/**
+ * @given stream of the peer, which has sent a transaction announce
+ * @when the announced transaction is gossiped with another one
+ * @then only the other transaction is sent to the peer
+ */
+TEST_F(GossiperBroadcastTest, KnownTransactionsAreNotSent) {
+  auto stream = makeStream();
+  EXPECT_CALL(host_, newStream(peer_info_, kGossipProtocol, _))
+      .WillOnce(InvokeArgument<2>(std::shared_ptr<Stream>(stream)));
+  std::vector<Transaction> txs(2);
+  txs[0].ext.data = "known"_buf;
+  txs[1].ext.data = "unknown"_buf;
+  for (auto &tx : txs) {
+    tx.hash = hasher_->blake2b_256(tx.ext.data);
+  }
+
+  TransactionAnnounce received;
+  received.extrinsics.push_back(txs[0].ext);
+  gossiper_->markKnown(peer_info_.id, received);
+  gossiper_->propagateTransactions(txs);
+
+  TransactionAnnounce sent;
+  sent.extrinsics.push_back(txs[1].ext);
+  GossipMessage message;
+  message.type = GossipMessage::Type::TRANSACTIONS;
+  message.data.put(kagome::scale::encode(sent).value());
+  ASSERT_EQ(written_[stream.get()], (std::vector<Bytes>{written(message)}));
+}
+
+/**
+ * @given peer with incoming and outgoing streams
+ * @when one of its streams is closed, and then the other one
+ * @then known messages are not sent again while the peer has an open stream,
+ * and are forgotten with its last stream
+ */
+TEST_F(GossiperBroadcastTest, KnownMessagesAreForgottenWithLastStream) {
+  auto incoming = makeStream();
+  auto outgoing = makeStream();
+  auto reopened = makeStream();
+  EXPECT_CALL(host_, newStream(peer_info_, kGossipProtocol, _))
+      .WillOnce(InvokeArgument<2>(std::shared_ptr<Stream>(outgoing)))
+      .WillOnce(InvokeArgument<2>(std::shared_ptr<Stream>(reopened)));
+  gossiper_->addStream(incoming);
+
+  // the message is sent to the peer once
+  announce(1);
+  ASSERT_EQ(written_[incoming.get()],
+            (std::vector<Bytes>{written(announceMessage(1))}));
+  ASSERT_TRUE(written_[outgoing.get()].empty());
+
+  ON_CALL(*incoming, isClosed()).WillByDefault(Return(true));
+  announce(2);
+  announce(1);
+  ASSERT_EQ(written_[outgoing.get()],
+            (std::vector<Bytes>{written(announceMessage(2))}));
+
+  ON_CALL(*outgoing, isClosed()).WillByDefault(Return(true));
+  announce(1);
+  ASSERT_EQ(written_[reopened.get()],
+            (std::vector<Bytes>{written(announceMessage(1))}));
+}
@@ -0,0 +1,86 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/helpers/blocks_response_decoder.hpp"
+
+#include <gtest/gtest.h>
+#include "scale/scale.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/primitives/mp_utils.hpp"
+
+using kagome::network::BlocksResponse;
+using kagome::network::BlocksResponseDecoder;
+using kagome::primitives::BlockData;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::Extrinsic;
+
+using testutil::createHash256;
+
+class BlocksResponseDecoderTest : public testing::TestWithParam<size_t> {
+ public:
+  void SetUp() override {
+    for (uint8_t i = 1; i <= 3; ++i) {
+      BlockData block_data{createHash256({i})};
+      block_data.header = BlockHeader{createHash256({i, i}), i};
+      block_data.body = kagome::primitives::BlockBody{
+          Extrinsic{kagome::common::Buffer(100u * i, i)}};
+      response_.blocks.push_back(block_data);
+    }
+    encoded_ = kagome::scale::encode(response_).value();
+  }
+
+  BlocksResponse response_{42};
+  std::vector<uint8_t> encoded_;
+};
+
+/**
+ * @given encoded blocks response
+ * @when it is fed to the decoder by parts of different sizes
+ * @then the decoded response is the original one
+ */
+TEST_P(BlocksResponseDecoderTest, DecodesByParts) {
+  auto part_size = GetParam();
+  BlocksResponseDecoder decoder{encoded_.size()};
+
+  for (size_t offset = 0; offset < encoded_.size(); offset += part_size) {
+    ASSERT_FALSE(decoder.finished());
+    auto size = std::min(part_size, encoded_.size() - offset);
+    EXPECT_OUTCOME_TRUE_1(
+        decoder.feed(gsl::make_span(encoded_.data() + offset, size)));
+  }
+
+  ASSERT_TRUE(decoder.finished());
+  ASSERT_EQ(decoder.takeResponse(), response_);
+}
+
+INSTANTIATE_TEST_CASE_P(PartSizes,
+                        BlocksResponseDecoderTest,
+                        testing::Values(1, 7, 64, 1024));
+
+/**
+ * @given encoded blocks response without its last byte
+ * @when it is fed to the decoder, which expects message of that size
+ * @then the decoder fails
+ */
+TEST_F(BlocksResponseDecoderTest, TruncatedMessageFails) {
+  encoded_.pop_back();
+  BlocksResponseDecoder decoder{encoded_.size()};
+
+  EXPECT_OUTCOME_FALSE(err, decoder.feed(encoded_));
+  ASSERT_EQ(err, BlocksResponseDecoder::Error::UNEXPECTED_END);
+}
+
+/**
+ * @given encoded blocks response followed by an extra byte
+ * @when it is fed to the decoder, which expects message of that size
+ * @then the decoder fails
+ */
+TEST_F(BlocksResponseDecoderTest, ExtraDataFails) {
+  encoded_.push_back(0);
+  BlocksResponseDecoder decoder{encoded_.size()};
+
+  EXPECT_OUTCOME_FALSE(err, decoder.feed(encoded_));
+  ASSERT_EQ(err, BlocksResponseDecoder::Error::EXTRA_DATA);
+}
@@ -0,0 +1,115 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "primitives/hashed_header.hpp"
+
+#include <gtest/gtest.h>
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/crypto/hasher_mock.hpp"
+#include "scale/scale.hpp"
+
+using kagome::common::Buffer;
+using kagome::crypto::HasherImpl;
+using kagome::crypto::HasherMock;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::Consensus;
+using kagome::primitives::HashedHeader;
+using kagome::primitives::PreRuntime;
+using kagome::primitives::Seal;
+
+using testing::_;
+using testing::Invoke;
+
+class HashedHeaderTest : public testing::Test {
+ public:
+  void SetUp() override {
+    header_.number = 42;
+    header_.parent_hash.fill(1);
+    header_.state_root.fill(2);
+    header_.extrinsics_root.fill(3);
+    header_.digest.emplace_back(PreRuntime{});
+    header_.digest.emplace_back(Consensus{});
+    header_.digest.emplace_back(Seal{});
+  }
+
+  /// @return encoding of a copy of \param header without its last digest
+  static std::vector<uint8_t> encodeUnsealed(const BlockHeader &header) {
+    auto unsealed_header = header;
+    unsealed_header.digest.pop_back();
+    return kagome::scale::encode(unsealed_header).value();
+  }
+
+  std::shared_ptr<HasherImpl> hasher_ = std::make_shared<HasherImpl>();
+  BlockHeader header_;
+};
+
+/**
+ * @given block header with several digests
+ * @when hashed header is created from it
+ * @then encoded form and hash are the ones of the header, pre-seal hash is the
+ * hash of the header without the last digest
+ */
+TEST_F(HashedHeaderTest, MemoizesEncodingAndHashes) {
+  HashedHeader hashed_header{header_, hasher_};
+
+  auto encoded = kagome::scale::encode(header_).value();
+  ASSERT_EQ(hashed_header.header(), header_);
+  ASSERT_EQ(hashed_header.encoded(), Buffer{encoded});
+  ASSERT_EQ(hashed_header.hash(), hasher_->blake2b_256(encoded));
+
+  auto encoded_unsealed = encodeUnsealed(header_);
+  ASSERT_TRUE(hashed_header.preSealHash());
+  ASSERT_EQ(*hashed_header.preSealHash(),
+            hasher_->blake2b_256(encoded_unsealed));
+}
+
+/**
+ * @given block header without digests
+ * @when hashed header is created from it
+ * @then it has no pre-seal hash
+ */
+TEST_F(HashedHeaderTest, NoPreSealHashWithoutDigests) {
+  header_.digest.clear();
+  HashedHeader hashed_header{header_, hasher_};
+
+  ASSERT_EQ(hashed_header.hash(),
+            hasher_->blake2b_256(kagome::scale::encode(header_).value()));
+  ASSERT_FALSE(hashed_header.preSealHash());
+}
+
+/**
+ * @given block header with several digests
+ * @when hashed header is created from it, and its pre-seal hash is taken twice
+ * @then the pre-seal hash is computed once on the first use
+ */
+TEST_F(HashedHeaderTest, PreSealHashIsLazy) {
+  auto hasher = std::make_shared<HasherMock>();
+  auto hash = [this](gsl::span<const uint8_t> data) {
+    return hasher_->blake2b_256(data);
+  };
+  EXPECT_CALL(*hasher, blake2b_256(_)).WillOnce(Invoke(hash));
+  HashedHeader hashed_header{header_, hasher};
+  testing::Mock::VerifyAndClearExpectations(hasher.get());
+
+  EXPECT_CALL(*hasher, blake2b_256(_)).WillOnce(Invoke(hash));
+  auto pre_seal_hash = hasher_->blake2b_256(encodeUnsealed(header_));
+  ASSERT_EQ(*hashed_header.preSealHash(), pre_seal_hash);
+  ASSERT_EQ(*hashed_header.preSealHash(), pre_seal_hash);
+}
+
+/**
+ * @given block headers with one and with several digests
+ * @when they are encoded without the seal
+ * @then the encoding is the one of the header copy without the last digest
+ */
+TEST_F(HashedHeaderTest, EncodePreSealMatchesHeaderEncoding) {
+  ASSERT_EQ(HashedHeader::encodePreSeal(header_), encodeUnsealed(header_));
+
+  BlockHeader sealed_only = header_;
+  sealed_only.digest.clear();
+  sealed_only.digest.emplace_back(Seal{});
+  ASSERT_EQ(HashedHeader::encodePreSeal(sealed_only),
+            encodeUnsealed(sealed_only));
+}
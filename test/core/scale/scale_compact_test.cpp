@@ -144,3 +144,97 @@ TEST(Scale, compactDecodeBigIntegerError) {
   ASSERT_EQ(err.value(),
             static_cast<int>(kagome::scale::DecodeError::NOT_ENOUGH_DATA));
 }
+
+/**
+ * @given values of unsigned integer types at the bounds of the encoding
+ * categories
+ * @when they are compact-encoded and decoded without big integers
+ * @then the encoding matches the one of CompactInteger and the values are
+ * decoded back
+ */
+TEST(ScaleCompactTest, FastPathMatchesCompactInteger) {
+  using kagome::scale::detail::compactSize;
+  using kagome::scale::detail::decodeCompact;
+  using kagome::scale::detail::encodeCompact;
+  using Uint128 = boost::multiprecision::uint128_t;
+
+  auto check = [](auto value) {
+    using T = decltype(value);
+    ScaleEncoderStream expected;
+    expected << CompactInteger(value);
+    ScaleEncoderStream out;
+    encodeCompact(value, out);
+    ASSERT_EQ(out.data(), expected.data());
+    ASSERT_EQ(compactSize(value), out.data().size());
+
+    auto bytes = out.data();
+    ScaleDecoderStream in(gsl::make_span(bytes));
+    ASSERT_EQ(decodeCompact<T>(in), value);
+    ASSERT_FALSE(in.hasMore(1));
+  };
+
+  check(uint8_t{0});
+  check(uint8_t{63});
+  check(uint8_t{64});
+  check(uint8_t{255});
+  check(uint16_t{16383});
+  check(uint16_t{16384});
+  check(uint16_t{65535});
+  check(uint32_t{1073741823ul});
+  check(uint32_t{1073741824ul});
+  check(std::numeric_limits<uint32_t>::max());
+  check(uint64_t{1ull << 40u});
+  check(std::numeric_limits<uint64_t>::max());
+  check(Uint128{std::numeric_limits<uint64_t>::max()} + 1);
+  check(std::numeric_limits<Uint128>::max());
+}
+
+/**
+ * @given encoded compact integer, which exceeds the target type
+ * @when it is decoded into the type
+ * @then COMPACT_INTEGER_TOO_BIG error is raised
+ */
+TEST(ScaleCompactTest, FastPathDecodeTooBigFails) {
+  using kagome::scale::DecodeError;
+  using kagome::scale::detail::decodeCompact;
+
+  // @return error of decoding \param bytes into the type of \param type
+  auto errorOf = [](ByteArray bytes, auto type) -> std::error_code {
+    ScaleDecoderStream in(gsl::make_span(bytes));
+    try {
+      decodeCompact<decltype(type)>(in);
+    } catch (const std::system_error &e) {
+      return e.code();
+    }
+    return {};
+  };
+  auto too_big = make_error_code(DecodeError::COMPACT_INTEGER_TOO_BIG);
+
+  // 64 is encoded by 2 bytes, but fits into uint8_t
+  ASSERT_FALSE(errorOf({1, 1}, uint8_t{}));
+  // 256
+  ASSERT_EQ(errorOf({1, 4}, uint8_t{}), too_big);
+  // 2^64
+  ASSERT_EQ(errorOf({0b10111, 0, 0, 0, 0, 0, 0, 0, 0, 1}, uint64_t{}),
+            too_big);
+  // trailing zero bytes do not make the value too big
+  ASSERT_FALSE(errorOf({0b10111, 1, 0, 0, 0, 0, 0, 0, 0, 0}, uint64_t{}));
+}
+
+/**
+ * @given collection, which size is encoded as a multibyte compact integer
+ * @when it is encoded and decoded
+ * @then the size is written without big integers and read back
+ */
+TEST(ScaleCompactTest, CollectionSizeIsMultibyte) {
+  std::vector<uint8_t> collection(1u << 14u, 0xAB);
+  ScaleEncoderStream out;
+  out << collection;
+  auto bytes = out.data();
+  ASSERT_EQ(bytes.size(), 4 + collection.size());
+  ASSERT_EQ(ByteArray(bytes.begin(), bytes.begin() + 4),
+            (ByteArray{2, 0, 1, 0}));
+
+  EXPECT_OUTCOME_TRUE(decoded, decode<std::vector<uint8_t>>(bytes));
+  ASSERT_EQ(decoded, collection);
+}
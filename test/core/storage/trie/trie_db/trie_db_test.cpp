@@ -15,6 +15,7 @@
 
 using kagome::common::Buffer;
 using kagome::common::Hash256;
+using kagome::storage::InMemoryStorage;
 using kagome::storage::LevelDB;
 using kagome::storage::trie::PolkadotTrieDb;
 using kagome::storage::trie::TrieDbBackendImpl;
@@ -268,6 +269,69 @@ TEST_F(TrieTest, Put) {
   ASSERT_EQ(v3, ""_buf);
 }
 
+/**
+ * @given a small trie
+ * @when reading several keys at once, some of them absent or repeated
+ * @then values are returned in the order of the keys
+ */
+TEST_F(TrieTest, GetMany) {
+  FillSmallTree(*trie);
+
+  std::vector<Buffer> keys{"0a0b0c"_hex2buf,
+                           "0a0b"_hex2buf,
+                           "1234"_hex2buf,
+                           "0a0b0c"_hex2buf};
+  EXPECT_OUTCOME_TRUE(values, trie->getMany(keys));
+  ASSERT_EQ(values,
+            (std::vector<boost::optional<Buffer>>{"deadbeef"_hex2buf,
+                                                  boost::none,
+                                                  "1234"_hex2buf,
+                                                  "deadbeef"_hex2buf}));
+}
+
+/**
+ * In-memory storage, which counts the reads
+ */
+class CountingStorage : public InMemoryStorage {
+ public:
+  outcome::result<Buffer> get(const Buffer &key) const override {
+    ++reads;
+    return InMemoryStorage::get(key);
+  }
+
+  mutable size_t reads{0};
+};
+
+/**
+ * @given a small trie
+ * @when reading all its keys at once
+ * @then the same values are read as by separate reads, but the nodes on the
+ * common paths are read from the storage once
+ */
+TEST(TrieGetManyTest, CommonNodesAreReadOnce) {
+  auto storage = std::make_shared<CountingStorage>();
+  auto trie = PolkadotTrieDb::createEmpty(
+      std::make_shared<TrieDbBackendImpl>(storage, kNodePrefix));
+  FillSmallTree(*trie);
+  std::vector<Buffer> keys;
+  for (auto &entry : TrieTest::data) {
+    keys.push_back(entry.first);
+  }
+
+  storage->reads = 0;
+  std::vector<boost::optional<Buffer>> expected;
+  for (auto &key : keys) {
+    EXPECT_OUTCOME_TRUE(value, trie->get(key));
+    expected.emplace_back(value);
+  }
+  auto separate_reads = storage->reads;
+
+  storage->reads = 0;
+  EXPECT_OUTCOME_TRUE(values, trie->getMany(keys));
+  ASSERT_EQ(values, expected);
+  ASSERT_LT(storage->reads, separate_reads);
+}
+
 /**
  * @given a small trie
  * @when removing some entries from it
@@ -0,0 +1,165 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "transaction_pool/impl/pool_revalidator_impl.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "mock/core/blockchain/header_repository_mock.hpp"
+#include "mock/core/crypto/hasher_mock.hpp"
+#include "mock/core/runtime/tagged_transaction_queue_mock.hpp"
+#include "mock/core/storage/trie/trie_db_mock.hpp"
+#include "mock/core/transaction_pool/pool_moderator_mock.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "transaction_pool/impl/transaction_pool_impl.hpp"
+
+using kagome::blockchain::HeaderRepositoryMock;
+using kagome::common::Buffer;
+using kagome::common::Hash256;
+using kagome::crypto::HasherMock;
+using kagome::primitives::Block;
+using kagome::primitives::Extrinsic;
+using kagome::primitives::InvalidTransaction;
+using kagome::primitives::Transaction;
+using kagome::primitives::TransactionValidity;
+using kagome::primitives::TransactionValidityError;
+using kagome::primitives::UnknownTransaction;
+using kagome::primitives::ValidTransaction;
+using kagome::runtime::TaggedTransactionQueueMock;
+using kagome::storage::trie::TrieDbMock;
+using kagome::transaction_pool::PoolModeratorMock;
+using kagome::transaction_pool::PoolRevalidatorImpl;
+using kagome::transaction_pool::TransactionPoolImpl;
+
+using testing::_;
+using testing::InSequence;
+using testing::NiceMock;
+using testing::Return;
+
+class PoolRevalidatorTest : public testing::Test {
+ public:
+  void SetUp() override {
+    ON_CALL(*hasher_, blake2b_256(_))
+        .WillByDefault(testing::Invoke([](auto data) {
+          Hash256 hash{};
+          hash[0] = data[0];
+          return hash;
+        }));
+    ON_CALL(*trie_db_, getRootHash()).WillByDefault(Return(Buffer{}));
+    ON_CALL(*trie_db_, resetState(_))
+        .WillByDefault(Return(outcome::success()));
+  }
+
+  void makeRevalidator(size_t batch_size) {
+    revalidator_ = std::make_shared<PoolRevalidatorImpl>(
+        pool_,
+        tx_queue_,
+        trie_db_,
+        hasher_,
+        io_context_,
+        PoolRevalidatorImpl::Params{batch_size});
+  }
+
+  /// Transaction, which extrinsic and hash are made of \param id
+  static Transaction makeTx(uint8_t id,
+                            std::vector<Transaction::Tag> provides,
+                            std::vector<Transaction::Tag> requires) {
+    Transaction tx;
+    tx.ext = Extrinsic{Buffer{id}};
+    tx.hash[0] = id;
+    tx.provides = std::move(provides);
+    tx.requires = std::move(requires);
+    return tx;
+  }
+
+  static TransactionValidity valid(std::vector<Transaction::Tag> provides,
+                                   std::vector<Transaction::Tag> requires) {
+    ValidTransaction v;
+    v.provides = std::move(provides);
+    v.requires = std::move(requires);
+    return v;
+  }
+
+  static TransactionValidity invalid() {
+    return TransactionValidityError{InvalidTransaction::Stale};
+  }
+
+ protected:
+  std::shared_ptr<TransactionPoolImpl> pool_ =
+      std::make_shared<TransactionPoolImpl>(
+          std::make_unique<NiceMock<PoolModeratorMock>>(),
+          std::make_unique<HeaderRepositoryMock>(),
+          TransactionPoolImpl::Limits{10, 10});
+  std::shared_ptr<TaggedTransactionQueueMock> tx_queue_ =
+      std::make_shared<TaggedTransactionQueueMock>();
+  std::shared_ptr<TrieDbMock> trie_db_ =
+      std::make_shared<NiceMock<TrieDbMock>>();
+  std::shared_ptr<HasherMock> hasher_ = std::make_shared<NiceMock<HasherMock>>();
+  std::shared_ptr<boost::asio::io_context> io_context_ =
+      std::make_shared<boost::asio::io_context>();
+  std::shared_ptr<PoolRevalidatorImpl> revalidator_;
+};
+
+/**
+ * @given pool with a transaction, its dependent and an unrelated transaction
+ * @when a block with the first transaction is imported
+ * @then the included transaction is removed, the dependent one is
+ * re-validated first and becomes ready with the updated tags, the unrelated
+ * one becomes invalid and is removed
+ */
+TEST_F(PoolRevalidatorTest, DependentsAreRevalidatedFirst) {
+  makeRevalidator(PoolRevalidatorImpl::kDefaultBatchSize);
+  EXPECT_OUTCOME_TRUE_1(pool_->submit({makeTx(1, {{1}}, {}),
+                                       makeTx(2, {{2}}, {{1}}),
+                                       makeTx(3, {{3}}, {})}));
+  ASSERT_EQ(pool_->getStatus().ready_num, 3);
+
+  {
+    InSequence s;
+    EXPECT_CALL(*tx_queue_, validate_transaction(Extrinsic{Buffer{2}}))
+        .WillOnce(Return(valid({{2}}, {})));
+    EXPECT_CALL(*tx_queue_, validate_transaction(Extrinsic{Buffer{3}}))
+        .WillOnce(Return(invalid()));
+  }
+
+  revalidator_->onBlockImported(Block{{}, {Extrinsic{Buffer{1}}}});
+  ASSERT_FALSE(pool_->getTransaction(Hash256{{1}}));
+  EXPECT_EQ(pool_->getStatus().waiting_num, 1);
+  ASSERT_EQ(revalidator_->queueSize(), 2);
+
+  io_context_->run();
+  ASSERT_EQ(revalidator_->queueSize(), 0);
+  EXPECT_EQ(pool_->getStatus().waiting_num, 0);
+  ASSERT_EQ(pool_->getStatus().ready_num, 1);
+  auto tx = pool_->getTransaction(Hash256{{2}});
+  ASSERT_TRUE(tx);
+  ASSERT_TRUE(tx->requires.empty());
+}
+
+/**
+ * @given pool with several transactions and a revalidator with batches of a
+ * single transaction
+ * @when a block is imported
+ * @then a single transaction is re-validated per handler of the io_context
+ */
+TEST_F(PoolRevalidatorTest, RevalidatedInBatches) {
+  makeRevalidator(1);
+  EXPECT_OUTCOME_TRUE_1(
+      pool_->submit({makeTx(1, {{1}}, {}), makeTx(2, {{2}}, {})}));
+  EXPECT_CALL(*tx_queue_, validate_transaction(_))
+      .Times(2)
+      .WillRepeatedly(Return(TransactionValidity{
+          TransactionValidityError{UnknownTransaction::CannotLookup}}));
+
+  revalidator_->onBlockImported(Block{});
+  ASSERT_EQ(revalidator_->queueSize(), 2);
+
+  ASSERT_EQ(io_context_->run_one(), 1);
+  ASSERT_EQ(revalidator_->queueSize(), 1);
+  ASSERT_EQ(io_context_->run_one(), 1);
+  ASSERT_EQ(revalidator_->queueSize(), 0);
+  ASSERT_EQ(io_context_->poll(), 0);
+}
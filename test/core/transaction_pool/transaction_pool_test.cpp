@@ -51,12 +51,14 @@ class TransactionPoolTest : public testing::Test {
 Transaction makeTx(Transaction::Hash hash,
                    std::initializer_list<Transaction::Tag> provides,
                    std::initializer_list<Transaction::Tag> requires,
-                   Transaction::Longevity valid_till = 10000) {
+                   Transaction::Longevity valid_till = 10000,
+                   Transaction::Priority priority = 0) {
   Transaction tx;
   tx.hash = std::move(hash);
   tx.provides = std::vector(provides);
   tx.requires = std::vector(requires);
   tx.valid_till = valid_till;
+  tx.priority = priority;
   return tx;
 }
 
@@ -134,3 +136,58 @@ TEST_F(TransactionPoolTest, CorrectRemoveTx) {
     EXPECT_EQ(outcome.error(), TransactionPoolError::TX_NOT_FOUND);
   }
 }
+
+/**
+ * @given transaction pool with ready transactions of different priorities,
+ * some of which depend on others
+ * @when ready transactions are iterated
+ * @then transactions with higher priority go first, but no transaction goes
+ * before the transaction it depends on
+ */
+TEST_F(TransactionPoolTest, ReadyIteratedByPriorityAndDependencies) {
+  pool_ = std::make_shared<TransactionPoolImpl>(
+      std::make_unique<NiceMock<PoolModeratorMock>>(),
+      std::make_unique<HeaderRepositoryMock>(),
+      TransactionPoolImpl::Limits{10, 10});
+  EXPECT_OUTCOME_TRUE_1(
+      pool_->submit({makeTx("01"_hash256, {{1}}, {}, 10000, 1),
+                     makeTx("02"_hash256, {{2}}, {{1}}, 10000, 100),
+                     makeTx("03"_hash256, {{3}}, {}, 10000, 50),
+                     makeTx("04"_hash256, {{4}}, {}, 10000, 5),
+                     makeTx("05"_hash256, {{5}}, {{2}, {4}}, 10000, 200)}));
+  ASSERT_EQ(pool_->getStatus().ready_num, 5);
+
+  std::vector<Hash256> order;
+  auto ready = pool_->getReadyIterator();
+  while (auto tx = ready->next()) {
+    order.push_back(tx->hash);
+  }
+  ASSERT_EQ(order,
+            (std::vector<Hash256>{"03"_hash256,
+                                  "04"_hash256,
+                                  "01"_hash256,
+                                  "02"_hash256,
+                                  "05"_hash256}));
+}
+
+/**
+ * @given transaction pool with a chain of dependent transactions
+ * @when the first transaction is removed and then imported again
+ * @then its dependents become waiting, and then ready again
+ */
+TEST_F(TransactionPoolTest, ReimportedTransactionResolvesDependents) {
+  std::vector<Transaction> txs{makeTx("01"_hash256, {{1}}, {}),
+                               makeTx("02"_hash256, {{2}}, {{1}}),
+                               makeTx("03"_hash256, {{3}}, {{1}, {2}})};
+  EXPECT_OUTCOME_TRUE_1(pool_->submit(txs));
+  ASSERT_EQ(pool_->getStatus().ready_num, 3);
+
+  EXPECT_OUTCOME_TRUE_1(pool_->removeOne("01"_hash256));
+  EXPECT_EQ(pool_->getStatus().waiting_num, 2);
+  ASSERT_EQ(pool_->getStatus().ready_num, 0);
+
+  EXPECT_OUTCOME_TRUE_1(pool_->submitOne(Transaction{txs[0]}));
+  EXPECT_EQ(pool_->getStatus().waiting_num, 0);
+  ASSERT_EQ(pool_->getStatus().ready_num, 3);
+  ASSERT_EQ(pool_->getReadyTransactions().size(), 3);
+}
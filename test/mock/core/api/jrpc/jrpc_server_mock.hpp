@@ -18,7 +18,7 @@ namespace kagome::api {
 
     MOCK_METHOD2(registerHandler, void(const std::string &name, Method method));
     MOCK_METHOD2(processData,
-                 void(std::string_view request, const ResponseHandler &cb));
+                 void(const std::string &request, const ResponseHandler &cb));
   };
 
 }  // namespace kagome::api
@@ -24,6 +24,11 @@ namespace kagome::api {
         getStorage,
         outcome::result<common::Buffer>(const common::Buffer &key,
                                         const primitives::BlockHash &at));
+    MOCK_CONST_METHOD2(
+        queryStorageAt,
+        outcome::result<StorageValues>(
+            const std::vector<common::Buffer> &keys,
+            const boost::optional<primitives::BlockHash> &at));
   };
 }  // namespace kagome::api
 
@@ -8,12 +8,16 @@
 
 #include "api/transport/session.hpp"
 
+#include <gmock/gmock.h>
+
 namespace kagome::api {
   class SessionMock : public Session {
    public:
     ~SessionMock() override = default;
     MOCK_METHOD0(start, void());
-    MOCK_METHOD1(respond, void(std::string_view));
+    MOCK_METHOD1(respond, void(std::string));
+    MOCK_CONST_METHOD0(isPushSupported, bool());
+    MOCK_METHOD1(push, void(std::string));
   };
 }  // namespace kagome::api
 
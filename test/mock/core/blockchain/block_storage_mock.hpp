@@ -33,6 +33,10 @@ namespace kagome::blockchain {
                  outcome::result<primitives::BlockHash>(
                      const primitives::BlockHeader &header));
 
+    MOCK_METHOD1(putBlockHeader,
+                 outcome::result<primitives::BlockHash>(
+                     const primitives::HashedHeader &header));
+
     MOCK_METHOD2(
         putBlockData,
         outcome::result<void>(primitives::BlockNumber,
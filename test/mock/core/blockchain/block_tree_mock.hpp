@@ -27,6 +27,9 @@ namespace kagome::blockchain {
     MOCK_METHOD1(addBlockHeader,
                  outcome::result<void>(const primitives::BlockHeader &));
 
+    MOCK_METHOD1(addBlockHeader,
+                 outcome::result<void>(const primitives::HashedHeader &));
+
     MOCK_METHOD3(
         addBlockBody,
         outcome::result<void>(primitives::BlockNumber block_number,
@@ -51,6 +54,10 @@ namespace kagome::blockchain {
                  BlockHashVecRes(const primitives::BlockHash &,
                                  const primitives::BlockHash &));
 
+    MOCK_CONST_METHOD2(hasDirectChain,
+                       bool(const primitives::BlockHash &,
+                            const primitives::BlockHash &));
+
     MOCK_CONST_METHOD2(getBestContaining,
                        outcome::result<primitives::BlockInfo>(
                            const primitives::BlockHash &,
@@ -67,6 +74,8 @@ namespace kagome::blockchain {
     MOCK_CONST_METHOD0(getLastFinalized, primitives::BlockInfo());
 
     MOCK_METHOD0(prune, outcome::result<void>());
+
+    MOCK_METHOD1(addObserver, void(std::weak_ptr<BlockTreeObserver>));
   };
 }  // namespace kagome::blockchain
 
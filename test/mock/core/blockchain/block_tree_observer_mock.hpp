@@ -0,0 +1,23 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_BLOCK_TREE_OBSERVER_MOCK_HPP
+#define KAGOME_BLOCK_TREE_OBSERVER_MOCK_HPP
+
+#include "blockchain/block_tree_observer.hpp"
+
+#include <gmock/gmock.h>
+
+namespace kagome::blockchain {
+  struct BlockTreeObserverMock : public BlockTreeObserver {
+    MOCK_METHOD1(onBlockAdded, void(const primitives::BlockInfo &));
+
+    MOCK_METHOD1(onBlockFinalized, void(const primitives::BlockInfo &));
+
+    MOCK_METHOD1(onBlockPruned, void(const primitives::BlockInfo &));
+  };
+}  // namespace kagome::blockchain
+
+#endif  // KAGOME_BLOCK_TREE_OBSERVER_MOCK_HPP
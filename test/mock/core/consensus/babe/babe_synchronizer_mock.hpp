@@ -14,10 +14,11 @@ namespace kagome::consensus {
 
   class BabeSynchronizerMock : public BabeSynchronizer {
    public:
-    MOCK_METHOD3(request,
-                 void(const primitives::BlockId &,
-                      const primitives::BlockHash &,
-                      const BlocksHandler &));
+    MOCK_METHOD4(request,
+                 void(const primitives::BlockInfo &,
+                      const primitives::BlockInfo &,
+                      const BlocksHandler &,
+                      const FinishedHandler &));
   };
 
 }  // namespace kagome::consensus
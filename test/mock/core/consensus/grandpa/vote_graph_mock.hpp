@@ -34,6 +34,9 @@ namespace kagome::consensus::grandpa {
     MOCK_METHOD2(findGhost,
                  boost::optional<BlockInfo>(const boost::optional<BlockInfo> &,
                                             const Condition &));
+    MOCK_CONST_METHOD2(findAncestorBlockBy,
+                       boost::optional<BlockHash>(const BlockHash &,
+                                                  BlockNumber));
   };
 
 }  // namespace kagome::consensus::grandpa
@@ -27,6 +27,17 @@ namespace kagome::consensus {
                               const primitives::AuthorityId &authority_id,
                               const Threshold &threshold,
                               const Randomness &randomness));
+
+    MOCK_CONST_METHOD4(
+        validateHeaderSignatures,
+        outcome::result<void>(const primitives::HashedHeader &header,
+                              const primitives::AuthorityId &authority_id,
+                              const Threshold &threshold,
+                              const Randomness &randomness));
+
+    MOCK_CONST_METHOD1(
+        validateHeaderProducer,
+        outcome::result<void>(const primitives::BlockHeader &header));
   };
 
 }  // namespace kagome::consensus
@@ -0,0 +1,28 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TEST_MOCK_CORE_NETWORK_EXTRINSIC_GOSSIPER_MOCK_HPP
+#define KAGOME_TEST_MOCK_CORE_NETWORK_EXTRINSIC_GOSSIPER_MOCK_HPP
+
+#include "network/extrinsic_gossiper.hpp"
+
+#include <gmock/gmock.h>
+
+namespace kagome::network {
+
+  class ExtrinsicGossiperMock : public ExtrinsicGossiper {
+   public:
+    void propagateTransactions(
+        gsl::span<const primitives::Transaction> txs) override {
+      propagateTransactions(std::vector<primitives::Transaction>(txs.begin(),
+                                                                 txs.end()));
+    }
+    MOCK_METHOD1(propagateTransactions,
+                 void(std::vector<primitives::Transaction>));
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_TEST_MOCK_CORE_NETWORK_EXTRINSIC_GOSSIPER_MOCK_HPP
@@ -0,0 +1,24 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TEST_MOCK_CORE_NETWORK_SYNC_PROTOCOL_CLIENT_MOCK_HPP
+#define KAGOME_TEST_MOCK_CORE_NETWORK_SYNC_PROTOCOL_CLIENT_MOCK_HPP
+
+#include "network/sync_protocol_client.hpp"
+
+#include <gmock/gmock.h>
+
+namespace kagome::network {
+
+  class SyncProtocolClientMock : public SyncProtocolClient {
+   public:
+    MOCK_METHOD2(requestBlocks,
+                 void(const BlocksRequest &,
+                      std::function<void(outcome::result<BlocksResponse>)>));
+  };
+
+}  // namespace kagome::network
+
+#endif  // KAGOME_TEST_MOCK_CORE_NETWORK_SYNC_PROTOCOL_CLIENT_MOCK_HPP
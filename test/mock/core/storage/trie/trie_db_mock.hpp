@@ -29,6 +29,11 @@ namespace kagome::storage::trie {
 
     MOCK_CONST_METHOD1(contains, bool(const common::Buffer &));
 
+    MOCK_CONST_METHOD1(
+        getMany,
+        outcome::result<std::vector<boost::optional<common::Buffer>>>(
+            gsl::span<const common::Buffer>));
+
     MOCK_METHOD2(put,
                  outcome::result<void>(const common::Buffer &,
                                        const common::Buffer &));
@@ -0,0 +1,22 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TEST_MOCK_CORE_TRANSACTION_POOL_POOL_REVALIDATOR_MOCK_HPP
+#define KAGOME_TEST_MOCK_CORE_TRANSACTION_POOL_POOL_REVALIDATOR_MOCK_HPP
+
+#include "transaction_pool/pool_revalidator.hpp"
+
+#include <gmock/gmock.h>
+
+namespace kagome::transaction_pool {
+
+  class PoolRevalidatorMock : public PoolRevalidator {
+   public:
+    MOCK_METHOD1(onBlockImported, void(const primitives::Block &));
+  };
+
+}  // namespace kagome::transaction_pool
+
+#endif  // KAGOME_TEST_MOCK_CORE_TRANSACTION_POOL_POOL_REVALIDATOR_MOCK_HPP
@@ -23,10 +23,21 @@ namespace kagome::transaction_pool {
     MOCK_METHOD1(removeOne, outcome::result<void>(const Transaction::Hash &));
     MOCK_METHOD1(remove,
                  outcome::result<void>(const std::vector<Transaction::Hash> &));
+    MOCK_METHOD1(reportInvalid, void(const Transaction::Hash &));
 
     MOCK_CONST_METHOD0(
         getReadyTransactions,
         std::map<Transaction::Hash, std::shared_ptr<Transaction>>());
+    MOCK_CONST_METHOD0(getReadyIterator, std::unique_ptr<ReadyIterator>());
+
+    MOCK_CONST_METHOD1(getTransaction,
+                       std::shared_ptr<const Transaction>(
+                           const Transaction::Hash &));
+    MOCK_CONST_METHOD0(getTransactionHashes,
+                       std::vector<Transaction::Hash>());
+    MOCK_CONST_METHOD1(getTransactionsByTags,
+                       std::vector<Transaction::Hash>(
+                           const std::vector<Transaction::Tag> &));
 
     MOCK_METHOD1(
         removeStale,
@@ -35,6 +46,12 @@ namespace kagome::transaction_pool {
     MOCK_CONST_METHOD0(getStatus, Status());
   };
 
+  class ReadyIteratorMock : public TransactionPool::ReadyIterator {
+   public:
+    MOCK_METHOD0(next, std::shared_ptr<const Transaction>());
+    MOCK_METHOD0(skipDependents, void());
+  };
+
 }  // namespace kagome::transaction_pool
 
 #endif  // KAGOME_TEST_MOCK_CORE_TRANSACTION_POOL_TRANSACTION_POOL_MOCK_HPP